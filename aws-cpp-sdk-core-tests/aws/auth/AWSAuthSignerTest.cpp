@@ -439,3 +439,63 @@ TEST(AWSAuthV4SignerTest, PostXWWWFormURLEncoded)
 {
     RunV4TestCase("post-x-www-form-urlencoded");
 }
+
+TEST(AWSAuthV4SignerTest, PresignRequestWithCachedKeysForManyRegions)
+{
+    std::shared_ptr<Aws::Auth::AWSCredentialsProvider> credProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOC_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    TestableAuthv4Signer sharedSigner(credProvider, "s3", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    DateTime timestamp(DateTime::Now());
+    sharedSigner.SetSigningTimestamp(timestamp);
+
+    const char* regions[] = { "us-east-1", "us-west-2", "eu-west-1", "ap-northeast-1", "sa-east-1" };
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (const char* region : regions)
+        {
+            //a fresh signer derives every key from scratch.
+            TestableAuthv4Signer freshSigner(credProvider, "s3", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+            freshSigner.SetSigningTimestamp(timestamp);
+
+            Standard::StandardHttpRequest cachedRequest("https://bucket.s3.amazonaws.com/key", HttpMethod::HTTP_GET);
+            Standard::StandardHttpRequest freshRequest("https://bucket.s3.amazonaws.com/key", HttpMethod::HTTP_GET);
+            ASSERT_TRUE(sharedSigner.PresignRequest(cachedRequest, region, 3600));
+            ASSERT_TRUE(freshSigner.PresignRequest(freshRequest, region, 3600));
+            ASSERT_EQ(freshRequest.GetURIString(), cachedRequest.GetURIString());
+        }
+    }
+}
+
+TEST(AWSAuthV4SignerTest, ResignSameRequestAcrossTestSuite)
+{
+    static const char* testCases[] = { "get-header-key-duplicate", "get-header-value-multiline", "get-header-value-order",
+        "get-header-value-trim", "get-unreserved", "get-utf8", "get-vanilla", "get-vanilla-empty-query-key", "get-vanilla-query",
+        "get-vanilla-query-order-key-case", "get-vanilla-query-unreserved", "get-vanilla-utf8-query", "post-header-key-case",
+        "post-header-key-sort", "post-header-value-case", "post-vanilla", "post-vanilla-empty-query-value", "post-vanilla-query",
+        "post-x-www-form-urlencoded" };
+
+    //one signer for every case, so nothing it keeps between requests may leak into the next signature.
+    std::shared_ptr<Aws::Auth::AWSCredentialsProvider> credProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOC_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    TestableAuthv4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+
+    for (const char* testCase : testCases)
+    {
+        Aws::String requestFileName = MakeSigV4ResourceFilePath(testCase, "req");
+        Aws::FStream requestFile(requestFileName.c_str(), std::ios::in);
+        Aws::String expectedSignatureFileName = MakeSigV4ResourceFilePath(testCase, "authz");
+        Aws::FStream signatureFile(expectedSignatureFileName.c_str(), std::ios::in);
+        Aws::String expectedSignature;
+        std::getline(signatureFile, expectedSignature);
+
+        DateTime timestampForSigner;
+        auto request = ParseHttpRequest(requestFile, timestampForSigner, Scheme::HTTP);
+        signer.SetSigningTimestamp(timestampForSigner);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            //drop the previous signature so every pass signs the same set of headers.
+            request.DeleteHeader(Aws::Http::AUTHORIZATION_HEADER);
+            ASSERT_TRUE(signer.SignRequest(request));
+            EXPECT_STREQ(expectedSignature.c_str(), request.GetAwsAuthorization().c_str()) << testCase;
+        }
+    }
+}
@@ -0,0 +1,126 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/SigningKeyCache.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+static const char SECRET_KEY[] = "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY";
+
+//any deterministic 32 byte value works as a stand-in for the derived key.
+static ByteBuffer FakeDerivedKey(const Aws::String& simpleDate, const Aws::String& region, const Aws::String& service)
+{
+    return HashingUtils::CalculateSHA256(simpleDate + "/" + region + "/" + service);
+}
+
+TEST(SigningKeyCacheTest, ReturnsOnlyKeysThatWereCached)
+{
+    SigningKeyCache cache;
+    ByteBuffer derivedKey;
+    ASSERT_FALSE(cache.Get(SECRET_KEY, "20150830", "us-east-1", "iam", derivedKey));
+
+    cache.Put(SECRET_KEY, "20150830", "us-east-1", "iam", FakeDerivedKey("20150830", "us-east-1", "iam"));
+    ASSERT_TRUE(cache.Get(SECRET_KEY, "20150830", "us-east-1", "iam", derivedKey));
+    ASSERT_EQ(FakeDerivedKey("20150830", "us-east-1", "iam"), derivedKey);
+
+    ASSERT_FALSE(cache.Get(SECRET_KEY, "20150831", "us-east-1", "iam", derivedKey));
+    ASSERT_FALSE(cache.Get(SECRET_KEY, "20150830", "us-west-2", "iam", derivedKey));
+    ASSERT_FALSE(cache.Get(SECRET_KEY, "20150830", "us-east-1", "s3", derivedKey));
+    ASSERT_FALSE(cache.Get("rotatedSecret", "20150830", "us-east-1", "iam", derivedKey));
+    //the parts are length prefixed, moving characters between them is a different key.
+    ASSERT_FALSE(cache.Get(SECRET_KEY, "20150830", "us-east-1i", "am", derivedKey));
+}
+
+TEST(SigningKeyCacheTest, KeepsEntriesForManyRegions)
+{
+    SigningKeyCache cache;
+    const char* regions[] = { "us-east-1", "us-west-2", "eu-west-1", "ap-northeast-1" };
+    for (const char* region : regions)
+    {
+        cache.Put(SECRET_KEY, "20150830", region, "s3", FakeDerivedKey("20150830", region, "s3"));
+    }
+
+    ByteBuffer derivedKey;
+    size_t hits = 0;
+    for (const char* region : regions)
+    {
+        if (cache.Get(SECRET_KEY, "20150830", region, "s3", derivedKey))
+        {
+            ASSERT_EQ(FakeDerivedKey("20150830", region, "s3"), derivedKey);
+            ++hits;
+        }
+    }
+    //two way buckets can still collide, but most of a handful of regions must survive.
+    ASSERT_GE(hits, 3u);
+}
+
+TEST(SigningKeyCacheTest, DoesNotCacheOversizedKeys)
+{
+    SigningKeyCache cache;
+    Aws::String longSecret(200, 'k');
+    cache.Put(longSecret, "20150830", "us-east-1", "iam", FakeDerivedKey("20150830", "us-east-1", "iam"));
+
+    ByteBuffer derivedKey;
+    ASSERT_FALSE(cache.Get(longSecret, "20150830", "us-east-1", "iam", derivedKey));
+}
+
+TEST(SigningKeyCacheTest, ConcurrentReadersNeverSeeTornEntries)
+{
+    SigningKeyCache cache;
+    std::atomic<bool> stop(false);
+    std::atomic<int> mismatches(0);
+
+    Aws::Vector<Aws::String> services;
+    Aws::Vector<ByteBuffer> expected;
+    for (int i = 0; i < 64; ++i)
+    {
+        services.push_back("service" + StringUtils::to_string(i));
+        expected.push_back(FakeDerivedKey("20150830", "us-east-1", services.back()));
+    }
+
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&, t] {
+            ByteBuffer derivedKey;
+            for (size_t i = t; !stop; i = (i + 1) % services.size())
+            {
+                if (t % 2 == 0)
+                {
+                    cache.Put(SECRET_KEY, "20150830", "us-east-1", services[i], expected[i]);
+                }
+                else if (cache.Get(SECRET_KEY, "20150830", "us-east-1", services[i], derivedKey) && !(derivedKey == expected[i]))
+                {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    stop = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(0, mismatches.load());
+}
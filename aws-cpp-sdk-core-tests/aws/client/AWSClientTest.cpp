@@ -18,6 +18,7 @@
 #include <aws/core/http/standard/StandardHttpRequest.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/ResponseBodySink.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/Globals.h>
@@ -28,7 +29,10 @@
 #include <aws/core/platform/FileSystem.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/core/platform/Environment.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <fstream>
+#include <future>
+#include <atomic>
 
 using Aws::Utils::DateTime;
 using Aws::Utils::DateFormat;
@@ -58,6 +62,33 @@ protected:
     }
 };
 
+//writes part of a successful body through the response body sink of the first request, then fails it like a dropped connection.
+class PartialBodyHttpClient : public MockHttpClient
+{
+public:
+    PartialBodyHttpClient() : m_partialBodySent(false) {}
+
+    std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        if (!m_partialBodySent)
+        {
+            m_partialBodySent = true;
+            StandardHttpResponse response(request);
+            response.SetResponseCode(HttpResponseCode::OK);
+            if (auto sink = BeginResponseBody(*request, response))
+            {
+                sink->OnBodyData("partial", 7);
+            }
+        }
+        return MockHttpClient::MakeRequest(request, readLimiter, writeLimiter);
+    }
+
+private:
+    mutable bool m_partialBodySent;
+};
+
 class AWSClientTestSuite : public ::testing::Test
 {
 protected:
@@ -131,6 +162,19 @@ protected:
      }
 };
 
+TEST_F(AWSClientTestSuite, TestWarmUpSendsHeadRequestsToTheEndpoint)
+{
+    ASSERT_EQ(0u, client->WarmUp(2));
+    ASSERT_EQ(0u, mockHttpClient->GetAllRequestsMade().size());
+
+    QueueMockResponse(HttpResponseCode::FORBIDDEN, HeaderValueCollection());
+    client->SetWarmUpEndpoint("http://service.us-east-1.amazonaws.com");
+    ASSERT_EQ(1u, client->WarmUp(1));
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+    ASSERT_EQ(HttpMethod::HTTP_HEAD, mockHttpClient->GetMostRecentHttpRequest().GetMethod());
+    ASSERT_EQ("service.us-east-1.amazonaws.com", mockHttpClient->GetMostRecentHttpRequest().GetUri().GetAuthority());
+}
+
 TEST_F(AWSClientTestSuite, TestClockSkewOutsideAcceptableRange)
 {
     HeaderValueCollection responseHeaders, requestHeaders;
@@ -222,6 +266,144 @@ TEST_F(AWSClientTestSuite, TestClockChangesAfterSkewHasBeenSet)
     ASSERT_EQ(1, client->GetRequestAttemptedRetries());
 }
 
+TEST_F(AWSClientTestSuite, TestAsyncAttemptRetriesThenCompletes)
+{
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    mockHttpClient->AddResponseToReturn(nullptr); // network failure, retryable
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+
+    bool handlerCalled = false;
+    HttpResponseOutcome outcome;
+    client->MakeRequestAsync(request, [&](const HttpResponseOutcome& receivedOutcome)
+    {
+        ASSERT_FALSE(handlerCalled);
+        handlerCalled = true;
+        outcome = receivedOutcome;
+    });
+
+    // the mock http client completes requests inline, so the whole exchange has run by now.
+    ASSERT_TRUE(handlerCalled);
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(1, client->GetRequestAttemptedRetries());
+    ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST_F(AWSClientTestSuite, TestAsyncAttemptBacksOffOnRetryTimer)
+{
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    mockHttpClient->AddResponseToReturn(nullptr);
+    mockHttpClient->AddResponseToReturn(nullptr); // second retry waits 50ms on the client's retry timer
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+
+    std::promise<HttpResponseOutcome> outcomePromise;
+    auto outcomeFuture = outcomePromise.get_future();
+    client->MakeRequestAsync(request, [&](const HttpResponseOutcome& receivedOutcome)
+    {
+        outcomePromise.set_value(receivedOutcome);
+    });
+
+    ASSERT_EQ(std::future_status::ready, outcomeFuture.wait_for(std::chrono::seconds(10)));
+    ASSERT_TRUE(outcomeFuture.get().IsSuccess());
+    ASSERT_EQ(2, client->GetRequestAttemptedRetries());
+    ASSERT_EQ(3u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST_F(AWSClientTestSuite, TestAsyncAttemptCompletesOnExecutor)
+{
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 1);
+
+    std::promise<std::thread::id> handlerThread;
+    auto handlerThreadFuture = handlerThread.get_future();
+    client->MakeRequestAsync(request, [&](const HttpResponseOutcome& receivedOutcome)
+    {
+        ASSERT_TRUE(receivedOutcome.IsSuccess());
+        handlerThread.set_value(std::this_thread::get_id());
+    }, executor);
+
+    // the mock completes the request on this thread, the handler must still be handed to the executor.
+    ASSERT_EQ(std::future_status::ready, handlerThreadFuture.wait_for(std::chrono::seconds(10)));
+    ASSERT_NE(std::this_thread::get_id(), handlerThreadFuture.get());
+}
+
+TEST_F(AWSClientTestSuite, TestRetryStartsTheResponseBodySinkOver)
+{
+    auto partialBodyHttpClient = Aws::MakeShared<PartialBodyHttpClient>(ALLOCATION_TAG);
+    mockHttpClientFactory->SetClient(partialBodyHttpClient);
+    ClientConfiguration config;
+    config.scheme = Scheme::HTTP;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG);
+    client = Aws::MakeUnique<MockAWSClient>(ALLOCATION_TAG, config);
+
+    unsigned char buffer[16];
+    auto bufferSink = Aws::MakeShared<BufferResponseBodySink>(ALLOCATION_TAG, buffer, sizeof(buffer));
+    AmazonWebServiceRequestMock request;
+    request.SetResponseBodySink(bufferSink);
+
+    // the retry fails before any body arrives, so only the start of the attempt can drop the partial body.
+    partialBodyHttpClient->AddResponseToReturn(nullptr);
+    auto httpRequest = CreateHttpRequest(URI("http://www.uri.com/path/to/res"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto httpResponse = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, httpRequest);
+    httpResponse->SetResponseCode(HttpResponseCode::BAD_REQUEST);
+    partialBodyHttpClient->AddResponseToReturn(httpResponse);
+
+    HttpResponseOutcome outcome = client->MakeRequest(request);
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(1, client->GetRequestAttemptedRetries());
+    ASSERT_EQ(2u, partialBodyHttpClient->GetAllRequestsMade().size());
+    ASSERT_EQ(0u, bufferSink->GetBytesWritten());
+
+    size_t resets = 0;
+    request.SetResponseBodySink(Aws::MakeShared<CallbackResponseBodySink>(ALLOCATION_TAG,
+        [](const char*, std::size_t) { return true; }, [&resets]() { ++resets; }));
+    partialBodyHttpClient->AddResponseToReturn(nullptr);
+    partialBodyHttpClient->AddResponseToReturn(httpResponse);
+    client->MakeRequest(request);
+    ASSERT_EQ(2u, resets);
+}
+
+TEST_F(AWSClientTestSuite, TestDestroyingClientCompletesAttemptsInFlight)
+{
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    mockHttpClient->AddResponseToReturn(nullptr);
+    mockHttpClient->AddResponseToReturn(nullptr); // the next attempt waits on the client's retry timer
+
+    std::atomic<int> handlerCalls(0);
+    HttpResponseOutcome outcome;
+    client->MakeRequestAsync(request, [&](const HttpResponseOutcome& receivedOutcome)
+    {
+        outcome = receivedOutcome;
+        ++handlerCalls;
+    });
+
+    // the destructor waits for the parked retry to fail and hand off its outcome before tearing anything down.
+    client = nullptr;
+    ASSERT_EQ(1, handlerCalls.load());
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(CoreErrors::NETWORK_CONNECTION, outcome.GetError().GetErrorType());
+}
+
+TEST_F(AWSClientTestSuite, TestAsyncAttemptStopsOnNonRetryableError)
+{
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    QueueMockResponse(HttpResponseCode::BAD_REQUEST, HeaderValueCollection());
+
+    bool handlerCalled = false;
+    HttpResponseOutcome outcome;
+    client->MakeRequestAsync(request, [&](const HttpResponseOutcome& receivedOutcome)
+    {
+        handlerCalled = true;
+        outcome = receivedOutcome;
+    });
+
+    ASSERT_TRUE(handlerCalled);
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(0, client->GetRequestAttemptedRetries());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+}
+
 TEST(AWSClientTest, TestBuildHttpRequestWithHeadersOnly)
 {
     HeaderValueCollection headerValues;
@@ -19,6 +19,20 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/client/ClientConfiguration.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
 
 using namespace Aws::Http;
 #ifndef NO_HTTP_CLIENT
@@ -30,4 +44,222 @@ TEST(HttpClientTest, TestNullResponse)
 	auto response = httpClient->MakeRequest(request);
 	ASSERT_EQ(nullptr, response);
 }
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+TEST(HttpClientTest, TestCurlMultiNullResponse)
+{
+    auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    Aws::Client::ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    auto httpClient = CreateHttpClient(config);
+    ASSERT_TRUE(httpClient->SupportsAsyncRequests());
+    auto response = httpClient->MakeRequest(request);
+    ASSERT_EQ(nullptr, response);
+}
+
+TEST(HttpClientTest, TestCurlMultiAsyncRequestsComplete)
+{
+    Aws::Client::ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    config.eventLoopThreads = 2;
+    auto httpClient = CreateHttpClient(config);
+
+    const int requestCount = 16;
+    std::mutex completionLock;
+    std::condition_variable completionSignal;
+    int completed = 0;
+    std::atomic<int> nullResponses(0);
+
+    for (int i = 0; i < requestCount; ++i)
+    {
+        auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+                HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        httpClient->MakeAsyncRequest(request, [&](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+        {
+            if (!response)
+            {
+                ++nullResponses;
+            }
+            std::lock_guard<std::mutex> locker(completionLock);
+            ++completed;
+            completionSignal.notify_one();
+        });
+    }
+
+    std::unique_lock<std::mutex> locker(completionLock);
+    ASSERT_TRUE(completionSignal.wait_for(locker, std::chrono::seconds(60), [&](){ return completed == requestCount; }));
+    ASSERT_EQ(requestCount, nullResponses.load());
+}
+
+namespace
+{
+    //answers every request with an empty 200 and keeps the connection open, counting the connections and requests it sees.
+    class KeepAliveServer
+    {
+    public:
+        KeepAliveServer() : m_listenFd(socket(AF_INET, SOCK_STREAM, 0)), m_port(0), m_accepted(0), m_served(0)
+        {
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t length = sizeof(address);
+            if (bind(m_listenFd, reinterpret_cast<sockaddr*>(&address), length) == 0 && listen(m_listenFd, 16) == 0 &&
+                getsockname(m_listenFd, reinterpret_cast<sockaddr*>(&address), &length) == 0)
+            {
+                m_port = ntohs(address.sin_port);
+            }
+            m_acceptThread = std::thread(&KeepAliveServer::Accept, this);
+        }
+
+        ~KeepAliveServer()
+        {
+            shutdown(m_listenFd, SHUT_RDWR);
+            m_acceptThread.join();
+            close(m_listenFd);
+            for (auto& connection : m_connections)
+            {
+                connection.join();
+            }
+        }
+
+        Aws::String GetEndpoint() const { return "127.0.0.1:" + Aws::Utils::StringUtils::to_string(m_port); }
+        size_t GetAcceptedCount() const { return m_accepted.load(); }
+        size_t GetServedCount() const { return m_served.load(); }
+
+    private:
+        void Accept()
+        {
+            int connectionFd;
+            while ((connectionFd = accept(m_listenFd, nullptr, nullptr)) >= 0)
+            {
+                ++m_accepted;
+                m_connections.emplace_back(&KeepAliveServer::Serve, this, connectionFd);
+            }
+        }
+
+        void Serve(int connectionFd)
+        {
+            static const char RESPONSE[] = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n";
+            Aws::String received;
+            char buffer[1024];
+            ssize_t readLength;
+            while ((readLength = read(connectionFd, buffer, sizeof(buffer))) > 0)
+            {
+                received.append(buffer, readLength);
+                size_t end;
+                while ((end = received.find("\r\n\r\n")) != Aws::String::npos)
+                {
+                    received.erase(0, end + 4);
+                    ++m_served;
+                    //give concurrent requests a chance to overlap, so each needs its own connection.
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    if (write(connectionFd, RESPONSE, sizeof(RESPONSE) - 1) < 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            close(connectionFd);
+        }
+
+        int m_listenFd;
+        unsigned short m_port;
+        std::atomic<size_t> m_accepted;
+        std::atomic<size_t> m_served;
+        std::thread m_acceptThread;
+        Aws::Vector<std::thread> m_connections;
+    };
+
+    void AssertWarmUpConnectionsAreReused(TransferLibType transferLib)
+    {
+        KeepAliveServer server;
+        Aws::Client::ClientConfiguration config;
+        config.scheme = Scheme::HTTP;
+        config.endpointOverride = server.GetEndpoint();
+        config.connectionPoolWarmUpSize = 4;
+        config.httpLibOverride = transferLib;
+        Aws::String host = "http://" + server.GetEndpoint();
+
+        auto httpClient = std::static_pointer_cast<CurlHttpClient>(CreateHttpClient(config));
+        auto stats = httpClient->GetHostConnectionStats();
+        ASSERT_EQ(1u, stats.size());
+        ASSERT_EQ(4u, stats[host].requestCount);
+        ASSERT_LT(0u, stats[host].newConnectionCount);
+        ASSERT_EQ(4u, stats[host].newConnectionCount + stats[host].reusedConnectionCount);
+        ASSERT_EQ(stats[host].newConnectionCount, server.GetAcceptedCount());
+
+        for (int i = 0; i < 4; ++i)
+        {
+            auto request = CreateHttpRequest(host + "/item", HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            auto response = httpClient->MakeRequest(request);
+            ASSERT_NE(nullptr, response);
+            ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+        }
+        auto newConnections = stats[host].newConnectionCount;
+        stats = httpClient->GetHostConnectionStats();
+        ASSERT_EQ(8u, stats[host].requestCount);
+        ASSERT_EQ(newConnections, stats[host].newConnectionCount);
+        ASSERT_EQ(newConnections, server.GetAcceptedCount());
+        httpClient = nullptr;
+    }
+}
+
+TEST(HttpClientTest, TestCurlWarmUpConnectionsAreReused)
+{
+    AssertWarmUpConnectionsAreReused(TransferLibType::CURL_CLIENT);
+}
+
+TEST(HttpClientTest, TestCurlMultiWarmUpConnectionsAreReused)
+{
+    AssertWarmUpConnectionsAreReused(TransferLibType::CURL_MULTI_CLIENT);
+}
+
+TEST(HttpClientTest, TestCurlIdleConnectionsAreRefreshed)
+{
+    KeepAliveServer server;
+    Aws::Client::ClientConfiguration config;
+    config.scheme = Scheme::HTTP;
+    config.endpointOverride = server.GetEndpoint();
+    config.connectionPoolWarmUpSize = 2;
+    config.idleConnectionRefreshIntervalMs = 50;
+    config.httpLibOverride = TransferLibType::CURL_CLIENT;
+
+    auto httpClient = std::static_pointer_cast<CurlHttpClient>(CreateHttpClient(config));
+    size_t warmUpRequests = server.GetServedCount();
+    ASSERT_EQ(2u, warmUpRequests);
+
+    //every idle connection gets a request per interval, over the connection it already has.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (server.GetServedCount() < warmUpRequests + 3 * server.GetAcceptedCount() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_LE(warmUpRequests + 3 * server.GetAcceptedCount(), server.GetServedCount());
+    //the refreshes are not requests the caller made, only the warm-up shows in the stats.
+    auto stats = httpClient->GetHostConnectionStats()["http://" + server.GetEndpoint()];
+    ASSERT_EQ(warmUpRequests, stats.requestCount);
+    ASSERT_EQ(warmUpRequests, stats.newConnectionCount + stats.reusedConnectionCount);
+    //and they went out over the warmed up connections.
+    ASSERT_EQ(server.GetAcceptedCount(), stats.newConnectionCount);
+    httpClient = nullptr;
+}
+
+TEST(HttpClientTest, TestCurlFailedRequestIsNotCountedAsAConnection)
+{
+    auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws/path?query"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    Aws::Client::ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_CLIENT;
+    auto httpClient = std::static_pointer_cast<CurlHttpClient>(CreateHttpClient(config));
+    ASSERT_EQ(nullptr, httpClient->MakeRequest(request));
+
+    auto stats = httpClient->GetHostConnectionStats();
+    ASSERT_EQ(1u, stats.size());
+    const auto& hostStats = stats["http://some.unknown1234xxx.test.aws"];
+    ASSERT_EQ(1u, hostStats.requestCount);
+    ASSERT_EQ(0u, hostStats.newConnectionCount);
+    ASSERT_EQ(0u, hostStats.reusedConnectionCount);
+}
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
 #endif
@@ -0,0 +1,89 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/http/ResponseBodySink.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/Array.h>
+
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+static const char* ALLOCATION_TAG = "ResponseBodySinkTest";
+
+TEST(ResponseBodySinkTest, BufferSinkWritesChunksContiguously)
+{
+    Aws::Utils::ByteBuffer buffer(8);
+    BufferResponseBodySink sink(buffer.GetUnderlyingData(), buffer.GetLength());
+
+    ASSERT_TRUE(sink.OnBodyData("abc", 3));
+    ASSERT_TRUE(sink.OnBodyData("defgh", 5));
+    ASSERT_EQ(8u, sink.GetBytesWritten());
+    ASSERT_EQ(0, memcmp("abcdefgh", buffer.GetUnderlyingData(), 8));
+
+    //a body that doesn't fit aborts instead of being cut short.
+    ASSERT_FALSE(sink.OnBodyData("i", 1));
+    ASSERT_EQ(8u, sink.GetBytesWritten());
+
+    sink.Reset();
+    ASSERT_EQ(0u, sink.GetBytesWritten());
+    ASSERT_TRUE(sink.OnBodyData("xy", 2));
+    ASSERT_EQ(0, memcmp("xycdefgh", buffer.GetUnderlyingData(), 8));
+}
+
+TEST(ResponseBodySinkTest, CallbackSinkForwardsChunksAndResets)
+{
+    Aws::String received;
+    int resets = 0;
+    CallbackResponseBodySink sink([&](const char* data, size_t length) { received.append(data, length); return received.size() < 6; },
+            [&]() { ++resets; received.clear(); });
+
+    ASSERT_TRUE(sink.OnBodyData("abc", 3));
+    ASSERT_FALSE(sink.OnBodyData("def", 3));
+    ASSERT_EQ("abcdef", received);
+
+    sink.Reset();
+    ASSERT_EQ(1, resets);
+    ASSERT_TRUE(received.empty());
+}
+
+TEST(ResponseBodySinkTest, OnlySuccessfulResponsesUseTheSink)
+{
+    auto request = CreateHttpRequest(Aws::String("http://example.amazonaws.com"), HttpMethod::HTTP_GET,
+            Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    StandardHttpResponse response(request);
+
+    response.SetResponseCode(HttpResponseCode::OK);
+    ASSERT_EQ(nullptr, BeginResponseBody(*request, response));
+
+    Aws::Utils::ByteBuffer buffer(4);
+    auto sink = Aws::MakeShared<BufferResponseBodySink>(ALLOCATION_TAG, buffer.GetUnderlyingData(), buffer.GetLength());
+    request->SetResponseBodySink(sink);
+    sink->OnBodyData("ab", 2);
+
+    ASSERT_EQ(sink.get(), BeginResponseBody(*request, response));
+    //every attempt starts the body over.
+    ASSERT_EQ(0u, sink->GetBytesWritten());
+
+    response.SetResponseCode(HttpResponseCode::PARTIAL_CONTENT);
+    ASSERT_EQ(sink.get(), BeginResponseBody(*request, response));
+
+    //error bodies stay in the response stream for the error marshaller.
+    response.SetResponseCode(HttpResponseCode::NOT_FOUND);
+    ASSERT_EQ(nullptr, BeginResponseBody(*request, response));
+    response.SetResponseCode(HttpResponseCode::SERVICE_UNAVAILABLE);
+    ASSERT_EQ(nullptr, BeginResponseBody(*request, response));
+}
@@ -68,6 +68,36 @@ TEST(FileTest, TempFile)
     ASSERT_FALSE(testIn.good());
 }
 
+TEST(FileTest, MappedFileRegion)
+{
+    TempFile tempFile(std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    //long enough that the regions below start off a page boundary on every platform.
+    Aws::String contents;
+    for (size_t i = 0; i < 200000; ++i)
+    {
+        contents.push_back(static_cast<char>('a' + i % 26));
+    }
+    tempFile.write(contents.c_str(), contents.size());
+    tempFile.close();
+
+    {
+        Aws::FileSystem::MappedFileRegion region(tempFile.GetFileName(), 70001, 100000);
+        ASSERT_TRUE(region);
+        ASSERT_EQ(100000u, region.GetLength());
+        ASSERT_EQ(0, memcmp(contents.c_str() + 70001, region.GetData(), region.GetLength()));
+    }
+
+    {
+        Aws::FileSystem::MappedFileRegion region(tempFile.GetFileName(), 0, contents.size());
+        ASSERT_TRUE(region);
+        ASSERT_EQ(0, memcmp(contents.c_str(), region.GetData(), region.GetLength()));
+    }
+
+    ASSERT_FALSE(Aws::FileSystem::MappedFileRegion(tempFile.GetFileName(), 150000, 50001));
+    ASSERT_FALSE(Aws::FileSystem::MappedFileRegion(tempFile.GetFileName(), 0, 0));
+    ASSERT_FALSE(Aws::FileSystem::MappedFileRegion("boogieMan", 0, 1));
+}
+
 class DirectoryTreeTest : public ::testing::Test
 {
 public:
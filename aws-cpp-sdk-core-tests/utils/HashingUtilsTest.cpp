@@ -16,7 +16,15 @@
 #include <aws/external/gtest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/base64/Base64.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/crypto/Sha256TreeHash.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <algorithm>
+#include <cstring>
 
 
 using namespace Aws::Utils;
@@ -157,6 +165,31 @@ TEST(HashingUtilsTest, TestSHA256FromStream)
             "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1");
 }
 
+TEST(HashingUtilsTest, TestSHA256FromUpdates)
+{
+    Aws::Utils::Crypto::Sha256 hash;
+    const Aws::String message = "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+
+    //feed the message in uneven pieces.
+    for (size_t offset = 0, piece = 1; offset < message.size(); offset += piece, ++piece)
+    {
+        hash.Update(reinterpret_cast<const unsigned char*>(message.c_str()) + offset, std::min(piece, message.size() - offset));
+    }
+    auto result = hash.GetHash();
+    ASSERT_TRUE(result.IsSuccess());
+    EXPECT_STREQ("cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1", HashingUtils::HexEncode(result.GetResult()).c_str());
+
+    //GetHash starts a new digest.
+    hash.Update(reinterpret_cast<const unsigned char*>("abc"), 3);
+    result = hash.GetHash();
+    ASSERT_TRUE(result.IsSuccess());
+    EXPECT_STREQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", HashingUtils::HexEncode(result.GetResult()).c_str());
+
+    result = hash.GetHash();
+    ASSERT_TRUE(result.IsSuccess());
+    EXPECT_STREQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", HashingUtils::HexEncode(result.GetResult()).c_str());
+}
+
 TEST(HashingUtilsTest, TestSHA256TreeHashEqualsSHA256FromStringWhenSizeLessEqualThanOneMB)
 {
     Aws::Vector<Aws::String> strVec;
@@ -321,3 +354,213 @@ TEST(HashingUtilsTest, TestMD5FromStream)
     TestMD5FromStream( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", "V+30oivjyVWsSdouIQe2eg==" );
 }
 
+TEST(HashingUtilsTest, TestConstexprHashStringMatchesHashString)
+{
+    static_assert(HashingUtils::ConstexprHashString("") == 0, "empty string hashes to zero");
+    switch (HashingUtils::HashString("ConsumedCapacity"))
+    {
+        case HashingUtils::ConstexprHashString("ConsumedCapacity"):
+            break;
+        default:
+            FAIL();
+    }
+
+    for (const char* value : { "", "a", "TableName", "LastEvaluatedKey", "a much longer member name than any service uses \xc3\xa9" })
+    {
+        ASSERT_EQ(HashingUtils::HashString(value), HashingUtils::ConstexprHashString(value));
+    }
+}
+
+//byte at a time codecs the vectorized ones must agree with.
+static Aws::String ReferenceBase64Encode(const ByteBuffer& buffer)
+{
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    Aws::String encoded;
+    for (size_t i = 0; i < buffer.GetLength(); i += 3)
+    {
+        uint32_t block = static_cast<uint32_t>(buffer[i]) << 16;
+        block |= i + 1 < buffer.GetLength() ? static_cast<uint32_t>(buffer[i + 1]) << 8 : 0;
+        block |= i + 2 < buffer.GetLength() ? buffer[i + 2] : 0;
+        encoded.push_back(table[(block >> 18) & 0x3F]);
+        encoded.push_back(table[(block >> 12) & 0x3F]);
+        encoded.push_back(i + 1 < buffer.GetLength() ? table[(block >> 6) & 0x3F] : '=');
+        encoded.push_back(i + 2 < buffer.GetLength() ? table[block & 0x3F] : '=');
+    }
+    return encoded;
+}
+
+static Aws::String ReferenceHexEncode(const ByteBuffer& buffer)
+{
+    Aws::String encoded;
+    for (size_t i = 0; i < buffer.GetLength(); ++i)
+    {
+        encoded.push_back("0123456789abcdef"[buffer[i] >> 4]);
+        encoded.push_back("0123456789abcdef"[buffer[i] & 0x0f]);
+    }
+    return encoded;
+}
+
+static ByteBuffer RandomBuffer(size_t length, uint32_t seed)
+{
+    ByteBuffer buffer(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<unsigned char>(seed >> 16);
+    }
+    return buffer;
+}
+
+TEST(HashingUtilsTest, TestCodecsMatchReferenceForEveryLength)
+{
+    for (size_t length = 0; length < 300; ++length)
+    {
+        ByteBuffer data = RandomBuffer(length, static_cast<uint32_t>(length));
+
+        Aws::String base64 = HashingUtils::Base64Encode(data);
+        ASSERT_EQ(ReferenceBase64Encode(data), base64);
+        ASSERT_EQ(data, HashingUtils::Base64Decode(base64));
+
+        Aws::String hex = HashingUtils::HexEncode(data);
+        ASSERT_EQ(ReferenceHexEncode(data), hex);
+        if (length > 0)
+        {
+            ASSERT_EQ(data, HashingUtils::HexDecode(hex));
+            std::transform(hex.begin(), hex.end(), hex.begin(), ::toupper);
+            ASSERT_EQ(data, HashingUtils::HexDecode("0x" + hex));
+        }
+    }
+}
+
+TEST(HashingUtilsTest, TestCodecsIntoCallerBuffers)
+{
+    ByteBuffer data = RandomBuffer(1000, 7);
+    Aws::String base64 = ReferenceBase64Encode(data);
+
+    //the codecs write exactly the computed lengths and nothing past them.
+    Aws::Vector<char> encoded(base64.size() + 1, '#');
+    ASSERT_EQ(base64.size(), HashingUtils::Base64Encode(data.GetUnderlyingData(), data.GetLength(), encoded.data()));
+    ASSERT_EQ(base64, Aws::String(encoded.data(), base64.size()));
+    ASSERT_EQ('#', encoded.back());
+
+    size_t decodedLength = Base64::Base64::CalculateBase64DecodedLength(base64.c_str(), base64.size());
+    ASSERT_EQ(data.GetLength(), decodedLength);
+    Aws::Vector<unsigned char> decoded(decodedLength + 1, 0xEE);
+    ASSERT_EQ(data.GetLength(), HashingUtils::Base64Decode(base64.c_str(), base64.size(), decoded.data()));
+    ASSERT_EQ(ByteBuffer(decoded.data(), data.GetLength()), data);
+    ASSERT_EQ(0xEE, decoded.back());
+
+    Aws::Vector<char> hex(2 * data.GetLength() + 1, '#');
+    HashingUtils::HexEncode(data.GetUnderlyingData(), data.GetLength(), hex.data());
+    ASSERT_EQ(ReferenceHexEncode(data), Aws::String(hex.data(), 2 * data.GetLength()));
+    ASSERT_EQ('#', hex.back());
+
+    Aws::Vector<unsigned char> fromHex(data.GetLength() + 1, 0xEE);
+    HashingUtils::HexDecode(hex.data(), 2 * data.GetLength(), fromHex.data());
+    ASSERT_EQ(ByteBuffer(fromHex.data(), data.GetLength()), data);
+    ASSERT_EQ(0xEE, fromHex.back());
+
+    //a custom alphabet takes the scalar path.
+    Base64::Base64 urlSafe("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+    Aws::String urlSafeEncoded = urlSafe.Encode(data);
+    Aws::String expected = base64;
+    std::replace(expected.begin(), expected.end(), '+', '-');
+    std::replace(expected.begin(), expected.end(), '/', '_');
+    ASSERT_EQ(expected, urlSafeEncoded);
+    ASSERT_EQ(data, urlSafe.Decode(urlSafeEncoded));
+}
+
+TEST(HashingUtilsTest, TestBase64DecodeOfAnyCharacterMatchesBlockByBlockDecode)
+{
+    Aws::String valid = ReferenceBase64Encode(RandomBuffer(72, 3));
+    ASSERT_EQ(96u, valid.size());
+
+    for (int character = 0; character < 256; ++character)
+    {
+        for (size_t position : { 5, 40, 70 })
+        {
+            Aws::String encoded = valid;
+            encoded[position] = static_cast<char>(character);
+
+            unsigned char whole[72] = {};
+            HashingUtils::Base64Decode(encoded.c_str(), encoded.size(), whole);
+
+            //four characters at a time are always decoded by the scalar code.
+            unsigned char blockwise[72] = {};
+            for (size_t block = 0; block < encoded.size() / 4; ++block)
+            {
+                HashingUtils::Base64Decode(encoded.c_str() + 4 * block, 4, blockwise + 3 * block);
+            }
+            ASSERT_EQ(0, memcmp(whole, blockwise, sizeof(whole))) << "character " << character << " at " << position;
+        }
+    }
+}
+
+TEST(HashingUtilsTest, TestCodecsMatchReferenceOnLargeBuffer)
+{
+    ByteBuffer data = RandomBuffer(1024 * 1024, 11);
+
+    Aws::String base64 = HashingUtils::Base64Encode(data);
+    ASSERT_EQ(ReferenceBase64Encode(data), base64);
+    ASSERT_EQ(data, HashingUtils::Base64Decode(base64));
+    ASSERT_EQ(ReferenceHexEncode(data), HashingUtils::HexEncode(data));
+}
+
+TEST(HashingUtilsTest, TestParallelSHA256TreeHashMatchesKnownValues)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+
+    Aws::StringStream fivePointFiveMBStream;
+    fivePointFiveMBStream << Aws::String(5767168, '0');
+    fivePointFiveMBStream.seekg(100);
+    EXPECT_STREQ("154e26c78fd74d0c2c9b3cc4644191619dc4f2cd539ae2a74d5fd07957a3ee6a",
+        HashingUtils::HexEncode(HashingUtils::CalculateSHA256TreeHash(fivePointFiveMBStream, &executor)).c_str());
+    ASSERT_EQ(100, fivePointFiveMBStream.tellg());
+
+    Aws::StringStream emptyStream;
+    ASSERT_EQ(HashingUtils::CalculateSHA256(""), HashingUtils::CalculateSHA256TreeHash(emptyStream, &executor));
+
+    //fewer buffers than leaves, so the reader has to wait for the hashing.
+    Crypto::Sha256TreeHash eightMB(&executor, 2);
+    ASSERT_STREQ("ff9ea39186cb33cd5ade7aca078e297a1622f8c1abdd4cc47bcbf66dc5877e1f",
+        HashingUtils::HexEncode(eightMB.Calculate(Aws::String(1024 * 1024 * 8, '0')).GetResult()).c_str());
+}
+
+TEST(HashingUtilsTest, TestSHA256TreeHashUpdatedInPiecesMatchesWholeInput)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    for (size_t length : { static_cast<size_t>(0), static_cast<size_t>(1), Crypto::Sha256TreeHash::LEAF_SIZE,
+        Crypto::Sha256TreeHash::LEAF_SIZE + 1, 7 * Crypto::Sha256TreeHash::LEAF_SIZE - 3 })
+    {
+        ByteBuffer data = RandomBuffer(length, static_cast<uint32_t>(length));
+        Aws::String whole(reinterpret_cast<const char*>(data.GetUnderlyingData()), length);
+        ByteBuffer expected = HashingUtils::CalculateSHA256TreeHash(whole);
+
+        Crypto::Sha256TreeHash serial;
+        Crypto::Sha256TreeHash parallel(&executor, 3);
+        //pieces that straddle the leaf boundaries, the way upload buffers arrive.
+        for (size_t offset = 0, piece = 1; offset < length; offset += piece, piece = piece * 7 % 300007 + 1)
+        {
+            size_t pieceLength = (std::min)(piece, length - offset);
+            serial.Update(data.GetUnderlyingData() + offset, pieceLength);
+            parallel.Update(data.GetUnderlyingData() + offset, pieceLength);
+        }
+        ASSERT_EQ(expected, serial.GetHash().GetResult());
+        ASSERT_EQ(expected, parallel.GetHash().GetResult());
+
+        //both start over after GetHash().
+        ASSERT_EQ(expected, parallel.Calculate(whole).GetResult());
+    }
+}
+
+TEST(HashingUtilsTest, TestParallelSHA256TreeHashMatchesSerialOnStream)
+{
+    //more leaves than pooled threads and buffers, plus a partial last leaf.
+    const size_t ARCHIVE_SIZE = 9 * 1024 * 1024 + 12345;
+    Aws::StringStream archive;
+    archive << Aws::String(ARCHIVE_SIZE, 'g');
+
+    ByteBuffer serial = HashingUtils::CalculateSHA256TreeHash(archive);
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    ASSERT_EQ(serial, HashingUtils::CalculateSHA256TreeHash(archive, &executor));
+}
@@ -347,6 +347,61 @@ TEST(AES_GCM_TEST, Test_Generated_IV)
 
 #endif
 
+static void TestToBufferMatchesBuffers(const std::function<std::shared_ptr<SymmetricCipher>(const CryptoBuffer&, const CryptoBuffer&)>& createCipher)
+{
+    CryptoBuffer key = SymmetricCipher::GenerateKey();
+    CryptoBuffer iv = SymmetricCipher::GenerateIV(16);
+    CryptoBuffer plainText((unsigned char*)TEST_ENCRYPTION_STRING, strlen(TEST_ENCRYPTION_STRING));
+    static const size_t CHUNK_SIZE = 37;
+
+    auto cipher = createCipher(key, iv);
+    auto toBufferCipher = createCipher(key, iv);
+    Aws::String expected, encrypted;
+    CryptoBuffer output(CHUNK_SIZE + 16);
+    for (size_t offset = 0; offset < plainText.GetLength(); offset += CHUNK_SIZE)
+    {
+        size_t chunkLength = (std::min)(CHUNK_SIZE, plainText.GetLength() - offset);
+        CryptoBuffer chunk = cipher->EncryptBuffer(CryptoBuffer(plainText.GetUnderlyingData() + offset, chunkLength));
+        expected.append((const char*)chunk.GetUnderlyingData(), chunk.GetLength());
+        size_t written = toBufferCipher->EncryptToBuffer(plainText.GetUnderlyingData() + offset, chunkLength, output.GetUnderlyingData(), output.GetLength());
+        ASSERT_TRUE(*toBufferCipher);
+        encrypted.append((const char*)output.GetUnderlyingData(), written);
+    }
+    CryptoBuffer finalBlock = cipher->FinalizeEncryption();
+    expected.append((const char*)finalBlock.GetUnderlyingData(), finalBlock.GetLength());
+    finalBlock = toBufferCipher->FinalizeEncryption();
+    encrypted.append((const char*)finalBlock.GetUnderlyingData(), finalBlock.GetLength());
+    ASSERT_EQ(expected, encrypted);
+
+    auto decryptCipher = createCipher(key, iv);
+    Aws::String decrypted;
+    for (size_t offset = 0; offset < encrypted.size(); offset += CHUNK_SIZE)
+    {
+        size_t chunkLength = (std::min)(CHUNK_SIZE, encrypted.size() - offset);
+        size_t written = decryptCipher->DecryptToBuffer((const unsigned char*)encrypted.c_str() + offset, chunkLength, output.GetUnderlyingData(), output.GetLength());
+        ASSERT_TRUE(*decryptCipher);
+        decrypted.append((const char*)output.GetUnderlyingData(), written);
+    }
+    finalBlock = decryptCipher->FinalizeDecryption();
+    decrypted.append((const char*)finalBlock.GetUnderlyingData(), finalBlock.GetLength());
+    ASSERT_STREQ(TEST_ENCRYPTION_STRING, decrypted.c_str());
+
+    //an output buffer too small for the output fails the cipher.
+    auto smallBufferCipher = createCipher(key, iv);
+    ASSERT_EQ(0u, smallBufferCipher->EncryptToBuffer(plainText.GetUnderlyingData(), output.GetLength(), output.GetUnderlyingData(), 1));
+    ASSERT_FALSE(*smallBufferCipher);
+}
+
+TEST(AES_CBC_TEST, TestToBufferMatchesBuffers)
+{
+    TestToBufferMatchesBuffers([](const CryptoBuffer& key, const CryptoBuffer& iv) { return CreateAES_CBCImplementation(key, iv); });
+}
+
+TEST(AES_CTR_TEST, TestToBufferMatchesBuffers)
+{
+    TestToBufferMatchesBuffers([](const CryptoBuffer& key, const CryptoBuffer& iv) { return CreateAES_CTRImplementation(key, iv); });
+}
+
 TEST(AES_KeyWrap_Test, RFC3394_256BitKey256CekTestVector)
 {
     Aws::String expected_cipher_text = "28C9F404C4B810F4CBCCB35CFB87F8263F5786E2D80ED326CBC7F0E71A99F43BFB988B9B7A02DD21";
@@ -0,0 +1,328 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Utils::Json;
+using namespace Aws::Utils;
+
+TEST(JsonReaderTest, ReadsNestedDocument)
+{
+    Aws::StringStream ss(
+        "{ \"Name\" : \"table\", \"Count\": 3, \"Size\": 12345678901234, \"Ratio\": 0.25, \"Active\": true,"
+        "  \"Skipped\": {\"a\": [1, {\"b\": \"]}\"}, null]}, \"Missing\": null,"
+        "  \"Items\": [ {\"Id\": \"1\"}, {\"Id\": \"2\", \"Extra\": false}, {} ],"
+        "  \"Tags\": {\"k1\": \"v1\", \"k2\": \"v2\"}, \"Empty\": [] }");
+    JsonReader reader(ss);
+
+    Aws::String name;
+    int count = 0;
+    long long size = 0;
+    double ratio = 0;
+    bool active = false;
+    Aws::Vector<Aws::String> ids;
+    Aws::Map<Aws::String, Aws::String> tags;
+    Aws::Vector<Aws::String> members;
+
+    Aws::String memberName;
+    ASSERT_TRUE(reader.BeginObject());
+    while (reader.NextMember(memberName))
+    {
+        members.push_back(memberName);
+        if (memberName == "Name")
+        {
+            name = reader.ReadString();
+        }
+        else if (memberName == "Count")
+        {
+            count = reader.ReadInteger();
+        }
+        else if (memberName == "Size")
+        {
+            size = reader.ReadInt64();
+        }
+        else if (memberName == "Ratio")
+        {
+            ratio = reader.ReadDouble();
+        }
+        else if (memberName == "Active")
+        {
+            active = reader.ReadBool();
+        }
+        else if (memberName == "Items")
+        {
+            ASSERT_TRUE(reader.BeginArray());
+            while (reader.NextElement())
+            {
+                Aws::String itemMemberName;
+                ASSERT_TRUE(reader.BeginObject());
+                while (reader.NextMember(itemMemberName))
+                {
+                    if (itemMemberName == "Id")
+                    {
+                        ids.push_back(reader.ReadString());
+                    }
+                    else
+                    {
+                        reader.SkipValue();
+                    }
+                }
+            }
+        }
+        else if (memberName == "Tags")
+        {
+            Aws::String tagKey;
+            ASSERT_TRUE(reader.BeginObject());
+            while (reader.NextMember(tagKey))
+            {
+                tags[tagKey] = reader.ReadString();
+            }
+        }
+        else if (memberName == "Empty")
+        {
+            ASSERT_TRUE(reader.BeginArray());
+            ASSERT_FALSE(reader.NextElement());
+        }
+        else
+        {
+            reader.SkipValue();
+        }
+    }
+
+    ASSERT_TRUE(reader.WasParseSuccessful());
+    Aws::Vector<Aws::String> expectedMembers = { "Name", "Count", "Size", "Ratio", "Active", "Skipped", "Items", "Tags", "Empty" };
+    ASSERT_EQ(expectedMembers, members);
+    ASSERT_EQ("table", name);
+    ASSERT_EQ(3, count);
+    ASSERT_EQ(12345678901234LL, size);
+    ASSERT_DOUBLE_EQ(0.25, ratio);
+    ASSERT_TRUE(active);
+    ASSERT_EQ(2u, ids.size());
+    ASSERT_EQ("1", ids[0]);
+    ASSERT_EQ("2", ids[1]);
+    ASSERT_EQ(2u, tags.size());
+    ASSERT_EQ("v2", tags["k2"]);
+}
+
+TEST(JsonReaderTest, DecodesEscapes)
+{
+    Aws::StringStream ss("[\"quote\\\" slash\\/ back\\\\ \\b\\f\\n\\r\\t\", \"\\u00e9\\u20AC\\ud83d\\ude00\"]");
+    JsonReader reader(ss);
+
+    ASSERT_TRUE(reader.BeginArray());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ("quote\" slash/ back\\ \b\f\n\r\t", reader.ReadString());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ("\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80", reader.ReadString());
+    ASSERT_FALSE(reader.NextElement());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(JsonReaderTest, ReadsValuesAcrossBufferBoundaries)
+{
+    //values of every kind end up split between two reads of the stream.
+    Aws::String document = "[";
+    Aws::Vector<Aws::String> expected;
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        Aws::String value(i % 37, static_cast<char>('a' + i % 26));
+        value += "\\n" + StringUtils::to_string(i);
+        expected.push_back(Aws::String(i % 37, static_cast<char>('a' + i % 26)) + "\n" + StringUtils::to_string(i));
+        document += (i ? "," : "") + Aws::String("{\"v\":\"") + value + "\",\"n\":" + StringUtils::to_string(i) + ",\"b\":true}";
+    }
+    document += "]";
+    ASSERT_GT(document.size(), 4 * JsonReader::BUFFER_SIZE);
+
+    Aws::StringStream ss(document);
+    JsonReader reader(ss);
+    size_t index = 0;
+    ASSERT_TRUE(reader.BeginArray());
+    while (reader.NextElement())
+    {
+        Aws::String memberName;
+        ASSERT_TRUE(reader.BeginObject());
+        while (reader.NextMember(memberName))
+        {
+            if (memberName == "v")
+            {
+                ASSERT_EQ(expected[index], reader.ReadString());
+            }
+            else if (memberName == "n")
+            {
+                ASSERT_EQ(static_cast<long long>(index), reader.ReadInt64());
+            }
+            else
+            {
+                ASSERT_TRUE(reader.ReadBool());
+            }
+        }
+        ++index;
+    }
+    ASSERT_TRUE(reader.WasParseSuccessful());
+    ASSERT_EQ(2000u, index);
+}
+
+TEST(JsonReaderTest, WrongTypesReadAsDefaults)
+{
+    Aws::StringStream ss("{\"a\": {\"x\": [1, 2]}, \"b\": \"text\", \"c\": [true], \"d\": 7, \"e\": 1.9}");
+    JsonReader reader(ss);
+
+    Aws::String memberName;
+    ASSERT_TRUE(reader.BeginObject());
+    ASSERT_TRUE(reader.NextMember(memberName));
+    ASSERT_EQ("", reader.ReadString());
+    ASSERT_TRUE(reader.NextMember(memberName));
+    ASSERT_EQ(0, reader.ReadInteger());
+    ASSERT_TRUE(reader.NextMember(memberName));
+    ASSERT_FALSE(reader.BeginObject());
+    ASSERT_TRUE(reader.NextMember(memberName));
+    ASSERT_FALSE(reader.BeginArray());
+    ASSERT_TRUE(reader.NextMember(memberName));
+    ASSERT_EQ(1, reader.ReadInteger());
+    ASSERT_FALSE(reader.NextMember(memberName));
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(JsonReaderTest, EmptyDocumentIsNotAnError)
+{
+    Aws::StringStream ss("  ");
+    JsonReader reader(ss);
+    ASSERT_FALSE(reader.BeginObject());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(JsonReaderTest, StopsAtSyntaxErrors)
+{
+    const char* documents[] = { "{\"a\": 1 \"b\": 2}", "{\"a\": [1, 2}", "{\"a\": \"unterminated", "{\"a\": tru}", "{\"a\": \"\\x\"}", "{\"a\": 1" };
+    for (const char* document : documents)
+    {
+        Aws::StringStream ss(document);
+        JsonReader reader(ss);
+
+        Aws::String memberName;
+        size_t members = 0;
+        ASSERT_TRUE(reader.BeginObject());
+        while (reader.NextMember(memberName) && members < 10)
+        {
+            reader.ReadString();
+            ++members;
+        }
+        ASSERT_FALSE(reader.WasParseSuccessful()) << document;
+        ASSERT_FALSE(reader.GetErrorMessage().empty());
+        ASSERT_FALSE(reader.BeginObject());
+        ASSERT_EQ("", reader.ReadString());
+    }
+}
+
+//a DynamoDB Query page: a list of items, each a map of attribute name to {"S": ...} or {"N": ...}.
+static Aws::String BuildQueryPage(size_t itemCount)
+{
+    Aws::String page = "{\"Count\":" + StringUtils::to_string(itemCount) + ",\"Items\":[";
+    for (size_t i = 0; i < itemCount; ++i)
+    {
+        page += i ? "," : "";
+        page += "{\"pk\":{\"S\":\"customer#" + StringUtils::to_string(i) + "\"},\"sk\":{\"S\":\"order#" + StringUtils::to_string(i * 7) + "\"},"
+            "\"total\":{\"N\":\"" + StringUtils::to_string(i * 13) + ".99\"},\"status\":{\"S\":\"SHIPPED\"},"
+            "\"note\":{\"S\":\"Leave the package at the side door, next to the blue recycling bin\"}}";
+    }
+    page += "],\"ScannedCount\":" + StringUtils::to_string(itemCount) + "}";
+    return page;
+}
+
+typedef Aws::Vector<Aws::Map<Aws::String, Aws::String>> Items;
+
+static Items ReadItemsWithDom(Aws::IStream& stream)
+{
+    Items items;
+    JsonValue value(stream);
+    JsonView view = value.View();
+    if (view.ValueExists("Items"))
+    {
+        Array<JsonView> itemsJsonList = view.GetArray("Items");
+        for (unsigned itemsIndex = 0; itemsIndex < itemsJsonList.GetLength(); ++itemsIndex)
+        {
+            Aws::Map<Aws::String, JsonView> attributeMapJsonMap = itemsJsonList[itemsIndex].GetAllObjects();
+            Aws::Map<Aws::String, Aws::String> attributeMap;
+            for (auto& attributeMapItem : attributeMapJsonMap)
+            {
+                attributeMap[attributeMapItem.first] = attributeMapItem.second.ValueExists("S") ?
+                    attributeMapItem.second.GetString("S") : attributeMapItem.second.GetString("N");
+            }
+            items.push_back(std::move(attributeMap));
+        }
+    }
+    return items;
+}
+
+static Items ReadItemsWithReader(Aws::IStream& stream)
+{
+    Items items;
+    JsonReader reader(stream);
+    Aws::String memberName;
+    if (reader.BeginObject())
+    {
+        while (reader.NextMember(memberName))
+        {
+            if (memberName == "Items" && reader.BeginArray())
+            {
+                while (reader.NextElement())
+                {
+                    Aws::Map<Aws::String, Aws::String> attributeMap;
+                    Aws::String attributeName;
+                    if (reader.BeginObject())
+                    {
+                        while (reader.NextMember(attributeName))
+                        {
+                            Aws::String typeName;
+                            Aws::String& attribute = attributeMap[attributeName];
+                            if (reader.BeginObject())
+                            {
+                                while (reader.NextMember(typeName))
+                                {
+                                    attribute = reader.ReadString();
+                                }
+                            }
+                        }
+                    }
+                    items.push_back(std::move(attributeMap));
+                }
+            }
+            else
+            {
+                reader.SkipValue();
+            }
+        }
+    }
+    return items;
+}
+
+TEST(JsonReaderTest, ReaderMatchesDomOnLargeQueryPage)
+{
+    //about 1MB, the largest page DynamoDB returns.
+    const Aws::String page = BuildQueryPage(4500);
+
+    Aws::StringStream domStream(page);
+    Aws::StringStream readerStream(page);
+    Items domItems = ReadItemsWithDom(domStream);
+    ASSERT_EQ(4500u, domItems.size());
+    ASSERT_TRUE(domItems == ReadItemsWithReader(readerStream));
+}
@@ -384,3 +384,52 @@ TEST(JsonSerializer, TestEquality)
     built.WithString("AWS", "Amazon Web Services");
     ASSERT_NE(parsed, built);
 }
+
+TEST(JsonSerializer, TestMemberIteration)
+{
+    auto input = R"({"Key1" : "value1", "Key2" : 42, "Key3" : null, "Key4" : {"Inner" : true}})";
+
+    JsonValue doc(input);
+    auto docView = doc.View();
+    ASSERT_EQ(nullptr, docView.GetMemberName());
+
+    auto member = docView.GetFirstMember();
+    ASSERT_TRUE(member.IsValid());
+    ASSERT_STREQ("Key1", member.GetMemberName());
+    ASSERT_STREQ("value1", member.AsString().c_str());
+
+    member = member.GetNextMember();
+    ASSERT_TRUE(member.IsValid());
+    ASSERT_STREQ("Key2", member.GetMemberName());
+    ASSERT_EQ(42, member.AsInteger());
+
+    member = member.GetNextMember();
+    ASSERT_TRUE(member.IsValid());
+    ASSERT_STREQ("Key3", member.GetMemberName());
+    ASSERT_TRUE(member.IsNull());
+
+    member = member.GetNextMember();
+    ASSERT_TRUE(member.IsValid());
+    ASSERT_STREQ("Key4", member.GetMemberName());
+    ASSERT_STREQ("Inner", member.AsObject().GetFirstMember().GetMemberName());
+    ASSERT_TRUE(member.AsObject().GetFirstMember().AsBool());
+
+    member = member.GetNextMember();
+    ASSERT_FALSE(member.IsValid());
+    ASSERT_FALSE(member.GetNextMember().IsValid());
+    ASSERT_EQ(nullptr, member.GetMemberName());
+}
+
+TEST(JsonSerializer, TestMemberIterationOfEmptyAndNonObjects)
+{
+    JsonValue empty("{}");
+    ASSERT_TRUE(empty.View().IsValid());
+    ASSERT_FALSE(empty.View().GetFirstMember().IsValid());
+
+    JsonValue array("[1, 2]");
+    ASSERT_FALSE(array.View().GetFirstMember().IsValid());
+
+    JsonValue string;
+    string.AsString("value");
+    ASSERT_FALSE(string.View().GetFirstMember().IsValid());
+}
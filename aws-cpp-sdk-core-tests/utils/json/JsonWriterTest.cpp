@@ -0,0 +1,207 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/json/JsonWriter.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <limits>
+
+using namespace Aws::Utils::Json;
+using namespace Aws::Utils;
+
+TEST(JsonWriterTest, MatchesDomOutput)
+{
+    JsonValue item;
+    item.WithString("S", "value");
+    Array<JsonValue> list(2);
+    list[0].AsInteger(-42);
+    list[1].AsBool(false);
+    JsonValue dom;
+    dom.WithString("TableName", "orders")
+        .WithInteger("Limit", 25)
+        .WithDouble("Ratio", 0.1)
+        .WithDouble("Whole", 3.0)
+        .WithBool("ConsistentRead", true)
+        .WithObject("Item", std::move(item))
+        .WithArray("List", std::move(list))
+        .WithObject("Empty", JsonValue())
+        .WithArray("EmptyList", Array<JsonValue>(0));
+
+    Aws::String payload;
+    JsonWriter writer(payload);
+    writer.StartObject();
+    writer.WriteKey("TableName");
+    writer.WriteString("orders");
+    writer.WriteKey("Limit");
+    writer.WriteInteger(25);
+    writer.WriteKey("Ratio");
+    writer.WriteDouble(0.1);
+    writer.WriteKey("Whole");
+    writer.WriteDouble(3.0);
+    writer.WriteKey(Aws::String("ConsistentRead"));
+    writer.WriteBool(true);
+    writer.WriteKey("Item");
+    writer.StartObject();
+    writer.WriteKey("S");
+    writer.WriteString(Aws::String("value"));
+    writer.EndObject();
+    writer.WriteKey("List");
+    writer.StartArray();
+    writer.WriteInteger(-42);
+    writer.WriteBool(false);
+    writer.EndArray();
+    writer.WriteKey("Empty");
+    writer.StartObject();
+    writer.EndObject();
+    writer.WriteKey("EmptyList");
+    writer.StartArray();
+    writer.EndArray();
+    writer.EndObject();
+
+    ASSERT_EQ(dom.View().WriteCompact(), payload);
+    ASSERT_EQ(&payload, &writer.GetBuffer());
+}
+
+TEST(JsonWriterTest, EscapesStrings)
+{
+    Aws::String value("quote\" back\\ \b\f\n\r\t \x01\x1f slash/ \xc3\xa9");
+    JsonValue dom;
+    dom.WithString(value, value);
+
+    Aws::String payload;
+    JsonWriter writer(payload);
+    writer.StartObject();
+    writer.WriteKey(value);
+    writer.WriteString(value);
+    writer.EndObject();
+
+    ASSERT_EQ(dom.View().WriteCompact(), payload);
+    ASSERT_EQ(value, JsonValue(payload).View().GetString(value));
+}
+
+TEST(JsonWriterTest, WritesNumbersExactly)
+{
+    Aws::String payload;
+    JsonWriter writer(payload);
+    writer.StartArray();
+    writer.WriteInt64(std::numeric_limits<long long>::max());
+    writer.WriteInt64(std::numeric_limits<long long>::min());
+    writer.WriteInteger(0);
+    writer.WriteDouble(1.0 / 3.0);
+    writer.WriteDouble(1e300);
+    writer.WriteDouble(std::numeric_limits<double>::quiet_NaN());
+    writer.WriteDouble(std::numeric_limits<double>::infinity());
+    writer.WriteNull();
+    writer.EndArray();
+
+    ASSERT_EQ("[9223372036854775807,-9223372036854775808,0,0.33333333333333331,1e+300,null,null,null]", payload);
+}
+
+TEST(JsonWriterTest, WritesBase64AndRawValues)
+{
+    Aws::String payload;
+    JsonWriter writer(payload);
+    writer.StartObject();
+    writer.WriteKey("B");
+    writer.WriteBase64(ByteBuffer(reinterpret_cast<const unsigned char*>("hello"), 5));
+    writer.WriteKey("Raw");
+    writer.WriteRaw("{\"a\":[1]}");
+    writer.EndObject();
+
+    ASSERT_EQ("{\"B\":\"aGVsbG8=\",\"Raw\":{\"a\":[1]}}", payload);
+}
+
+TEST(JsonWriterTest, ReusesBufferCapacity)
+{
+    Aws::String payload;
+    payload.reserve(1024);
+    const auto* data = payload.data();
+    for (int i = 0; i < 3; ++i)
+    {
+        payload.clear();
+        JsonWriter writer(payload);
+        writer.StartObject();
+        writer.WriteKey("Iteration");
+        writer.WriteInteger(i);
+        writer.EndObject();
+        ASSERT_EQ("{\"Iteration\":" + StringUtils::to_string(i) + "}", payload);
+        ASSERT_EQ(data, payload.data());
+    }
+}
+
+//a DynamoDB BatchWriteItem body: one table, a list of put requests, each item a map of attribute name to {"S": ...} or {"N": ...}.
+static const size_t ITEM_COUNT = 4000;
+
+static Aws::String WriteBatchWithDom()
+{
+    Array<JsonValue> requests(ITEM_COUNT);
+    for (size_t i = 0; i < ITEM_COUNT; ++i)
+    {
+        JsonValue item;
+        item.WithObject("pk", JsonValue().WithString("S", "customer#" + StringUtils::to_string(i)))
+            .WithObject("total", JsonValue().WithString("N", StringUtils::to_string(i * 13) + ".99"))
+            .WithObject("note", JsonValue().WithString("S", "Leave the package at the side door, next to the blue recycling bin"));
+        requests[i].AsObject(JsonValue().WithObject("PutRequest", JsonValue().WithObject("Item", std::move(item))));
+    }
+    JsonValue payload;
+    payload.WithObject("RequestItems", JsonValue().WithArray("orders", std::move(requests)));
+    return payload.View().WriteCompact();
+}
+
+static void WriteAttribute(JsonWriter& writer, const char* name, const char* type, const Aws::String& value)
+{
+    writer.WriteKey(name);
+    writer.StartObject();
+    writer.WriteKey(type);
+    writer.WriteString(value);
+    writer.EndObject();
+}
+
+static Aws::String WriteBatchWithWriter()
+{
+    Aws::String payload;
+    JsonWriter writer(payload);
+    writer.StartObject();
+    writer.WriteKey("RequestItems");
+    writer.StartObject();
+    writer.WriteKey("orders");
+    writer.StartArray();
+    for (size_t i = 0; i < ITEM_COUNT; ++i)
+    {
+        writer.StartObject();
+        writer.WriteKey("PutRequest");
+        writer.StartObject();
+        writer.WriteKey("Item");
+        writer.StartObject();
+        WriteAttribute(writer, "pk", "S", "customer#" + StringUtils::to_string(i));
+        WriteAttribute(writer, "total", "N", StringUtils::to_string(i * 13) + ".99");
+        WriteAttribute(writer, "note", "S", "Leave the package at the side door, next to the blue recycling bin");
+        writer.EndObject();
+        writer.EndObject();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    writer.EndObject();
+    return payload;
+}
+
+TEST(JsonWriterTest, WriterMatchesDomOnLargeBatch)
+{
+    ASSERT_EQ(WriteBatchWithDom(), WriteBatchWithWriter());
+}
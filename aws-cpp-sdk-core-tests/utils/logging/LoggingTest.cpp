@@ -19,6 +19,7 @@
 
 #include <aws/core/utils/logging/DefaultLogSystem.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/logging/RingBufferLogSystem.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -99,12 +100,13 @@ void VerifyAllLogsAtOrBelow(LogLevel logLevel, const Aws::String& tag, const Aws
     }
 }
 
+template<typename LogSystemType = DefaultLogSystem>
 void DoLogTest(LogLevel logLevel, const char *testTag)
 {
     auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
 
     {
-        ScopedLogger loggingScope(Aws::MakeShared<DefaultLogSystem>(AllocationTag, logLevel, ss));
+        ScopedLogger loggingScope(Aws::MakeShared<LogSystemType>(AllocationTag, logLevel, ss));
 
         LogAllPossibilities(testTag);
     }
@@ -142,3 +144,169 @@ TEST(LoggingTest, testTraceLogLevel)
 {
     DoLogTest(LogLevel::Trace, "LoggingTest_testTraceLogLevel");    
 }
+
+TEST(LoggingTest, testRingBufferLogSystemLogLevels)
+{
+    DoLogTest<RingBufferLogSystem>(LogLevel::Fatal, "LoggingTest_testRingBufferFatalLogLevel");
+    DoLogTest<RingBufferLogSystem>(LogLevel::Warn, "LoggingTest_testRingBufferWarnLogLevel");
+    DoLogTest<RingBufferLogSystem>(LogLevel::Trace, "LoggingTest_testRingBufferTraceLogLevel");
+}
+
+TEST(LoggingTest, testRingBufferLogSystemMatchesDefaultFormat)
+{
+    auto defaultStream = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    auto ringStream = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        DefaultLogSystem defaultLogSystem(LogLevel::Info, defaultStream);
+        RingBufferLogSystem ringLogSystem(LogLevel::Info, ringStream);
+        defaultLogSystem.Log(LogLevel::Info, "FormatTag", "value %d of %s", 42, "answer");
+        ringLogSystem.Log(LogLevel::Info, "FormatTag", "value %d of %s", 42, "answer");
+    }
+
+    Aws::String defaultLine = defaultStream->str();
+    Aws::String ringLine = ringStream->str();
+    //"[INFO] " then "yyyy-mm-dd hh:mm:ss.mmm", only the time of day may differ.
+    static const size_t TIME_START = 18;
+    static const size_t TIME_END = 30;
+    ASSERT_EQ(defaultLine.size(), ringLine.size());
+    ASSERT_EQ(defaultLine.substr(0, TIME_START), ringLine.substr(0, TIME_START));
+    ASSERT_EQ('.', ringLine[TIME_END - 4]);
+    ASSERT_EQ(defaultLine.substr(TIME_END), ringLine.substr(TIME_END));
+    ASSERT_TRUE(ringLine.find("FormatTag") != Aws::String::npos);
+    ASSERT_TRUE(ringLine.find("] value 42 of answer\n") != Aws::String::npos);
+}
+
+TEST(LoggingTest, testRingBufferLogSystemKeepsStatementsInThreadOrder)
+{
+    static const int THREAD_COUNT = 8;
+    static const int STATEMENTS_PER_THREAD = 2000;
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    //few small rings, so producers share rings, wrap and find them full.
+    auto logSystem = Aws::MakeShared<RingBufferLogSystem>(AllocationTag, LogLevel::Debug, ss, 3, 4096);
+
+    {
+        ScopedLogger loggingScope(logSystem);
+
+        Aws::Vector<std::thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t)
+        {
+            threads.emplace_back([t] {
+                for (int i = 0; i < STATEMENTS_PER_THREAD; ++i)
+                {
+                    AWS_LOGSTREAM_DEBUG("RingTest", "producer " << t << " statement " << i << " end");
+                    AWS_LOG_TRACE("RingTest", "filtered %d", i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        AWS_LOGSTREAM_FLUSH();
+    }
+
+    //statements that found their ring full are dropped and counted, the rest come out whole and in order.
+    Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(ss->str());
+    ASSERT_EQ(static_cast<uint64_t>(THREAD_COUNT * STATEMENTS_PER_THREAD), loggedStatements.size() + logSystem->GetDroppedStatementCount());
+
+    Aws::Vector<int> nextStatement(THREAD_COUNT, 0);
+    for (const auto& statement : loggedStatements)
+    {
+        ASSERT_EQ(0u, statement.find("[DEBUG] "));
+        size_t producerPos = statement.find("producer ");
+        ASSERT_NE(Aws::String::npos, producerPos);
+        int producer = 0;
+        int index = 0;
+        ASSERT_EQ(2, sscanf(statement.c_str() + producerPos, "producer %d statement %d end", &producer, &index));
+        ASSERT_LE(nextStatement[producer], index);
+        nextStatement[producer] = index + 1;
+    }
+}
+
+TEST(LoggingTest, testRingBufferLogSystemDropsStatementsWhenFull)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    RingBufferLogSystem logSystem(LogLevel::Info, ss, 1, 4096);
+    //more than the ring holds, logged faster than the drainer wakes up.
+    static const int STATEMENT_COUNT = 200;
+    for (int i = 0; i < STATEMENT_COUNT; ++i)
+    {
+        logSystem.Log(LogLevel::Info, "FullTag", "%s", Aws::String(1000, 'z').c_str());
+    }
+    logSystem.Flush();
+
+    Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(ss->str());
+    ASSERT_LT(0u, logSystem.GetDroppedStatementCount());
+    ASSERT_EQ(static_cast<uint64_t>(STATEMENT_COUNT), loggedStatements.size() + logSystem.GetDroppedStatementCount());
+
+    logSystem.Log(LogLevel::Info, "FullTag", "after");
+    logSystem.Flush();
+    ASSERT_NE(Aws::String::npos, ss->str().find("] after"));
+}
+
+TEST(LoggingTest, testRingBufferLogSystemTruncatesOversizedStatements)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        RingBufferLogSystem logSystem(LogLevel::Info, ss, 1, 4096);
+        Aws::OStringStream message;
+        message << Aws::String(10000, 'x');
+        logSystem.LogStream(LogLevel::Info, "BigTag", message);
+        logSystem.Log(LogLevel::Info, "BigTag", "%s", Aws::String(10000, 'y').c_str());
+        logSystem.Log(LogLevel::Info, "BigTag", "after");
+        logSystem.Flush();
+
+        Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(ss->str());
+        ASSERT_EQ(3u, loggedStatements.size());
+        ASSERT_LT(loggedStatements[0].size(), 4096u);
+        ASSERT_EQ(Aws::String::npos, loggedStatements[0].find('y'));
+        ASSERT_LT(loggedStatements[1].size(), 4096u);
+        ASSERT_NE(Aws::String::npos, loggedStatements[1].find("yyy"));
+        ASSERT_NE(Aws::String::npos, loggedStatements[2].find("] after"));
+    }
+}
+
+TEST(LoggingTest, testCachedLogLevelFollowsLogSystem)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    auto logSystem = Aws::MakeShared<DefaultLogSystem>(AllocationTag, LogLevel::Warn, ss);
+    LogLevel previousLevel = CachedLogLevel.load();
+    {
+        ScopedLogger loggingScope(logSystem);
+        ASSERT_EQ(LogLevel::Warn, CachedLogLevel.load());
+        AWS_LOGSTREAM_INFO("CachedLevelTest", "filtered statement");
+
+        logSystem->SetLogLevel(LogLevel::Info);
+        ASSERT_EQ(LogLevel::Info, CachedLogLevel.load());
+        AWS_LOGSTREAM_INFO("CachedLevelTest", "enabled statement");
+        AWS_LOGSTREAM_FLUSH();
+    }
+    ASSERT_EQ(previousLevel, CachedLogLevel.load());
+
+    //the log system writes on its own thread until it's destroyed.
+    logSystem = nullptr;
+    Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(ss->str());
+    ASSERT_EQ(1u, loggedStatements.size());
+    ASSERT_NE(Aws::String::npos, loggedStatements[0].find("enabled statement"));
+}
+
+TEST(LoggingTest, testFilteredStatementIsNotEvaluated)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    auto logSystem = Aws::MakeShared<DefaultLogSystem>(AllocationTag, LogLevel::Warn, ss);
+    int evaluated = 0;
+    {
+        ScopedLogger loggingScope(logSystem);
+        //the cached level check must skip the stream expression, not just the write.
+        AWS_LOGSTREAM_TRACE("FilteredTest", "trace " << ++evaluated);
+        AWS_LOGSTREAM_DEBUG("FilteredTest", "debug " << ++evaluated);
+        AWS_LOGSTREAM_WARN("FilteredTest", "warn " << ++evaluated);
+        AWS_LOGSTREAM_FLUSH();
+    }
+    ASSERT_EQ(1, evaluated);
+
+    logSystem = nullptr;
+    Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(ss->str());
+    ASSERT_EQ(1u, loggedStatements.size());
+    ASSERT_NE(Aws::String::npos, loggedStatements[0].find("warn 1"));
+}
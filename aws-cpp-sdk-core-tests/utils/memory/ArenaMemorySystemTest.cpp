@@ -0,0 +1,277 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace Aws::Utils::Memory;
+
+static const char ALLOCATION_TAG[] = "ArenaMemorySystemTest";
+
+static bool IsAligned(void* memory)
+{
+    return reinterpret_cast<uintptr_t>(memory) % 16 == 0;
+}
+
+TEST(ArenaMemorySystemTest, AllocatesFromUnderlyingOutsideOfScopes)
+{
+    BaseTestMemorySystem underlying;
+    ArenaMemorySystem memorySystem(&underlying);
+
+    void* memory = memorySystem.AllocateMemory(100, 1, ALLOCATION_TAG);
+    ASSERT_TRUE(IsAligned(memory));
+    memset(memory, 0xab, 100);
+    ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+    ASSERT_EQ(1u, underlying.GetCurrentOutstandingAllocations());
+
+    memorySystem.FreeMemory(memory);
+    memorySystem.FreeMemory(nullptr);
+    ASSERT_EQ(0u, underlying.GetCurrentOutstandingAllocations());
+}
+
+TEST(ArenaMemorySystemTest, ScopeAllocationsShareOneArena)
+{
+    BaseTestMemorySystem underlying;
+    ArenaMemorySystem memorySystem(&underlying);
+    std::vector<void*> allocations;
+
+    {
+        ArenaScope scope;
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            size_t size = 1 + i % 90;
+            void* memory = memorySystem.AllocateMemory(size, 1, ALLOCATION_TAG);
+            ASSERT_TRUE(IsAligned(memory));
+            memset(memory, static_cast<int>(i), size);
+            allocations.push_back(memory);
+        }
+
+        //a value bigger than any block still fits.
+        void* large = memorySystem.AllocateMemory(3 * 1024 * 1024, 1, ALLOCATION_TAG);
+        memset(large, 0, 3 * 1024 * 1024);
+        allocations.push_back(large);
+        ASSERT_EQ(1u, memorySystem.GetLiveArenaCount());
+    }
+
+    //blocks double from 4KB, so ~1MB of values takes a handful of underlying allocations.
+    ASSERT_GT(12u, underlying.GetTotalAllocationCount());
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        ASSERT_EQ(static_cast<unsigned char>(i), *static_cast<unsigned char*>(allocations[i]));
+    }
+
+    //the arena stays until its last allocation is freed.
+    for (void* memory : allocations)
+    {
+        ASSERT_EQ(1u, memorySystem.GetLiveArenaCount());
+        memorySystem.FreeMemory(memory);
+    }
+    ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+    ASSERT_EQ(0u, underlying.GetCurrentOutstandingAllocations());
+}
+
+TEST(ArenaMemorySystemTest, ArenaGoesWithScopeWhenEverythingIsFreed)
+{
+    BaseTestMemorySystem underlying;
+    ArenaMemorySystem memorySystem(&underlying);
+
+    {
+        ArenaScope scope;
+        memorySystem.FreeMemory(memorySystem.AllocateMemory(10, 1, ALLOCATION_TAG));
+        ASSERT_EQ(1u, memorySystem.GetLiveArenaCount());
+    }
+    ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+    ASSERT_EQ(0u, underlying.GetCurrentOutstandingAllocations());
+
+    //a scope that allocates nothing creates no arena.
+    auto allocationCount = underlying.GetTotalAllocationCount();
+    {
+        ArenaScope scope;
+    }
+    ASSERT_EQ(allocationCount, underlying.GetTotalAllocationCount());
+    ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+}
+
+TEST(ArenaMemorySystemTest, NestedScopesShareTheOuterArena)
+{
+    ArenaMemorySystem memorySystem;
+    void* outer = nullptr;
+    void* inner = nullptr;
+
+    {
+        ArenaScope scope;
+        outer = memorySystem.AllocateMemory(16, 1, ALLOCATION_TAG);
+        {
+            ArenaScope nested;
+            inner = memorySystem.AllocateMemory(16, 1, ALLOCATION_TAG);
+        }
+        ASSERT_EQ(1u, memorySystem.GetLiveArenaCount());
+        ASSERT_EQ(static_cast<char*>(outer) + 32, static_cast<char*>(inner));
+    }
+
+    void* heap = memorySystem.AllocateMemory(16, 1, ALLOCATION_TAG);
+    memorySystem.FreeMemory(inner);
+    memorySystem.FreeMemory(outer);
+    ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+    memorySystem.FreeMemory(heap);
+}
+
+TEST(ArenaMemorySystemTest, AllocationsHonorTheRequestedAlignment)
+{
+    BaseTestMemorySystem underlying;
+    ArenaMemorySystem memorySystem(&underlying);
+    std::vector<void*> allocations;
+
+    for (size_t alignment : { 32u, 64u, 256u })
+    {
+        void* memory = memorySystem.AllocateMemory(40, alignment, ALLOCATION_TAG);
+        ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(memory) % alignment);
+        memset(memory, 0xcd, 40);
+        allocations.push_back(memory);
+    }
+
+    {
+        ArenaScope scope;
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            size_t alignment = size_t(1) << (i % 9);
+            size_t size = 1 + i % 70;
+            void* memory = memorySystem.AllocateMemory(size, alignment, ALLOCATION_TAG);
+            ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(memory) % (std::max)(alignment, alignof(std::max_align_t)));
+            memset(memory, static_cast<int>(i), size);
+            allocations.push_back(memory);
+        }
+        ASSERT_EQ(1u, memorySystem.GetLiveArenaCount());
+    }
+
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        ASSERT_EQ(static_cast<unsigned char>(i), *static_cast<unsigned char*>(allocations[i + 3]));
+    }
+    for (void* memory : allocations)
+    {
+        memorySystem.FreeMemory(memory);
+    }
+    ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+    ASSERT_EQ(0u, underlying.GetCurrentOutstandingAllocations());
+}
+
+TEST(ArenaMemorySystemTest, SuspendedScopeDoesNotPinTheArena)
+{
+    ArenaMemorySystem memorySystem;
+    void* longLived = nullptr;
+    void* ownArena = nullptr;
+
+    {
+        ArenaScope scope;
+        void* decoded = memorySystem.AllocateMemory(16, 1, ALLOCATION_TAG);
+        {
+            SuspendArenaScope suspend;
+            longLived = memorySystem.AllocateMemory(16, 1, ALLOCATION_TAG);
+            {
+                ArenaScope inner;
+                ownArena = memorySystem.AllocateMemory(16, 1, ALLOCATION_TAG);
+                ASSERT_EQ(2u, memorySystem.GetLiveArenaCount());
+            }
+        }
+        //the outer scope is back in effect.
+        void* next = memorySystem.AllocateMemory(16, 1, ALLOCATION_TAG);
+        ASSERT_EQ(static_cast<char*>(decoded) + 32, static_cast<char*>(next));
+        memorySystem.FreeMemory(next);
+        memorySystem.FreeMemory(decoded);
+    }
+
+    memorySystem.FreeMemory(ownArena);
+    ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+    memorySystem.FreeMemory(longLived);
+}
+
+TEST(ArenaMemorySystemTest, AllocationsCanBeFreedOnOtherThreads)
+{
+    ArenaMemorySystem memorySystem;
+    std::vector<void*> allocations;
+    {
+        ArenaScope scope;
+        for (size_t i = 0; i < 4000; ++i)
+        {
+            allocations.push_back(memorySystem.AllocateMemory(24, 1, ALLOCATION_TAG));
+        }
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&memorySystem, &allocations, t]()
+        {
+            for (size_t i = t; i < allocations.size(); i += 4)
+            {
+                memorySystem.FreeMemory(allocations[i]);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+}
+
+//the allocation pattern of decoding a 1000 item DynamoDB Query page: per item a map node, a key string and an attribute value
+//with its string payload, for a dozen attributes.
+static void DecodeAndFreePage(MemorySystemInterface& memorySystem, std::vector<void*>& allocations)
+{
+    for (size_t item = 0; item < 1000; ++item)
+    {
+        for (size_t attribute = 0; attribute < 12; ++attribute)
+        {
+            allocations.push_back(memorySystem.AllocateMemory(64, 1, ALLOCATION_TAG));
+            allocations.push_back(memorySystem.AllocateMemory(24, 1, ALLOCATION_TAG));
+            allocations.push_back(memorySystem.AllocateMemory(48, 1, ALLOCATION_TAG));
+            allocations.push_back(memorySystem.AllocateMemory(40, 1, ALLOCATION_TAG));
+        }
+    }
+
+    for (void* memory : allocations)
+    {
+        memorySystem.FreeMemory(memory);
+    }
+    allocations.clear();
+}
+
+TEST(ArenaMemorySystemTest, EveryPageReleasesItsArena)
+{
+    ArenaMemorySystem memorySystem;
+    std::vector<void*> allocations;
+    allocations.reserve(1000 * 12 * 4);
+
+    DecodeAndFreePage(memorySystem, allocations);
+    ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+    for (int i = 0; i < 3; ++i)
+    {
+        {
+            ArenaScope scope;
+            DecodeAndFreePage(memorySystem, allocations);
+        }
+        ASSERT_EQ(0u, memorySystem.GetLiveArenaCount());
+    }
+}
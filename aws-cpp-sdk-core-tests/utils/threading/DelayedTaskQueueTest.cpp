@@ -0,0 +1,124 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/DelayedTaskQueue.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+using namespace Aws::Utils::Threading;
+
+TEST(DelayedTaskQueue, RunsTasksInDeadlineOrder)
+{
+    std::mutex orderLock;
+    Aws::Vector<int> order;
+    Semaphore done(0, 1);
+    DelayedTaskQueue queue;
+
+    auto record = [&](int id) { std::lock_guard<std::mutex> locker(orderLock); order.push_back(id); };
+    ASSERT_TRUE(queue.Schedule(std::chrono::milliseconds(60), [&] { record(3); done.Release(); }));
+    ASSERT_TRUE(queue.Schedule(std::chrono::milliseconds(20), [&] { record(1); }));
+    ASSERT_TRUE(queue.Schedule(std::chrono::milliseconds(40), [&] { record(2); }));
+
+    done.WaitOne();
+    std::lock_guard<std::mutex> locker(orderLock);
+    ASSERT_EQ(3u, order.size());
+    ASSERT_EQ(1, order[0]);
+    ASSERT_EQ(2, order[1]);
+    ASSERT_EQ(3, order[2]);
+}
+
+TEST(DelayedTaskQueue, StopRunsPendingTasks)
+{
+    std::atomic<int> ran(0);
+    bool ranEarly = false;
+    DelayedTaskQueue queue;
+    ASSERT_TRUE(queue.Schedule(std::chrono::hours(1), [&] { ran++; ranEarly = queue.IsStopped(); }));
+    ASSERT_EQ(1u, queue.GetPendingTaskCount());
+
+    queue.Stop();
+    ASSERT_EQ(0u, queue.GetPendingTaskCount());
+    ASSERT_EQ(1, ran.load());
+    ASSERT_TRUE(ranEarly);
+    ASSERT_FALSE(queue.Schedule(std::chrono::milliseconds(0), [&] { ran++; }));
+    ASSERT_EQ(1, ran.load());
+}
+
+TEST(DelayedTaskQueue, TaskCanStopItsOwnQueue)
+{
+    std::atomic<int> ran(0);
+    bool ranEarly = false;
+    Semaphore stopped(0, 1);
+    auto queue = Aws::MakeUnique<DelayedTaskQueue>("DelayedTaskQueueTest");
+    auto queuePtr = queue.get();
+    ASSERT_TRUE(queue->Schedule(std::chrono::hours(1), [&] { ran++; ranEarly = queuePtr->IsStopped(); }));
+    ASSERT_TRUE(queue->Schedule(std::chrono::milliseconds(0), [&]
+    {
+        queuePtr->Stop();
+        stopped.Release();
+    }));
+
+    stopped.WaitOne();
+    ASSERT_EQ(1, ran.load());
+    ASSERT_TRUE(ranEarly);
+    ASSERT_EQ(0u, queue->GetPendingTaskCount());
+
+    // the timer thread is still joinable, destroying the queue here joins it.
+    queue = nullptr;
+    ASSERT_EQ(1, ran.load());
+}
+
+TEST(DelayedTaskQueue, PooledExecutorRunsRejectedDelayedTaskOnTimer)
+{
+    std::atomic<int> ran(0);
+    Semaphore blockerStarted(0, 1);
+    Semaphore releaseBlocker(0, 1);
+    Semaphore delayedDone(0, 1);
+    PooledThreadExecutor executor(1, OverflowPolicy::REJECT_IMMEDIATELY);
+
+    ASSERT_TRUE(executor.Submit([&] { blockerStarted.Release(); releaseBlocker.WaitOne(); }));
+    blockerStarted.WaitOne();
+    ASSERT_TRUE(executor.Submit([&] { ran++; }));
+
+    // the pool is busy and its queue is full, so the delayed task is rejected when it comes due and must run anyway.
+    ASSERT_TRUE(executor.SubmitAfter(std::chrono::milliseconds(20), [&] { ran++; delayedDone.Release(); }));
+    delayedDone.WaitOne();
+    ASSERT_EQ(1, ran.load());
+    releaseBlocker.Release();
+}
+
+TEST(DelayedTaskQueue, PooledExecutorSubmitAfterDoesNotHoldPoolThread)
+{
+    std::atomic<int> ran(0);
+    Semaphore delayedDone(0, 1);
+    Semaphore immediateDone(0, 1);
+    PooledThreadExecutor executor(1);
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(executor.SubmitAfter(std::chrono::milliseconds(100), [&] { ran++; delayedDone.Release(); }));
+    // the only pool thread must stay free while the first task is waiting out its delay.
+    ASSERT_TRUE(executor.Submit([&] { ran++; immediateDone.Release(); }));
+
+    immediateDone.WaitOne();
+    ASSERT_EQ(1, ran.load());
+    delayedDone.WaitOne();
+    ASSERT_EQ(2, ran.load());
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+}
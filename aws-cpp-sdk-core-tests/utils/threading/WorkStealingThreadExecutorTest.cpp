@@ -0,0 +1,142 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/WorkStealingThreadExecutor.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+static const char* ALLOCATION_TAG = "WorkStealingThreadExecutorTest";
+
+TEST(WorkStealingThreadExecutor, RunsEveryTaskSubmittedFromOutside)
+{
+    const int taskCount = 10000;
+    std::atomic<int> ran(0);
+    Semaphore done(0, 1);
+    WorkStealingThreadExecutor executor(4);
+    ASSERT_EQ(4u, executor.GetPoolSize());
+
+    for (int i = 0; i < taskCount; ++i)
+    {
+        ASSERT_TRUE(executor.Submit([&] { if (++ran == taskCount) done.Release(); }));
+    }
+
+    done.WaitOne();
+    ASSERT_EQ(taskCount, ran.load());
+}
+
+static void FanOut(WorkStealingThreadExecutor& executor, int depth, std::atomic<int>& leaves, int expectedLeaves, Semaphore& done)
+{
+    if (depth == 0)
+    {
+        if (++leaves == expectedLeaves)
+        {
+            done.Release();
+        }
+        return;
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        executor.Submit(FanOut, std::ref(executor), depth - 1, std::ref(leaves), expectedLeaves, std::ref(done));
+    }
+}
+
+TEST(WorkStealingThreadExecutor, RunsTasksSubmittedFromWorkers)
+{
+    //4^6 leaves, almost all of them pushed onto worker deques and spread by stealing.
+    const int expectedLeaves = 4096;
+    std::atomic<int> leaves(0);
+    Semaphore done(0, 1);
+    WorkStealingThreadExecutor executor(4);
+
+    executor.Submit(FanOut, std::ref(executor), 6, std::ref(leaves), expectedLeaves, std::ref(done));
+
+    done.WaitOne();
+    ASSERT_EQ(expectedLeaves, leaves.load());
+}
+
+TEST(WorkStealingThreadExecutor, WorksThroughExecutorInterface)
+{
+    std::atomic<int> ran(0);
+    Semaphore done(0, 1);
+    auto executor = Aws::MakeShared<WorkStealingThreadExecutor>(ALLOCATION_TAG, 2);
+    std::shared_ptr<Executor> asExecutor = executor;
+
+    //larger than the inline task storage, exercises the heap fallback too.
+    char padding[256] = {1};
+    ASSERT_TRUE(asExecutor->Submit([&, padding] { ran += padding[0]; }));
+    ASSERT_TRUE(asExecutor->SubmitAfter(std::chrono::milliseconds(20), [&] { ran++; done.Release(); }));
+
+    done.WaitOne();
+    ASSERT_EQ(2, ran.load());
+}
+
+TEST(WorkStealingThreadExecutor, DiscardsQueuedTasksOnDestruction)
+{
+    std::atomic<int> ran(0);
+    auto token = Aws::MakeShared<int>(ALLOCATION_TAG, 0);
+    {
+        Semaphore release(0, 1);
+        Semaphore started(0, 1);
+        WorkStealingThreadExecutor executor(1);
+        executor.Submit([&] { started.Release(); release.WaitOne(); ran++; });
+        started.WaitOne();
+        executor.Submit([&, token] { ran++; });
+        auto queuedUseCount = token.use_count();
+        release.Release();
+        ASSERT_EQ(2, queuedUseCount);
+    }
+
+    //the blocked task finishes, the captured state of anything still queued is released, not leaked.
+    ASSERT_GE(ran.load(), 1);
+    ASSERT_EQ(1, token.use_count());
+}
+
+TEST(WorkStealingThreadExecutor, RunsTasksFromConcurrentProducers)
+{
+    const int producers = 4;
+    const int tasksPerProducer = 2500;
+    const int totalTasks = producers * tasksPerProducer;
+    std::atomic<int> ran(0);
+    Semaphore done(0, 1);
+    WorkStealingThreadExecutor executor(std::max<size_t>(2, std::thread::hardware_concurrency()));
+
+    Aws::Vector<std::thread> threads;
+    for (int producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([&] {
+            for (int i = 0; i < tasksPerProducer; ++i)
+            {
+                executor.Submit([&] { if (++ran == totalTasks) done.Release(); });
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    done.WaitOne();
+    ASSERT_EQ(totalTasks, ran.load());
+}
@@ -0,0 +1,356 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Utils::Xml;
+using namespace Aws::Utils;
+
+TEST(XmlReaderTest, ReadsNestedDocument)
+{
+    Aws::StringStream ss(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<!-- listing -->\n"
+        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">\n"
+        "  <Name>bucket</Name>\n"
+        "  <Prefix/>\n"
+        "  <KeyCount>2</KeyCount>\n"
+        "  <Contents><Key>a&amp;b.txt</Key><Size>10</Size><Owner><ID>id1</ID></Owner></Contents>\n"
+        "  <Contents>\n"
+        "    <Key><![CDATA[<raw> & ]]]></Key>\n"
+        "    <Ignored><Deep attr='x'>text</Deep><Empty/></Ignored>\n"
+        "    <Size>20</Size>\n"
+        "  </Contents>\n"
+        "  <Grantee xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xsi:type=\"CanonicalUser\"/>\n"
+        "</ListBucketResult>\n");
+    XmlReader reader(ss);
+
+    Aws::String name;
+    ASSERT_TRUE(reader.NextElement(name));
+    ASSERT_EQ("ListBucketResult", name);
+    ASSERT_EQ("http://s3.amazonaws.com/doc/2006-03-01/", reader.GetAttributeValue("xmlns"));
+
+    Aws::Vector<Aws::String> elements;
+    Aws::Vector<Aws::String> keys;
+    Aws::Vector<Aws::String> sizes;
+    Aws::String bucket;
+    Aws::String prefix("not set");
+    Aws::String ownerId;
+    Aws::String granteeType;
+    while (reader.NextElement(name))
+    {
+        elements.push_back(name);
+        if (name == "Name")
+        {
+            bucket = reader.ReadText();
+        }
+        else if (name == "Prefix")
+        {
+            prefix = reader.ReadText();
+        }
+        else if (name == "Contents")
+        {
+            Aws::String contentsName;
+            while (reader.NextElement(contentsName))
+            {
+                if (contentsName == "Key")
+                {
+                    keys.push_back(reader.ReadText());
+                }
+                else if (contentsName == "Size")
+                {
+                    sizes.push_back(reader.ReadText());
+                }
+                else if (contentsName == "Owner")
+                {
+                    Aws::String ownerName;
+                    while (reader.NextElement(ownerName))
+                    {
+                        ownerId = reader.ReadText();
+                    }
+                }
+                else
+                {
+                    reader.SkipElement();
+                }
+            }
+        }
+        else if (name == "Grantee")
+        {
+            granteeType = reader.GetAttributeValue("xsi:type");
+            reader.SkipElement();
+        }
+        else
+        {
+            reader.SkipElement();
+        }
+    }
+
+    ASSERT_FALSE(reader.NextElement(name));
+    ASSERT_TRUE(reader.WasParseSuccessful());
+    ASSERT_EQ(6u, elements.size());
+    ASSERT_EQ("KeyCount", elements[2]);
+    ASSERT_EQ("bucket", bucket);
+    ASSERT_EQ("", prefix);
+    ASSERT_EQ(2u, keys.size());
+    ASSERT_EQ("a&b.txt", keys[0]);
+    ASSERT_EQ("<raw> & ]", keys[1]);
+    ASSERT_EQ(2u, sizes.size());
+    ASSERT_EQ("10", sizes[0]);
+    ASSERT_EQ("20", sizes[1]);
+    ASSERT_EQ("id1", ownerId);
+    ASSERT_EQ("CanonicalUser", granteeType);
+    ASSERT_EQ("", reader.GetAttributeValue("xsi:type"));
+}
+
+TEST(XmlReaderTest, TextMatchesDom)
+{
+    Aws::String values[] = {
+        "plain",
+        "  padded\t",
+        "&lt;tag&gt; &quot;quoted&quot; &apos;single&apos; &amp;amp;",
+        "&#65;&#x42;&#xe9;&#x1F600;",
+        "&unknown; & bare",
+        "line\r\nbreaks\rhere"
+    };
+
+    for (const auto& value : values)
+    {
+        Aws::String document = "<Root><Value>" + value + "</Value></Root>";
+        XmlDocument doc = XmlDocument::CreateFromXmlString(document);
+        ASSERT_TRUE(doc.WasParseSuccessful()) << value;
+        Aws::String expected = DecodeEscapedXmlText(doc.GetRootElement().FirstChild("Value").GetText());
+
+        Aws::StringStream ss(document);
+        XmlReader reader(ss);
+        Aws::String name;
+        ASSERT_TRUE(reader.NextElement(name));
+        ASSERT_TRUE(reader.NextElement(name));
+        ASSERT_EQ(expected, reader.ReadText()) << value;
+        ASSERT_FALSE(reader.NextElement(name));
+        ASSERT_TRUE(reader.WasParseSuccessful()) << reader.GetErrorMessage();
+    }
+}
+
+TEST(XmlReaderTest, ReadsAttributes)
+{
+    Aws::StringStream ss("<Root a=\"1\" b = 'two &amp; three' c=\"&lt;&#x41;&gt;\"><Child d=\"4\"/></Root>");
+    XmlReader reader(ss);
+
+    Aws::String name;
+    ASSERT_TRUE(reader.NextElement(name));
+    ASSERT_EQ("1", reader.GetAttributeValue("a"));
+    ASSERT_EQ("two & three", reader.GetAttributeValue("b"));
+    ASSERT_EQ("<A>", reader.GetAttributeValue("c"));
+    ASSERT_EQ("", reader.GetAttributeValue("d"));
+
+    ASSERT_TRUE(reader.NextElement(name));
+    ASSERT_EQ("Child", name);
+    ASSERT_EQ("4", reader.GetAttributeValue("d"));
+    ASSERT_EQ("", reader.GetAttributeValue("a"));
+    ASSERT_EQ("", reader.ReadText());
+    ASSERT_FALSE(reader.NextElement(name));
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, ReadsAcrossBufferBoundaries)
+{
+    //long enough to span several buffers, with names, entities and CDATA sections falling across the boundaries.
+    const size_t count = 3000;
+    Aws::String document = "<Items>";
+    for (size_t i = 0; i < count; ++i)
+    {
+        document += "<Item id=\"" + StringUtils::to_string(i) + "&amp;\"><Value>v&lt;" + StringUtils::to_string(i) +
+            "&gt;<![CDATA[]]]]><![CDATA[>]]></Value><Skip><a/><b>x</b></Skip></Item>";
+    }
+    document += "</Items>";
+    ASSERT_LT(static_cast<size_t>(XmlReader::BUFFER_SIZE * 10), document.size());
+
+    Aws::StringStream ss(document);
+    XmlReader reader(ss);
+    Aws::String name;
+    ASSERT_TRUE(reader.NextElement(name));
+    size_t read = 0;
+    while (reader.NextElement(name))
+    {
+        ASSERT_EQ("Item", name);
+        ASSERT_EQ(StringUtils::to_string(read) + "&", reader.GetAttributeValue("id"));
+        Aws::String itemName;
+        while (reader.NextElement(itemName))
+        {
+            if (itemName == "Value")
+            {
+                ASSERT_EQ("v<" + StringUtils::to_string(read) + ">]]>", reader.ReadText());
+            }
+            else
+            {
+                reader.SkipElement();
+            }
+        }
+        ++read;
+    }
+
+    ASSERT_TRUE(reader.WasParseSuccessful()) << reader.GetErrorMessage();
+    ASSERT_EQ(count, read);
+}
+
+TEST(XmlReaderTest, StopsAtSyntaxErrors)
+{
+    const char* documents[] = {
+        "<Root><Child>text</Other></Root>",
+        "<Root><Child>text</Child>",
+        "<Root><Child attr=unquoted/></Root>",
+        "<Root><!-- unterminated </Root>",
+        "<Root></Root></Root>"
+    };
+
+    for (const char* document : documents)
+    {
+        Aws::StringStream ss(document);
+        XmlReader reader(ss);
+        Aws::String name;
+        while (reader.NextElement(name))
+        {
+            reader.ReadText();
+        }
+        ASSERT_FALSE(reader.NextElement(name));
+        ASSERT_FALSE(reader.WasParseSuccessful()) << document;
+        ASSERT_FALSE(reader.GetErrorMessage().empty());
+        ASSERT_EQ("", reader.ReadText());
+    }
+}
+
+TEST(XmlReaderTest, EmptyDocument)
+{
+    Aws::StringStream ss("");
+    XmlReader reader(ss);
+    Aws::String name;
+    ASSERT_FALSE(reader.NextElement(name));
+    ASSERT_EQ("", reader.ReadText());
+    reader.SkipElement();
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+//a 1000 key ListObjectsV2 page, read into plain strings through the DOM or through the reader.
+static const size_t KEY_COUNT = 1000;
+
+static Aws::String BuildListing()
+{
+    Aws::String listing = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+        "<Name>bucket</Name><Prefix></Prefix><KeyCount>1000</KeyCount><MaxKeys>1000</MaxKeys><IsTruncated>false</IsTruncated>";
+    for (size_t i = 0; i < KEY_COUNT; ++i)
+    {
+        listing += "<Contents><Key>photos/2019/08/" + StringUtils::to_string(i) + ".jpg</Key>"
+            "<LastModified>2019-08-01T12:00:00.000Z</LastModified><ETag>&quot;d41d8cd98f00b204e9800998ecf8427e&quot;</ETag>"
+            "<Size>" + StringUtils::to_string(i * 1024) + "</Size><StorageClass>STANDARD</StorageClass></Contents>";
+    }
+    listing += "</ListBucketResult>";
+    return listing;
+}
+
+static size_t ReadListingWithDom(const Aws::String& listing)
+{
+    Aws::StringStream ss(listing);
+    XmlDocument doc = XmlDocument::CreateFromXmlStream(ss);
+    size_t bytes = 0;
+    XmlNode contents = doc.GetRootElement().FirstChild("Contents");
+    while (!contents.IsNull())
+    {
+        bytes += DecodeEscapedXmlText(contents.FirstChild("Key").GetText()).size();
+        bytes += DecodeEscapedXmlText(contents.FirstChild("LastModified").GetText()).size();
+        bytes += DecodeEscapedXmlText(contents.FirstChild("ETag").GetText()).size();
+        bytes += DecodeEscapedXmlText(contents.FirstChild("Size").GetText()).size();
+        bytes += DecodeEscapedXmlText(contents.FirstChild("StorageClass").GetText()).size();
+        contents = contents.NextNode("Contents");
+    }
+    return bytes;
+}
+
+static size_t ReadListingWithReader(const Aws::String& listing)
+{
+    Aws::StringStream ss(listing);
+    XmlReader reader(ss);
+    size_t bytes = 0;
+    Aws::String name;
+    reader.NextElement(name);
+    while (reader.NextElement(name))
+    {
+        if (name != "Contents")
+        {
+            reader.SkipElement();
+            continue;
+        }
+
+        while (reader.NextElement(name))
+        {
+            bytes += reader.ReadText().size();
+        }
+    }
+    return bytes;
+}
+
+TEST(XmlReaderTest, TruncatedBodyFailsLikeDom)
+{
+    //a response cut off anywhere must be reported the same way the DOM reports it, not decoded into a short listing.
+    Aws::String listing = BuildListing();
+    ASSERT_TRUE(XmlDocument::CreateFromXmlString(listing).WasParseSuccessful());
+    size_t rootStart = listing.find("<ListBucketResult");
+
+    Aws::Vector<size_t> cuts;
+    for (size_t cut = 1; cut < 512; ++cut)
+    {
+        cuts.push_back(cut);
+    }
+    for (size_t cut = 512; cut < listing.size(); cut += 997)
+    {
+        cuts.push_back(cut);
+    }
+    cuts.push_back(listing.size() - 1);
+
+    for (size_t cut : cuts)
+    {
+        Aws::String truncated = listing.substr(0, cut);
+        Aws::StringStream ss(truncated);
+        XmlReader reader(ss);
+        Aws::String name;
+        if (reader.NextElement(name))
+        {
+            while (reader.NextElement(name))
+            {
+                reader.SkipElement();
+            }
+        }
+        ASSERT_EQ(XmlDocument::CreateFromXmlString(truncated).WasParseSuccessful(), reader.WasParseSuccessful()) << "cut at " << cut;
+        if (cut > rootStart)
+        {
+            ASSERT_FALSE(reader.WasParseSuccessful()) << "cut at " << cut;
+            ASSERT_FALSE(reader.GetErrorMessage().empty());
+        }
+    }
+}
+
+TEST(XmlReaderTest, ReaderMatchesDomOnLargeListing)
+{
+    Aws::String listing = BuildListing();
+    size_t bytes = ReadListingWithDom(listing);
+    ASSERT_LT(0u, bytes);
+    ASSERT_EQ(bytes, ReadListingWithReader(listing));
+}
@@ -155,6 +155,14 @@ namespace Aws
          * get closure for notification that a request is being retried
          */
         inline virtual const RequestRetryHandler& GetRequestRetryHandler() const { return m_requestRetryHandler; }
+        /**
+         * Register a sink that receives the body of a successful response directly from the http client, bypassing the response stream.
+         */
+        inline virtual void SetResponseBodySink(const std::shared_ptr<Aws::Http::ResponseBodySink>& responseBodySink) { m_responseBodySink = responseBodySink; }
+        /**
+         * get the sink for the body of a successful response, if any.
+         */
+        inline virtual const std::shared_ptr<Aws::Http::ResponseBodySink>& GetResponseBodySink() const { return m_responseBodySink; }
         /**
          * If this is set to true, content-md5 needs to be computed and set on the request
          */
@@ -177,6 +185,7 @@ namespace Aws
         Aws::Http::ContinueRequestHandler m_continueRequest;
         RequestSignedHandler m_onRequestSigned;
         RequestRetryHandler m_requestRetryHandler;
+        std::shared_ptr<Aws::Http::ResponseBodySink> m_responseBodySink;
     };
 
 } // namespace Aws
@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/Region.h>
+#include <aws/core/auth/SigningKeyCache.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSSet.h>
 #include <aws/core/utils/DateTime.h>
@@ -244,6 +245,8 @@ namespace Aws
             Aws::Utils::ByteBuffer ComputeHash(const Aws::String& secretKey, const Aws::String& simpleDate) const;
             Aws::Utils::ByteBuffer ComputeHash(const Aws::String& secretKey,
                     const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
+            Aws::Utils::ByteBuffer DeriveSigningKey(const Aws::String& secretKey,
+                    const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
 
 
             std::shared_ptr<Auth::AWSCredentialsProvider> m_credentialsProvider;
@@ -254,13 +257,10 @@ namespace Aws
 
             Aws::Set<Aws::String> m_unsignedHeaders;
 
-            //these next four fields are ONLY for caching purposes and do not change
-            //the logical state of the signer. They are marked mutable so the
-            //interface can remain const.
-            mutable Aws::Utils::ByteBuffer m_partialSignature;
-            mutable Aws::String m_currentDateStr;
-            mutable Aws::String m_currentSecretKey;
-            mutable Utils::Threading::ReaderWriterLock m_partialSignatureLock;
+            //derived signing keys for every (secret key, date, region, service) this signer signed with lately.
+            //It is ONLY for caching purposes and does not change the logical state of the signer,
+            //so it is marked mutable and the interface can remain const.
+            mutable Aws::Auth::SigningKeyCache m_signingKeyCache;
             PayloadSigningPolicy m_payloadSigningPolicy;
             bool m_urlEscapePath;
         };
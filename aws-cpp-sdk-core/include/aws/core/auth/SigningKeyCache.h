@@ -0,0 +1,82 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Auth
+    {
+        /**
+         * Small fixed size cache of SigV4 derived signing keys, keyed by (secret key, date, region, service).
+         * Lookups never take a lock: every slot is guarded by a sequence counter that a writer makes odd while it rewrites the slot,
+         * and a reader that sees the counter move under it treats the lookup as a miss.
+         * Writers don't wait either, a writer that finds a slot being rewritten simply doesn't cache its key.
+         *
+         * Keys whose parts don't fit in a slot are never cached, callers then derive the key every time.
+         */
+        class AWS_CORE_API SigningKeyCache
+        {
+        public:
+            static const size_t SLOT_COUNT = 16;
+            static const size_t KEY_WORDS = 20;
+            static const size_t DERIVED_KEY_WORDS = 4;
+
+            SigningKeyCache();
+
+            /**
+             * Rule of 5 stuff.
+             * Don't copy or move
+             */
+            SigningKeyCache(const SigningKeyCache&) = delete;
+            SigningKeyCache& operator =(const SigningKeyCache&) = delete;
+            SigningKeyCache(SigningKeyCache&&) = delete;
+            SigningKeyCache& operator =(SigningKeyCache&&) = delete;
+
+            /**
+             * Copies the cached derived key for these parts into derivedKey and returns true, or returns false on a miss.
+             */
+            bool Get(const Aws::String& secretKey, const Aws::String& simpleDate, const Aws::String& region,
+                    const Aws::String& serviceName, Aws::Utils::ByteBuffer& derivedKey) const;
+
+            /**
+             * Caches derivedKey (a 32 byte HMAC-SHA256 result) for these parts, evicting the least recently written entry of its bucket.
+             */
+            void Put(const Aws::String& secretKey, const Aws::String& simpleDate, const Aws::String& region,
+                    const Aws::String& serviceName, const Aws::Utils::ByteBuffer& derivedKey);
+
+        private:
+            struct Slot
+            {
+                std::atomic<uint32_t> sequence;
+                std::atomic<uint64_t> writeStamp;
+                std::atomic<uint64_t> key[KEY_WORDS];
+                std::atomic<uint64_t> derivedKey[DERIVED_KEY_WORDS];
+            };
+
+            bool ReadSlot(const Slot& slot, const uint64_t* key, uint64_t* derivedKey) const;
+
+            Slot m_slots[SLOT_COUNT];
+            std::atomic<uint64_t> m_writeStamp;
+        };
+    } // namespace Auth
+} // namespace Aws
@@ -24,6 +24,9 @@
 #include <aws/core/auth/AWSAuthSignerProvider.h>
 #include <memory>
 #include <atomic>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
 
 struct aws_array_list;
 
@@ -53,6 +56,12 @@ namespace Aws
         {
             class MD5;
         } // namespace Crypto
+
+        namespace Threading
+        {
+            class Executor;
+            class DelayedTaskQueue;
+        } // namespace Threading
     } // namespace Utils
 
     namespace Http
@@ -88,6 +97,8 @@ namespace Aws
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
+        typedef std::function<void(const HttpResponseOutcome&)> HttpResponseOutcomeReceivedHandler;
+        typedef std::function<void(const StreamOutcome&)> StreamOutcomeReceivedHandler;
 
         /**
          * Abstract AWS Client. Contains most of the functionality necessary to build an http request, get it signed, and send it accross the wire.
@@ -113,7 +124,11 @@ namespace Aws
                 const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                 const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSClient() { };
+            /**
+             * Stops request processing and waits for every attempt started by AttemptExhaustivelyAsync to hand off its
+             * outcome before any member is destroyed. See DrainAsyncAttempts.
+             */
+            virtual ~AWSClient();
 
             /**
              * Generates a signed Uri using the injected signer. for the supplied uri and http method. expirationInSecodns defaults
@@ -159,12 +174,30 @@ namespace Aws
              */
             void EnableRequestProcessing();
 
+            /**
+             * Opens up to connections connections to the service endpoint in parallel and blocks until they are established, so the
+             * first requests after creating the client skip DNS, TCP and TLS setup. Call it during initialization, ahead of traffic.
+             * Returns the number of connections that were opened, 0 if the client has not set an endpoint to warm up.
+             */
+            virtual size_t WarmUp(size_t connections) const;
+
             inline virtual const char* GetServiceClientName() const { return nullptr; }
 
         protected:
+            /**
+             * The scheme://host[:port] WarmUp() connects to. Service clients set it whenever their endpoint is computed or overridden.
+             */
+            void SetWarmUpEndpoint(const Aws::String& endpoint) { m_warmUpEndpoint = endpoint; }
+
+            /**
+             * The http client requests are sent with.
+             */
+            const std::shared_ptr<Aws::Http::HttpClient>& GetHttpClient() const { return m_httpClient; }
+
             /**
              * Calls AttemptOnRequest until it either, succeeds, runs out of retries from the retry strategy,
              * or encounters and error that is not retryable.
+             * If the http client supports async requests, this runs AttemptExhaustivelyAsync and waits on its outcome.
              */
             HttpResponseOutcome AttemptExhaustively(const Aws::Http::URI& uri,
                     const Aws::AmazonWebServiceRequest& request,
@@ -183,6 +216,29 @@ namespace Aws
                     const char* signerName,
                     const char* requestName = "") const;
 
+            /**
+             * Non-blocking counterpart of AttemptExhaustively. Builds and signs the request, hands it to the http client and returns.
+             * Each completion decides whether to retry and re-submits the next attempt itself, so no thread waits on the wire.
+             * Retry delays are parked on the client's own retry timer and the next attempt is sent from the timer thread,
+             * so backoff neither holds a thread nor needs a free executor thread to resume.
+             * onOutcomeReceived is called exactly once. It is submitted to executor when one is given, so the http client's
+             * event loop is never blocked by it, and runs on the thread that completed the last attempt when executor is null
+             * or rejects it. Attempts still waiting out their backoff when the client is destroyed complete with a
+             * NETWORK_CONNECTION error.
+             */
+            void AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+                    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                    Http::HttpMethod httpMethod,
+                    const char* signerName,
+                    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                    const HttpResponseOutcomeReceivedHandler& onOutcomeReceived) const;
+
+            /**
+             * Returns true if the underlying http client completes requests without parking the calling thread.
+             * Generated clients use this to choose between the continuation based async path and their executor.
+             */
+            bool HttpClientSupportsAsyncRequests() const;
+
             /**
              * Build an Http Request from the AmazonWebServiceRequest object. Signs the request, sends it accross the wire
              * then reports the http response.
@@ -223,6 +279,17 @@ namespace Aws
                     const char* signerName = Aws::Auth::SIGV4_SIGNER,
                     const char* requestName = "") const;
 
+            /**
+             * Non-blocking counterpart of MakeRequestWithUnparsedResponse. Calls AttemptExhaustivelyAsync and hands the response stream
+             * to onOutcomeReceived without parsing it.
+             */
+            void MakeRequestWithUnparsedResponseAsync(const Aws::Http::URI& uri,
+                    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                    Http::HttpMethod method,
+                    const char* signerName,
+                    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                    const StreamOutcomeReceivedHandler& onOutcomeReceived) const;
+
             /**
              * Abstract.  Subclassing clients should override this to tell the client how to marshall error payloads
              */
@@ -263,7 +330,26 @@ namespace Aws
              * Performs the HTTP request via the HTTP client while enforcing rate limiters
              */
             std::shared_ptr<Aws::Http::HttpResponse> MakeHttpRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const;
+
+            /**
+             * Disables request processing, fails the retries still waiting out their backoff and blocks until every attempt
+             * started by AttemptExhaustivelyAsync has handed its outcome off, so no completion runs against a client that is
+             * being torn down. Subclasses that implement BuildAWSError call it from their destructor, while that override is
+             * still reachable; ~AWSClient calls it again for the rest. Safe to call more than once.
+             * Must not be called from a handler that AttemptExhaustivelyAsync runs inline: such a handler may be on the retry
+             * timer's thread, which can't join itself, or on the thread other attempts need to complete.
+             */
+            void DrainAsyncAttempts();
         private:
+            struct AsyncAttemptContext;
+
+            void AttemptOneRequestAsync(const std::shared_ptr<AsyncAttemptContext>& attemptContext) const;
+            void OnAsyncAttemptCompleted(const std::shared_ptr<AsyncAttemptContext>& attemptContext, HttpResponseOutcome& outcome) const;
+            void FailAsyncAttempt(const std::shared_ptr<AsyncAttemptContext>& attemptContext) const;
+            void CompleteAsyncAttempt(const std::shared_ptr<AsyncAttemptContext>& attemptContext, const HttpResponseOutcome& outcome) const;
+            HttpResponseOutcome BuildHttpResponseOutcome(const std::shared_ptr<Http::HttpRequest>& httpRequest,
+                    const std::shared_ptr<Http::HttpResponse>& httpResponse) const;
+
             /**
              * Try to adjust signer's clock
              * return true if signer's clock is adjusted, false otherwise.
@@ -286,9 +372,16 @@ namespace Aws
             Aws::String m_userAgent;
             std::shared_ptr<Aws::Utils::Crypto::Hash> m_hash;
             bool m_enableClockSkewAdjustment;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
+            Aws::String m_warmUpEndpoint;
+            std::shared_ptr<Aws::Utils::Threading::DelayedTaskQueue> m_retryTimer;
+            mutable std::mutex m_asyncAttemptsLock;
+            mutable std::condition_variable m_asyncAttemptsDrained;
+            mutable size_t m_asyncAttemptsInFlight;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
+        typedef std::function<void(const JsonOutcome&)> JsonOutcomeReceivedHandler;
         AWS_CORE_API Aws::String GetAuthorizationHeader(const Aws::Http::HttpRequest& httpRequest);
 
         /**
@@ -314,7 +407,7 @@ namespace Aws
                     const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                     const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSJsonClient() = default;
+            virtual ~AWSJsonClient();
 
         protected:
             /**
@@ -347,10 +440,22 @@ namespace Aws
                 const char* signerName = Aws::Auth::SIGV4_SIGNER,
                 const char* requestName = "") const;
 
+            /**
+             * Non-blocking counterpart of MakeRequest. Calls AttemptExhaustivelyAsync and parses the response body
+             * on completion before handing the outcome to onOutcomeReceived. Both run on executor when one is given.
+             */
+            void MakeRequestAsync(const Aws::Http::URI& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                Http::HttpMethod method,
+                const char* signerName,
+                const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                const JsonOutcomeReceivedHandler& onOutcomeReceived) const;
+
             JsonOutcome MakeEventStreamRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Xml::XmlDocument>, AWSError<CoreErrors>> XmlOutcome;
+        typedef std::function<void(const XmlOutcome&)> XmlOutcomeReceivedHandler;
 
         /**
         *  AWSClient that handles marshalling xml response bodies. You would inherit from this class
@@ -370,7 +475,7 @@ namespace Aws
                 const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                 const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSXMLClient() = default;
+            virtual ~AWSXMLClient();
 
         protected:
             /**
@@ -404,6 +509,17 @@ namespace Aws
                 const char* signerName = Aws::Auth::SIGV4_SIGNER,
                 const char* requestName = "") const;
 
+            /**
+             * Non-blocking counterpart of MakeRequest. Calls AttemptExhaustivelyAsync and parses the response body
+             * on completion before handing the outcome to onOutcomeReceived. Both run on executor when one is given.
+             */
+            void MakeRequestAsync(const Aws::Http::URI& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                Http::HttpMethod method,
+                const char* signerName,
+                const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                const XmlOutcomeReceivedHandler& onOutcomeReceived) const;
+
             /**
             * This is used for event stream response.
             */
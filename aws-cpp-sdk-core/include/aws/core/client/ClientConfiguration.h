@@ -109,6 +109,28 @@ namespace Aws
              * Default 1 byte/second. Only for CURL client currently.
              */
             unsigned long lowSpeedLimit;
+            /**
+             * Connections that have been idle for longer than this are closed instead of being reused, so requests do not
+             * go out over connections the server or a load balancer is likely to have dropped already. Curl rounds it up to
+             * whole seconds. Default 0, which keeps the http library's own limit (118 seconds for curl).
+             * Only for CURL client currently.
+             */
+            unsigned long maxIdleConnectionTimeMs;
+            /**
+             * Number of connections the http client opens to endpointOverride, in parallel, while it is constructed, so the
+             * first requests do not each pay for DNS, TCP and TLS setup. Capped at maxConnections. Ignored when endpointOverride is empty.
+             * Default 0, connections are only opened as requests need them. To warm up the service endpoint instead, call WarmUp() on the client.
+             * Only for CURL clients currently.
+             */
+            unsigned connectionPoolWarmUpSize;
+            /**
+             * When non zero, a background thread wakes up this often and sends a HEAD request over every pooled connection that has been
+             * idle for the whole interval, so it is still open when traffic returns instead of having been dropped by the server's idle timeout.
+             * Set it comfortably below that timeout. Connections stay open for as long as the client lives; combine with maxIdleConnectionTimeMs
+             * only if the refresh interval is the shorter of the two. Refresh requests are not counted in the client's connection stats.
+             * Default 0, disabled. Only for CURL_CLIENT currently; CURL_MULTI_CLIENT keeps its connections inside curl.
+             */
+            unsigned long idleConnectionRefreshIntervalMs;
             /**
              * Strategy to use in case of failed requests. Default is DefaultRetryStrategy (e.g. exponential backoff)
              */
@@ -195,6 +217,12 @@ namespace Aws
              * Override the http implementation the default factory returns.
              */
             Aws::Http::TransferLibType httpLibOverride;
+            /**
+             * Number of event loop threads driving transfers when httpLibOverride is CURL_MULTI_CLIENT.
+             * Each loop multiplexes all of its in-flight requests over one curl multi handle; maxConnections is split evenly between loops.
+             * 0 means one loop per hardware thread. Default 1.
+             */
+            unsigned eventLoopThreads;
             /**
              * If set to true the http stack will follow 300 redirect codes.
              */
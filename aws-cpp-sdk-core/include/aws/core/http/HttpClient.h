@@ -17,9 +17,11 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
 
 #include <memory>
 #include <atomic>
+#include <functional>
 #include <mutex>
 #include <condition_variable>
 
@@ -38,6 +40,11 @@ namespace Aws
         class HttpRequest;
         class HttpResponse;
 
+        /**
+         * Invoked once an asynchronous http request has finished. The response is nullptr if the request failed at the transport level.
+         */
+        typedef std::function<void(const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>&)> AsyncResponseReceivedHandler;
+
         /**
           * Abstract HttpClient. All it does is make HttpRequests and return their response.
           */
@@ -69,11 +76,35 @@ namespace Aws
                 return nullptr;
             }
 
+            /**
+             * Makes the request and invokes onResponseReceived with the response once the transfer has finished.
+             * If SupportsAsyncRequests() is true this returns immediately and the handler runs on a thread owned by the http client,
+             * so keep the handler short or hand the work off to an executor.
+             * Default implementation makes the request synchronously on the calling thread, then invokes the handler.
+             */
+            virtual void MakeAsyncRequest(const std::shared_ptr<HttpRequest>& request,
+                const AsyncResponseReceivedHandler& onResponseReceived,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
+
+            /**
+             * If yes, MakeAsyncRequest does not block the calling thread for the duration of the transfer.
+             */
+            virtual bool SupportsAsyncRequests() const { return false; }
+
             /**
              * If yes, the http client supports transfer-encoding:chunked.
              */
             virtual bool SupportsChunkedTransferEncoding() const { return true; }
 
+            /**
+             * Opens up to connections keep-alive connections to endpoint (scheme://host[:port]) ahead of traffic, so the first requests
+             * do not each pay for DNS, TCP and TLS setup. Every connection is opened and validated with a HEAD request, all of them in parallel;
+             * any http status counts as success. Blocks until they have all finished and returns how many got a response.
+             * How many connections stay open afterwards is up to the implementation's pool size.
+             */
+            virtual size_t WarmUp(const Aws::String& endpoint, size_t connections) const;
+
             /**
              * Stops all requests in progress and prevents any others from initiating.
              */
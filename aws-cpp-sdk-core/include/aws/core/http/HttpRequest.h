@@ -19,6 +19,7 @@
 
 #include <aws/core/http/URI.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/ResponseBodySink.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
@@ -489,6 +490,15 @@ namespace Aws
 
             inline const ContinueRequestHandler& GetContinueRequestHandler() const { return m_continueRequest; }
 
+            /**
+             * Sets a sink that receives the body of a successful response instead of the response stream. See ResponseBodySink.
+             */
+            inline void SetResponseBodySink(const std::shared_ptr<ResponseBodySink>& responseBodySink) { m_responseBodySink = responseBodySink; }
+            /**
+             * Gets the sink for the body of a successful response, if any.
+             */
+            inline const std::shared_ptr<ResponseBodySink>& GetResponseBodySink() const { return m_responseBodySink; }
+
             /**
              * Gets the AWS Access Key if this HttpRequest is signed with Aws Access Key
              */
@@ -539,6 +549,7 @@ namespace Aws
             DataReceivedEventHandler m_onDataReceived;
             DataSentEventHandler m_onDataSent;
             ContinueRequestHandler m_continueRequest;
+            std::shared_ptr<ResponseBodySink> m_responseBodySink;
             Aws::String m_signingRegion;
             Aws::String m_signingAccessKey;
             Aws::String m_resolvedRemoteHost;
@@ -0,0 +1,107 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <cstddef>
+#include <functional>
+
+namespace Aws
+{
+    namespace Http
+    {
+        class HttpRequest;
+        class HttpResponse;
+
+        /**
+         * Receives the body of a successful response directly from the http client, chunk by chunk, instead of the response stream.
+         * This skips the iostream layer and the copy into the stream's buffer, which matters for large downloads.
+         * Responses with an error status still go to the response stream so that errors can be unmarshalled.
+         * When a sink is used the response stream stays empty.
+         * Supported by the curl and WinHttp/WinINet clients; the IXmlHttpRequest2 client always writes to the response stream.
+         */
+        class AWS_CORE_API ResponseBodySink
+        {
+        public:
+            virtual ~ResponseBodySink() = default;
+
+            /**
+             * Called when every attempt starts, and again before the first chunk of a successful body. A retried request
+             * delivers its body again from the start, so sinks that keep state start over here.
+             */
+            virtual void Reset() {}
+
+            /**
+             * Receives the next length bytes of the body. data is only valid for the duration of the call.
+             * Return false to abort the transfer.
+             */
+            virtual bool OnBodyData(const char* data, std::size_t length) = 0;
+        };
+
+        typedef std::function<bool(const char*, std::size_t)> ResponseBodyDataHandler;
+
+        /**
+         * Hands every chunk to a callback.
+         */
+        class AWS_CORE_API CallbackResponseBodySink : public ResponseBodySink
+        {
+        public:
+            /**
+             * onReset, if set, is called when a retried request starts delivering the body again.
+             */
+            CallbackResponseBodySink(const ResponseBodyDataHandler& onData, const std::function<void()>& onReset = nullptr);
+
+            void Reset() override;
+            bool OnBodyData(const char* data, std::size_t length) override;
+
+        private:
+            ResponseBodyDataHandler m_onData;
+            std::function<void()> m_onReset;
+        };
+
+        /**
+         * Writes the body into caller owned contiguous memory, for instance the buffer behind a PreallocatedStreamBuf.
+         * The buffer must outlive the request. A body that doesn't fit aborts the transfer.
+         */
+        class AWS_CORE_API BufferResponseBodySink : public ResponseBodySink
+        {
+        public:
+            BufferResponseBodySink(unsigned char* buffer, std::size_t length);
+
+            void Reset() override { m_bytesWritten = 0; }
+            bool OnBodyData(const char* data, std::size_t length) override;
+
+            /**
+             * Number of body bytes written to the start of the buffer by the latest attempt.
+             */
+            std::size_t GetBytesWritten() const { return m_bytesWritten; }
+
+        private:
+            unsigned char* m_buffer;
+            std::size_t m_length;
+            std::size_t m_bytesWritten;
+        };
+
+        /**
+         * For http client implementations: called once per attempt when the body starts, after the status code is set on response.
+         * Returns the sink of request, reset for this attempt, if it has one and the response is successful;
+         * otherwise returns nullptr and the body belongs in the response stream.
+         */
+        AWS_CORE_API ResponseBodySink* BeginResponseBody(const HttpRequest& request, const HttpResponse& response);
+
+    } // namespace Http
+} // namespace Aws
@@ -16,8 +16,14 @@
 #pragma once
 
 #include <aws/core/utils/ResourceManager.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <chrono>
 #include <utility>
+#include <mutex>
 #include <curl/curl.h>
 
 namespace Aws
@@ -25,11 +31,36 @@ namespace Aws
 namespace Http
 {
 
+/**
+ * Connection counters for one scheme://host[:port] a curl handle pool has talked to.
+ */
+struct CurlHostConnectionStats
+{
+    CurlHostConnectionStats() : requestCount(0), newConnectionCount(0), reusedConnectionCount(0) {}
+
+    /**
+     * Transfers made to the host, successful or not. Transfers that failed before reaching the host count in neither of the other two.
+     */
+    uint64_t requestCount;
+    /**
+     * Transfers that had to open a connection (DNS, TCP and TLS setup).
+     */
+    uint64_t newConnectionCount;
+    /**
+     * Transfers that went out over a connection kept alive by an earlier transfer.
+     */
+    uint64_t reusedConnectionCount;
+};
+
 /**
   * Simple Connection pool manager for Curl. It maintains connections in a thread safe manner. You
   * can call into acquire a handle, then put it back when finished. It is assumed that reusing an already
   * initialized handle is preferable (especially for synchronous clients). The pool doubles in capacity as
   * needed up to the maximum amount of connections.
+  *
+  * All handles in the pool are attached to one curl share handle, so a handle that has to open a new connection
+  * reuses DNS lookups and resumes TLS sessions negotiated by the other handles. Connections themselves stay with the
+  * handle that opened them; libcurl does not support one connection cache used by transfers on several threads at once.
   */
 class CurlHandleContainer
 {
@@ -39,7 +70,8 @@ public:
       * then a small size is best. For async support, a good value would be 6 * number of Processors.   *
       */
     CurlHandleContainer(unsigned maxSize = 50, long httpRequestTimeout = 0, long connectTimeout = 1000, bool tcpKeepAlive = true, 
-                        unsigned long tcpKeepAliveIntervalMs = 30000, long lowSpeedTime = 3000, unsigned long lowSpeedLimit = 1);
+                        unsigned long tcpKeepAliveIntervalMs = 30000, long lowSpeedTime = 3000, unsigned long lowSpeedLimit = 1,
+                        unsigned long maxIdleConnectionTimeMs = 0);
     ~CurlHandleContainer();
 
     /**
@@ -52,6 +84,24 @@ public:
       */
     void ReleaseCurlHandle(CURL* handle);
 
+    /**
+      * Takes one handle out of the pool that sits idle and whose last transfer reached its host at least idleFor ago,
+      * without blocking, and sets host to the scheme://host[:port] it last talked to. Returns nullptr if there is none.
+      * Release it like any other handle; the transfer made on it in between only refreshes its connection, so it is not
+      * counted in GetHostConnectionStats. If that transfer does not reach the host, the handle is not returned again
+      * until a regular transfer on it does.
+      */
+    CURL* AcquireIdleCurlHandle(std::chrono::milliseconds idleFor, Aws::String& host);
+
+    /**
+      * Number of handles created so far, at most maxSize.
+      */
+    unsigned GetPoolSize() const;
+    /**
+      * Connection counters per scheme://host[:port], recorded as handles are released.
+      */
+    Aws::Map<Aws::String, CurlHostConnectionStats> GetHostConnectionStats() const;
+
 private:
     CurlHandleContainer(const CurlHandleContainer&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&) = delete;
@@ -60,6 +110,10 @@ private:
 
     bool CheckAndGrowPool();
     void SetDefaultOptionsOnHandle(CURL* handle);
+    void RecordTransfer(CURL* handle);
+
+    static void LockShareData(CURL* handle, curl_lock_data data, curl_lock_access access, void* userp);
+    static void UnlockShareData(CURL* handle, curl_lock_data data, void* userp);
 
     Aws::Utils::ExclusiveOwnershipResourceManager<CURL*> m_handleContainer;
     unsigned m_maxPoolSize;
@@ -69,8 +123,17 @@ private:
     unsigned long m_tcpKeepAliveIntervalMs;
     unsigned long m_lowSpeedTime;
     unsigned long m_lowSpeedLimit;
+    unsigned long m_maxIdleConnectionTimeMs;
     unsigned m_poolSize;
-    std::mutex m_containerLock;
+    mutable std::mutex m_containerLock;
+    CURLSH* m_shareHandle;
+    std::mutex m_shareLocks[CURL_LOCK_DATA_LAST];
+    mutable std::mutex m_statsLock;
+    Aws::Map<Aws::String, CurlHostConnectionStats> m_hostStats;
+    //host and time of the last transfer that reached its host, per handle.
+    Aws::Map<CURL*, std::pair<Aws::String, std::chrono::steady_clock::time_point>> m_lastActivity;
+    //handles handed out by AcquireIdleCurlHandle and not yet released.
+    Aws::Set<CURL*> m_refreshingHandles;
 };
 
 } // namespace Http
@@ -18,10 +18,14 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/http/HttpClient.h>
+#include <aws/core/http/ResponseBodySink.h>
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace Aws
 {
@@ -32,6 +36,52 @@ namespace Standard
     class StandardHttpResponse;
 }
 
+/**
+ * State handed to the curl write and header callbacks for a single transfer. Must outlive the transfer.
+ */
+struct CurlWriteCallbackContext
+{
+    CurlWriteCallbackContext(const HttpClient* client,
+                             HttpRequest* request,
+                             HttpResponse* response,
+                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
+        m_client(client),
+        m_request(request),
+        m_response(response),
+        m_rateLimiter(rateLimiter),
+        m_numBytesResponseReceived(0),
+        m_curlHandle(nullptr),
+        m_bodySink(nullptr),
+        m_bodyStarted(false)
+    {}
+
+    const HttpClient* m_client;
+    HttpRequest* m_request;
+    HttpResponse* m_response;
+    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    int64_t m_numBytesResponseReceived;
+    CURL* m_curlHandle;
+    //set when the first body chunk arrives, nullptr means the body goes to the response stream.
+    ResponseBodySink* m_bodySink;
+    bool m_bodyStarted;
+};
+
+/**
+ * State handed to the curl read and seek callbacks for a single transfer. Must outlive the transfer.
+ */
+struct CurlReadCallbackContext
+{
+    CurlReadCallbackContext(const HttpClient* client, HttpRequest* request, Aws::Utils::RateLimits::RateLimiterInterface* limiter) :
+        m_client(client),
+        m_rateLimiter(limiter),
+        m_request(request)
+    {}
+
+    const HttpClient* m_client;
+    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    HttpRequest* m_request;
+};
+
 //Curl implementation of an http client. Right now it is only synchronous.
 class AWS_CORE_API CurlHttpClient: public HttpClient
 {
@@ -41,6 +91,8 @@ public:
 
     //Creates client, initializes curl handle if it hasn't been created already.
     CurlHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
+    //Stops refreshing idle connections.
+    ~CurlHttpClient();
     //Makes request and receives response synchronously
     AWS_DEPRECATED("This funciton in base class has been deprecated")
     std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
@@ -53,6 +105,34 @@ public:
     static void InitGlobalState();
     static void CleanupGlobalState();
 
+    /**
+     * Connection counters per scheme://host[:port] for the requests made by this client so far.
+     */
+    virtual Aws::Map<Aws::String, CurlHostConnectionStats> GetHostConnectionStats() const;
+
+    //Opens connections to endpoint in parallel, each one on its own pooled handle.
+    size_t WarmUp(const Aws::String& endpoint, size_t connections) const override;
+
+protected:
+    /**
+     * endpointOverride with the configured scheme in front, unless it already carries one.
+     */
+    static Aws::String EndpointWithScheme(const Aws::Client::ClientConfiguration& clientConfig);
+
+    /**
+     * Sets all per-request options (url, method, headers, callbacks, tls and proxy settings) on connectionHandle.
+     * Returns the header list installed on the handle; free it with curl_slist_free_all once the transfer is finished.
+     */
+    struct curl_slist* PrepareCurlHandle(CURL* connectionHandle, HttpRequest& request,
+        CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const;
+
+    /**
+     * Reads the outcome of a finished transfer from connectionHandle into response and records the connection metrics on request.
+     * response is reset to nullptr if the transfer failed.
+     */
+    void OnTransferComplete(CURL* connectionHandle, CURLcode curlResponseCode, HttpRequest& request,
+        std::shared_ptr<Standard::StandardHttpResponse>& response, const CurlWriteCallbackContext& writeContext) const;
+
 private:
     mutable CurlHandleContainer m_curlHandleContainer;
     bool m_isUsingProxy;
@@ -71,11 +151,22 @@ private:
     Aws::String m_caFile;
     bool m_disableExpectHeader;
     bool m_allowRedirects;
+    unsigned long m_idleConnectionRefreshIntervalMs;
+    std::mutex m_refreshLock;
+    std::condition_variable m_refreshSignal;
+    bool m_stopRefreshing;
+    std::thread m_refreshThread;
     static std::atomic<bool> isInit;
 
     void MakeRequestInternal(HttpRequest& request, std::shared_ptr<Standard::StandardHttpResponse>& response,
         Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, 
         Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const;
+    //Makes the request over connectionHandle, which it releases back to the pool.
+    void MakeRequestOnHandle(CURL* connectionHandle, HttpRequest& request, std::shared_ptr<Standard::StandardHttpResponse>& response,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const;
+    //Runs on m_refreshThread, sends a HEAD over every connection that has been idle for a whole refresh interval, one handle at a time.
+    void RefreshIdleConnections();
 
 
 };
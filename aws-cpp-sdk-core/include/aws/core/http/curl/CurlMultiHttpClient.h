@@ -0,0 +1,82 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+
+#if !defined(_WIN32)
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+ * Event driven Curl implementation of an http client.
+ * Instead of parking a caller thread inside curl_easy_perform for every request, all transfers are multiplexed over
+ * curl multi handles, each driven by a single event loop thread with curl_multi_socket_action (epoll on Linux, poll elsewhere).
+ * MakeAsyncRequest returns immediately, so thousands of concurrent requests only cost eventLoopThreads threads.
+ * MakeRequest remains available and blocks the caller until the transfer finishes.
+ *
+ * Body and header callbacks, rate limiters and the completion handler all run on the event loop thread.
+ * A blocking rate limiter or a slow handler therefore stalls every transfer on that loop.
+ */
+class AWS_CORE_API CurlMultiHttpClient: public CurlHttpClient
+{
+public:
+
+    using Base = CurlHttpClient;
+
+    //Creates client and starts its event loop threads.
+    CurlMultiHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
+    //Stops the event loops. Transfers still in flight complete with a nullptr response.
+    ~CurlMultiHttpClient();
+
+    //Makes request and receives response synchronously
+    AWS_DEPRECATED("This funciton in base class has been deprecated")
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    //Makes request with shared_ptr typed request and receives response synchronously
+    std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    //Queues request on one of the event loops and returns immediately. onResponseReceived is invoked on the event loop thread.
+    void MakeAsyncRequest(const std::shared_ptr<HttpRequest>& request, const AsyncResponseReceivedHandler& onResponseReceived,
+            Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    bool SupportsAsyncRequests() const override { return true; }
+
+    //Connection counters summed over all event loops.
+    Aws::Map<Aws::String, CurlHostConnectionStats> GetHostConnectionStats() const override;
+
+private:
+    class EventLoop;
+    struct Transfer;
+    friend class EventLoop;
+
+    Aws::Vector<EventLoop*> m_eventLoops;
+    mutable std::atomic<size_t> m_nextEventLoop;
+};
+
+} // namespace Http
+} // namespace Aws
+
+#endif // !defined(_WIN32)
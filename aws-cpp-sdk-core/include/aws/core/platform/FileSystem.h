@@ -171,6 +171,47 @@ namespace FileSystem
         DirectoryEntry m_directoryEntry;
     };
 
+    /**
+     * Read only view of length bytes of a file starting at offset, mapped into memory instead of read into a buffer.
+     * Pages are loaded on first access and can be dropped by the OS at any time, so mapping a region doesn't add to the resident size of the process.
+     * If the file can't be opened or mapped, or is shorter than offset + length, the bool operator returns false.
+     * The file must not be truncated while the region is mapped.
+     */
+    class AWS_CORE_API MappedFileRegion
+    {
+    public:
+        MappedFileRegion(const Aws::String& path, uint64_t offset, size_t length);
+        ~MappedFileRegion();
+
+        /**
+         * Rule of 5 stuff.
+         * Don't copy or move
+         */
+        MappedFileRegion(const MappedFileRegion&) = delete;
+        MappedFileRegion& operator =(const MappedFileRegion&) = delete;
+        MappedFileRegion(MappedFileRegion&&) = delete;
+        MappedFileRegion& operator =(MappedFileRegion&&) = delete;
+
+        /**
+         * If the region was mapped.
+         */
+        operator bool() const { return m_data != nullptr; }
+
+        /**
+         * First byte of the region. The memory is read only; writing to it crashes the process.
+         */
+        const unsigned char* GetData() const { return m_data; }
+
+        size_t GetLength() const { return m_length; }
+
+    private:
+        //the mapping starts at the page (allocation granularity on windows) boundary before offset.
+        void* m_mapping;
+        size_t m_mappingLength;
+        const unsigned char* m_data;
+        size_t m_length;
+    };
+
     class DirectoryTree;
 
     /**
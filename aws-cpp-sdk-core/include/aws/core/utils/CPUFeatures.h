@@ -0,0 +1,52 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+/**
+ * AWS_X86_SIMD is defined when the compiler can build SSSE3 and AVX2 code paths regardless of the target flags, so that they
+ * can be picked at runtime. Functions using those instructions must be marked with AWS_TARGET_SSSE3 or AWS_TARGET_AVX2.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define AWS_X86_SIMD 1
+#define AWS_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define AWS_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define AWS_X86_SIMD 1
+#define AWS_TARGET_SSSE3
+#define AWS_TARGET_AVX2
+#endif
+
+namespace Aws
+{
+namespace Utils
+{
+namespace CPUFeatures
+{
+    /**
+    * Whether the processor supports SSSE3. Always false when AWS_X86_SIMD is not defined.
+    */
+    AWS_CORE_API bool HasSSSE3();
+
+    /**
+    * Whether the processor and the operating system support AVX2. Always false when AWS_X86_SIMD is not defined.
+    */
+    AWS_CORE_API bool HasAVX2();
+
+} // namespace CPUFeatures
+} // namespace Utils
+} // namespace Aws
@@ -25,6 +25,10 @@ namespace Aws
 {
     namespace Utils
     {
+        namespace Threading
+        {
+            class Executor;
+        }
 
         /**
         * Generic utils for hashing strings
@@ -42,16 +46,38 @@ namespace Aws
             */
             static ByteBuffer Base64Decode(const Aws::String&);
 
+            /**
+            * Base64 encodes length bytes of data into output, which must have room for
+            * Base64::CalculateBase64EncodedLength(length) characters. Returns the number of characters written.
+            */
+            static size_t Base64Encode(const unsigned char* data, size_t length, char* output);
+
+            /**
+            * Base64 decodes length characters into output, which must have room for
+            * Base64::CalculateBase64DecodedLength(encoded, length) bytes. Returns the number of bytes written.
+            */
+            static size_t Base64Decode(const char* encoded, size_t length, unsigned char* output);
+
             /**
             * Hex encodes string
             */
             static Aws::String HexEncode(const ByteBuffer& byteBuffer);
 
+            /**
+            * Hex encodes length bytes of data into output, which must have room for 2 * length characters.
+            */
+            static void HexEncode(const unsigned char* data, size_t length, char* output);
+
             /**
             * Hex encodes string
             */
             static ByteBuffer HexDecode(const Aws::String& str);
 
+            /**
+            * Hex decodes length characters, without a 0x prefix, into output, which must have room for length / 2 bytes.
+            */
+            static void HexDecode(const char* encoded, size_t length, unsigned char* output);
+
             /**
             * Calculates a SHA256 HMAC digest (not hex encoded)
             */
@@ -77,6 +103,11 @@ namespace Aws
             */
             static ByteBuffer CalculateSHA256TreeHash(Aws::IOStream& stream);
 
+            /**
+            * Same as CalculateSHA256TreeHash(stream), with the 1MB leaves hashed in parallel on executor.
+            */
+            static ByteBuffer CalculateSHA256TreeHash(Aws::IOStream& stream, Aws::Utils::Threading::Executor* executor);
+
             /**
             * Calculates a MD5 Hash value
             */
@@ -89,6 +120,14 @@ namespace Aws
 
             static int HashString(const char* strToHash);
 
+            /**
+            * Same value as HashString, but usable in constant expressions such as case labels.
+            */
+            static constexpr int ConstexprHashString(const char* strToHash, unsigned hash = 0)
+            {
+                return *strToHash ? ConstexprHashString(strToHash + 1, static_cast<unsigned>(*strToHash) + 31 * hash) : static_cast<int>(hash);
+            }
+
         };
 
     } // namespace Utils
@@ -72,6 +72,35 @@ namespace Aws
                 return m_resources.size() > 0 && !m_shutdown.load();
             }
 
+            /**
+             * Acquires the first currently available resource that shouldAcquire returns true for, without blocking.
+             * It must be passed to Release when you are finished, just like the result of Acquire.
+             *
+             * @param shouldAcquire called with available resources while the pool is locked, so it must not call back into this container.
+             * @param resource set to the acquired resource, left alone if none was acquired.
+             * @return true if a resource was acquired.
+             */
+            template<typename PREDICATE>
+            bool TryAcquireIf(PREDICATE shouldAcquire, RESOURCE_TYPE& resource)
+            {
+                std::lock_guard<std::mutex> locker(m_queueLock);
+                if (m_shutdown.load())
+                {
+                    return false;
+                }
+
+                for (auto candidate = m_resources.begin(); candidate != m_resources.end(); ++candidate)
+                {
+                    if (shouldAcquire(*candidate))
+                    {
+                        resource = *candidate;
+                        m_resources.erase(candidate);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
             /**
              * Releases a resource back to the pool. This will unblock one waiting Acquire call if any are waiting.
              *
@@ -58,6 +58,18 @@ namespace Aws
                 */
                 ByteBuffer Decode(const Aws::String&) const;
 
+                /**
+                * Encode length bytes of data into output, which must have room for CalculateBase64EncodedLength(length)
+                * characters. No null terminator is written. Returns the number of characters written.
+                */
+                size_t Encode(const unsigned char* data, size_t length, char* output) const;
+
+                /**
+                * Decode length characters of base64 into output, which must have room for
+                * CalculateBase64DecodedLength(encoded, length) bytes. Returns the number of bytes written.
+                */
+                size_t Decode(const char* encoded, size_t length, unsigned char* output) const;
+
                 /**
                 * Calculates the required length of a base64 buffer after decoding the
                 * input string.
@@ -68,9 +80,14 @@ namespace Aws
                 */
                 static size_t CalculateBase64EncodedLength(const ByteBuffer& buffer);
 
+                static size_t CalculateBase64DecodedLength(const char* b64input, size_t length);
+                static size_t CalculateBase64EncodedLength(size_t length);
+
             private:
                 char m_mimeBase64EncodingTable[64];
                 uint8_t m_mimeBase64DecodingTable[256];
+                //the vectorized codecs only know the standard alphabet.
+                bool m_isMimeEncodingTable;
 
             };
 
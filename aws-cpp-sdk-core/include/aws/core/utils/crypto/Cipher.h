@@ -139,6 +139,22 @@ namespace Aws
                  */
                 virtual CryptoBuffer FinalizeDecryption () = 0;
 
+                /**
+                 * Same as EncryptBuffer, but writes the output to a buffer owned by the caller instead of allocating one, so that
+                 * streams can reuse their buffers. outputLength must be at least dataLength plus one block (16 bytes).
+                 * Returns the number of bytes written. On failure, returns 0 and the cipher is no longer good.
+                 * The default implementation calls EncryptBuffer and copies its output.
+                 */
+                virtual size_t EncryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength);
+
+                /**
+                 * Same as DecryptBuffer, but writes the output to a buffer owned by the caller instead of allocating one, so that
+                 * streams can reuse their buffers. outputLength must be at least dataLength plus one block (16 bytes).
+                 * Returns the number of bytes written. On failure, returns 0 and the cipher is no longer good.
+                 * The default implementation calls DecryptBuffer and copies its output.
+                 */
+                virtual size_t DecryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength);
+
                 virtual void Reset() = 0;
 
                 /**
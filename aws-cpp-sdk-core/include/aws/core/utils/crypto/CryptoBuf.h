@@ -95,8 +95,16 @@ namespace Aws
                 int_type underflow() override;
                 off_type ComputeAbsSeekPosition(off_type, std::ios_base::seekdir,  std::fpos<FPOS_TYPE>);
                 void FinalizeCipher();
+                /**
+                 * Reads up to readLength bytes from the src stream and runs them through the cipher, or finalizes the cipher at the end
+                 * of the stream. The output goes after the put back area of m_isBuf. Returns its length.
+                 */
+                size_t FillBuffer(size_t readLength);
 
+                //put back area followed by the cipher output. Allocated once and reused for every fill.
                 CryptoBuffer m_isBuf;
+                //what was read from the src stream.
+                CryptoBuffer m_srcBuf;
                 SymmetricCipher& m_cipher;
                 Aws::IStream& m_stream;
                 CipherMode m_cipherMode;
@@ -146,8 +154,14 @@ namespace Aws
                 int_type overflow(int_type ch) override;
                 int sync() override;
                 bool writeOutput(bool finalize);
+                /**
+                 * Writes all but the first skip bytes of data to the sink. Returns the number of bytes skipped.
+                 */
+                size_t WriteToStream(const unsigned char* data, size_t length, size_t skip);
 
                 CryptoBuffer m_osBuf;
+                //cipher output of m_osBuf, reused for every write.
+                CryptoBuffer m_cipherBuf;
                 SymmetricCipher& m_cipher;
                 Aws::OStream& m_stream;
                 CipherMode m_cipherMode;
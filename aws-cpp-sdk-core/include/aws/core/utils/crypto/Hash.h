@@ -46,8 +46,23 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) = 0;
 
+                /**
+                * Feeds bufferSize bytes into a running digest, finished by GetHash.
+                * A running digest is state on this object, so don't share one Hash between threads while feeding it.
+                * The default implementation keeps the bytes and hashes them in one Calculate call.
+                */
+                virtual void Update(const unsigned char* buffer, size_t bufferSize);
+
+                /**
+                * Finishes the running digest fed through Update and resets it so the object can start another one.
+                */
+                virtual HashResult GetHash();
+
                 // when hashing streams, this is the size of our internal buffer we read the stream into
                 static const uint32_t INTERNAL_HASH_STREAM_BUFFER_SIZE = 8192;
+
+            private:
+                Aws::String m_pendingBytes;
             };
 
             /**
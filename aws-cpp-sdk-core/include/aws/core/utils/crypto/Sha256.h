@@ -64,6 +64,16 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                /**
+                * Feeds bufferSize bytes into the running SHA256 digest.
+                */
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Finishes the running SHA256 digest (not hex encoded) and starts a new one.
+                */
+                virtual HashResult GetHash() override;
+
             private:
 
                 std::shared_ptr< Hash > m_hashImpl;
@@ -0,0 +1,110 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        }
+
+        namespace Crypto
+        {
+            /**
+             * SHA256 tree hash as used by Amazon Glacier (http://docs.aws.amazon.com/amazonglacier/latest/dev/checksum-calculations.html):
+             * the SHA256 of every 1MB of input, combined pairwise up to a single digest.
+             *
+             * Data can be fed with Update() as it streams, for example while an archive is being uploaded. Without an executor
+             * every 1MB leaf is hashed as its bytes arrive. With one, completed leaves are hashed on the executor while the
+             * caller keeps feeding data; at most maxLeavesInFlight 1MB buffers are held, and Update() blocks when all are in use.
+             */
+            class AWS_CORE_API Sha256TreeHash : public Hash
+            {
+            public:
+                static const size_t LEAF_SIZE = 1024 * 1024;
+
+                Sha256TreeHash();
+                /**
+                 * Hashes leaves on executor, which must outlive this object.
+                 */
+                Sha256TreeHash(Aws::Utils::Threading::Executor* executor, size_t maxLeavesInFlight = 16);
+                virtual ~Sha256TreeHash();
+
+                /**
+                 * Rule of 5 stuff.
+                 * Don't copy or move
+                 */
+                Sha256TreeHash(const Sha256TreeHash&) = delete;
+                Sha256TreeHash& operator =(const Sha256TreeHash&) = delete;
+                Sha256TreeHash(Sha256TreeHash&&) = delete;
+                Sha256TreeHash& operator =(Sha256TreeHash&&) = delete;
+
+                /**
+                * Calculates the tree hash of str (not hex encoded)
+                */
+                virtual HashResult Calculate(const Aws::String& str) override;
+
+                /**
+                * Calculates the tree hash of the entire stream, reading it straight into the leaf buffers.
+                * The stream position is restored afterwards.
+                */
+                virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Waits for the leaves in flight, finishes the tree hash (not hex encoded) and starts a new one.
+                */
+                virtual HashResult GetHash() override;
+
+            private:
+                void AcquireLeafBuffer();
+                void SubmitLeaf();
+                void FinishLeaf(size_t index, HashResult&& leafHash, ByteBuffer&& buffer);
+
+                Aws::Utils::Threading::Executor* m_executor;
+                size_t m_maxLeavesInFlight;
+
+                //without an executor the current leaf is hashed incrementally.
+                Sha256 m_leafHash;
+                //with one it is collected here first.
+                ByteBuffer m_leafBuffer;
+                size_t m_leafLength;
+
+                std::mutex m_mutex;
+                std::condition_variable m_leafFinished;
+                Aws::Vector<ByteBuffer> m_leafHashes;
+                Aws::Vector<ByteBuffer> m_freeBuffers;
+                size_t m_leavesInFlight;
+                bool m_failed;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
@@ -83,14 +83,27 @@ namespace Aws
             class Sha256OpenSSLImpl : public Hash
             {
             public:
-                Sha256OpenSSLImpl()
+                Sha256OpenSSLImpl() : m_runningCtx(nullptr)
                 { }
 
-                virtual ~Sha256OpenSSLImpl() = default;
+                virtual ~Sha256OpenSSLImpl();
+
+                Sha256OpenSSLImpl(const Sha256OpenSSLImpl&) = delete;
+                Sha256OpenSSLImpl& operator=(const Sha256OpenSSLImpl&) = delete;
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                EVP_MD_CTX* GetRunningContext();
+
+                // created on the first Update and reused for every running digest after that.
+                EVP_MD_CTX* m_runningCtx;
             };
 
             class Sha256HMACOpenSSLImpl : public HMAC
@@ -171,6 +184,16 @@ namespace Aws
                  */
                 CryptoBuffer FinalizeDecryption() override;
 
+                /**
+                 * Encrypts straight into output with EVP_EncryptUpdate.
+                 */
+                size_t EncryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength) override;
+
+                /**
+                 * Decrypts straight into output with EVP_DecryptUpdate.
+                 */
+                size_t DecryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength) override;
+
                 void Reset() override;
 
             protected:
@@ -350,6 +373,18 @@ namespace Aws
                 CryptoBuffer DecryptBuffer(const CryptoBuffer&) override;
                 CryptoBuffer FinalizeDecryption() override;
 
+                /**
+                 * Key wrap works on the whole key at once, so these go through EncryptBuffer/DecryptBuffer.
+                 */
+                size_t EncryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength) override
+                {
+                    return SymmetricCipher::EncryptToBuffer(data, dataLength, output, outputLength);
+                }
+                size_t DecryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength) override
+                {
+                    return SymmetricCipher::DecryptToBuffer(data, dataLength, output, outputLength);
+                }
+
                 void Reset() override;
 
             protected:
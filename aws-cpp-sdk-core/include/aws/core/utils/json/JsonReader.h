@@ -0,0 +1,131 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            /**
+             * Forward only JSON reader. Values are decoded straight from the stream, a chunk at a time, into whatever the caller
+             * stores them in; no DOM is built and the document is never held in memory as a whole.
+             *
+             * The caller walks the document in order, e.g. for an object:
+             *
+             *     if (reader.BeginObject())
+             *     {
+             *         while (reader.NextMember(name))
+             *         {
+             *             if (name == "Count") count = reader.ReadInteger();
+             *             else reader.SkipValue();
+             *         }
+             *     }
+             *
+             * Every member and element returned by NextMember or NextElement must be consumed by exactly one Read, Begin or SkipValue call.
+             * Reading a value as the wrong type skips it and returns the type's default, the same as JsonView does.
+             * After a syntax error every call returns false or a default value, so loops like the one above end by themselves.
+             */
+            class AWS_CORE_API JsonReader
+            {
+            public:
+                /**
+                 * stream must stay valid for the life of the reader.
+                 */
+                JsonReader(Aws::IStream& stream);
+
+                /**
+                 * Rule of 5 stuff.
+                 * Don't copy or move
+                 */
+                JsonReader(const JsonReader&) = delete;
+                JsonReader& operator =(const JsonReader&) = delete;
+                JsonReader(JsonReader&&) = delete;
+                JsonReader& operator =(JsonReader&&) = delete;
+
+                static const size_t BUFFER_SIZE = 8 * 1024;
+
+                /**
+                 * Enters the next value if it is an object. Otherwise skips the value and returns false.
+                 * An empty document also returns false, without an error.
+                 */
+                bool BeginObject();
+
+                /**
+                 * Moves to the next member of the innermost object and stores its name in name.
+                 * Members with a null value are passed over, so they read the same as missing members.
+                 * Returns false, and leaves the object, after the last member.
+                 */
+                bool NextMember(Aws::String& name);
+
+                /**
+                 * Enters the next value if it is an array. Otherwise skips the value and returns false.
+                 */
+                bool BeginArray();
+
+                /**
+                 * Moves to the next element of the innermost array. Returns false, and leaves the array, after the last element.
+                 */
+                bool NextElement();
+
+                Aws::String ReadString();
+                bool ReadBool();
+                int ReadInteger();
+                long long ReadInt64();
+                double ReadDouble();
+
+                /**
+                 * Skips the next value, including everything nested in it.
+                 */
+                void SkipValue();
+
+                bool WasParseSuccessful() const { return m_errorMessage.empty(); }
+
+                const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                int Peek();
+                int NextRawChar();
+                bool Refill();
+                bool ReadLiteral(const char* literal);
+                bool ParseString(Aws::String& value);
+                bool SkipString();
+                bool ParseHex4(uint32_t& codePoint);
+                bool ParseNumber(char* text, size_t capacity);
+                void Fail(const char* reason);
+
+                Aws::IStream& m_stream;
+                char m_buffer[BUFFER_SIZE];
+                size_t m_position;
+                size_t m_end;
+                //stream offset of m_buffer[0], for error messages.
+                uint64_t m_bufferOffset;
+                //true between Begin* and the first Next* of a container.
+                bool m_atContainerStart;
+                Aws::String m_errorMessage;
+            };
+
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
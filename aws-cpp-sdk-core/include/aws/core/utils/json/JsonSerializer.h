@@ -315,6 +315,28 @@ namespace Aws
                  */
                 Aws::Map<Aws::String, JsonView> GetAllObjects() const;
 
+                /**
+                 * Returns the first member of this object, or an invalid view if the object has no members.
+                 * Together with GetNextMember and GetMemberName this visits every member once, in document order, without
+                 * allocating; looking each key up with ValueExists and Get* searches the object from the start every time.
+                 */
+                JsonView GetFirstMember() const;
+
+                /**
+                 * Returns the member that follows this one in its object, or an invalid view after the last member.
+                 */
+                JsonView GetNextMember() const;
+
+                /**
+                 * Returns the key of this member, or nullptr if this view is not an object member.
+                 */
+                const char* GetMemberName() const;
+
+                /**
+                 * Tests whether this view refers to a value at all.
+                 */
+                bool IsValid() const { return m_value != nullptr; }
+
                 /**
                  * Tests whether a value exists at the current node level for the given key.
                  * Returns true if a value has been found and its value is not null, false otherwise.
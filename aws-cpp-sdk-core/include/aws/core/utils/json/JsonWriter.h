@@ -0,0 +1,111 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            /**
+             * Forward only JSON writer. Appends compact JSON text straight to a caller supplied string, so no DOM is built and
+             * nothing is allocated per value; the only allocations are the string growing. Clearing the string and handing it
+             * to the next writer reuses its capacity.
+             *
+             * The caller writes the document in order, e.g.:
+             *
+             *     Aws::String payload;
+             *     JsonWriter writer(payload);
+             *     writer.StartObject();
+             *     writer.WriteKey("Count");
+             *     writer.WriteInteger(count);
+             *     writer.EndObject();
+             *
+             * Separators are added automatically. The writer does not check that Start and End calls pair up or that every
+             * key is followed by a value; getting that right is up to the caller, the same as when building a JsonValue.
+             * Output matches JsonView::WriteCompact(), except that 64 bit integers are written exactly instead of through a double.
+             */
+            class AWS_CORE_API JsonWriter
+            {
+            public:
+                /**
+                 * Output is appended to buffer, which must stay valid for the life of the writer.
+                 */
+                JsonWriter(Aws::String& buffer);
+
+                /**
+                 * Rule of 5 stuff.
+                 * Don't copy or move
+                 */
+                JsonWriter(const JsonWriter&) = delete;
+                JsonWriter& operator =(const JsonWriter&) = delete;
+                JsonWriter(JsonWriter&&) = delete;
+                JsonWriter& operator =(JsonWriter&&) = delete;
+
+                void StartObject();
+                void EndObject();
+                void StartArray();
+                void EndArray();
+
+                /**
+                 * Writes the name of the next member of the current object. Must be followed by exactly one value.
+                 */
+                void WriteKey(const char* name);
+                void WriteKey(const Aws::String& name);
+
+                void WriteString(const char* value);
+                void WriteString(const Aws::String& value);
+                void WriteBool(bool value);
+                void WriteInteger(int value);
+                void WriteInt64(long long value);
+                /**
+                 * NaN and infinities are written as null, as JSON has no representation for them.
+                 */
+                void WriteDouble(double value);
+                void WriteNull();
+
+                /**
+                 * Writes value as a base64 encoded string.
+                 */
+                void WriteBase64(const ByteBuffer& value);
+
+                /**
+                 * Writes json, which must already be a complete JSON value, as is.
+                 */
+                void WriteRaw(const Aws::String& json);
+
+                const Aws::String& GetBuffer() const { return m_buffer; }
+
+            private:
+                void BeginValue();
+                void AppendEscaped(const char* value, size_t length);
+
+                Aws::String& m_buffer;
+                //true when the next key or value is not the first in its container and needs a comma in front.
+                bool m_needsSeparator;
+            };
+
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
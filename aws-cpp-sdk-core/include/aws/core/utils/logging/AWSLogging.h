@@ -16,6 +16,9 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/logging/LogLevel.h>
+
+#include <atomic>
 #include <memory>
 
 namespace Aws
@@ -43,6 +46,20 @@ namespace Aws
              */
             AWS_CORE_API LogSystemInterface* GetLogSystem();
 
+            /**
+             * Log level of the configured log system, or Off when there is none. The log macros test this before touching the log system,
+             * so a statement above it costs a single load and branch.
+             * It is refreshed whenever a log system is installed and by the SetLogLevel calls of the SDK's log systems.
+             */
+            extern AWS_CORE_API std::atomic<LogLevel> CachedLogLevel;
+
+            /**
+             * Re-reads the level of the configured log system into CachedLogLevel.
+             * Custom log systems whose GetLogLevel() can become more verbose at runtime must call this after the change,
+             * otherwise the newly enabled statements are filtered out by the macros.
+             */
+            AWS_CORE_API void RefreshCachedLogLevel();
+
             // Testing interface
 
             /**
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/logging/AWSLogging.h>
 #include <aws/core/utils/logging/LogSystemInterface.h>
 #include <aws/core/utils/logging/LogLevel.h>
 
@@ -48,7 +49,7 @@ namespace Aws
                 /**
                  * Set a new log level. This has the immediate effect of changing the log output to the new level.
                  */
-                void SetLogLevel(LogLevel logLevel) { m_logLevel.store(logLevel); }
+                void SetLogLevel(LogLevel logLevel) { m_logLevel.store(logLevel); RefreshCachedLogLevel(); }
 
                 /**
                  * Does a printf style output to ProcessFormattedStatement. Don't use this, it's unsafe. See LogStream
@@ -24,7 +24,7 @@
 
 // While macros are usually grotty, using them here lets us have a simple function call interface for logging that
 //
-//  (1) Can be compiled out completely, so you don't even have to pay the cost to check the log level (which will be a virtual function call and a std::atomic<> read) if you don't want any AWS logging
+//  (1) Can be compiled out completely, so you don't even have to pay the cost to check the log level (a std::atomic<> read of the cached log level) if you don't want any AWS logging
 //  (2) If you use logging and the log statement doesn't pass the conditional log filter level, not only do you not pay the cost of building the log string, you don't pay the cost for allocating or
 //      getting any of the values used in building the log string, as they're in a scope (if-statement) that never gets entered.
 
@@ -50,6 +50,17 @@
 
 #else
 
+    // Statements less severe than AWS_MINIMUM_LOG_LEVEL (the numeric value of a LogLevel, set through the MINIMUM_LOG_LEVEL CMake option)
+    // are compiled out: their condition is a constant false, so neither the level check nor the statement is generated.
+    // Statements that are compiled in first test the cached level of the log system, which is one load and a branch when they are filtered.
+    #ifndef AWS_MINIMUM_LOG_LEVEL
+        #define AWS_MINIMUM_LOG_LEVEL 6
+    #endif
+
+    #define AWS_LOG_LEVEL_ENABLED(level) \
+        ( static_cast<int>(level) <= AWS_MINIMUM_LOG_LEVEL && \
+          Aws::Utils::Logging::CachedLogLevel.load(std::memory_order_relaxed) >= level )
+
     #define AWS_LOG_FLUSH() \
         { \
             Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
@@ -61,143 +72,43 @@
 
     #define AWS_LOG(level, tag, ...) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= level ) \
-            { \
-                logSystem->Log(level, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_FATAL(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Fatal ) \
+            if ( AWS_LOG_LEVEL_ENABLED(level) ) \
             { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Fatal, tag, __VA_ARGS__); \
+                Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+                if ( logSystem && logSystem->GetLogLevel() >= level ) \
+                { \
+                    logSystem->Log(level, tag, __VA_ARGS__); \
+                } \
             } \
         }
 
-    #define AWS_LOG_ERROR(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Error ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Error, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_WARN(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Warn ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Warn, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_INFO(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Info ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Info, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_DEBUG(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Debug ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Debug, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_TRACE(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Trace ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Trace, tag, __VA_ARGS__); \
-            } \
-        }
+    #define AWS_LOG_FATAL(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Fatal, tag, __VA_ARGS__)
+    #define AWS_LOG_ERROR(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Error, tag, __VA_ARGS__)
+    #define AWS_LOG_WARN(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Warn, tag, __VA_ARGS__)
+    #define AWS_LOG_INFO(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Info, tag, __VA_ARGS__)
+    #define AWS_LOG_DEBUG(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Debug, tag, __VA_ARGS__)
+    #define AWS_LOG_TRACE(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Trace, tag, __VA_ARGS__)
 
     #define AWS_LOGSTREAM(level, tag, streamExpression) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= level ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( logLevel, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_FATAL(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Fatal ) \
+            if ( AWS_LOG_LEVEL_ENABLED(level) ) \
             { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Fatal, tag, logStream ); \
+                Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+                if ( logSystem && logSystem->GetLogLevel() >= level ) \
+                { \
+                    Aws::OStringStream logStream; \
+                    logStream << streamExpression; \
+                    logSystem->LogStream( level, tag, logStream ); \
+                } \
             } \
         }
 
-    #define AWS_LOGSTREAM_ERROR(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Error ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Error, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_WARN(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Warn ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Warn, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_INFO(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Info ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Info, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_DEBUG(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Debug ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Debug, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_TRACE(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Trace ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Trace, tag, logStream ); \
-            } \
-        }
+    #define AWS_LOGSTREAM_FATAL(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Fatal, tag, streamExpression)
+    #define AWS_LOGSTREAM_ERROR(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Error, tag, streamExpression)
+    #define AWS_LOGSTREAM_WARN(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Warn, tag, streamExpression)
+    #define AWS_LOGSTREAM_INFO(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Info, tag, streamExpression)
+    #define AWS_LOGSTREAM_DEBUG(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Debug, tag, streamExpression)
+    #define AWS_LOGSTREAM_TRACE(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Trace, tag, streamExpression)
 
     #define AWS_LOGSTREAM_FLUSH()  AWS_LOG_FLUSH()
 
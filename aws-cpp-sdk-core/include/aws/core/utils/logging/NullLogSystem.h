@@ -52,6 +52,8 @@ namespace Aws
                     AWS_UNREFERENCED_PARAM(tag);
                     AWS_UNREFERENCED_PARAM(messageStream);
                 }
+
+                virtual void Flush() override {}
             };
 
         } // namespace Logging
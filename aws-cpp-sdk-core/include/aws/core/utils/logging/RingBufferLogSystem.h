@@ -0,0 +1,149 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/logging/AWSLogging.h>
+#include <aws/core/utils/logging/LogSystemInterface.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * Log system for hosts that keep Debug or Trace logging on under load. Output format and file rolling are the same as DefaultLogSystem.
+             *
+             * Statements are copied as binary records into one of a set of ring buffers picked by thread id. Threads that map to the
+             * same ring spin on a flag of that ring for the length of one copy, so every ring has a single producer at a time; this is
+             * not lock-free, but logging threads never take a mutex shared by all of them or wait on the output. Nothing is formatted
+             * on the logging thread.
+             *
+             * A background thread drains the rings, merges their records by timestamp, formats them (reusing the formatted timestamp
+             * for every statement of the same second) and writes each pass to the output as one batch.
+             * When a ring is full the statement is dropped and counted in GetDroppedStatementCount() instead of making the logging
+             * thread wait for the drainer. Give the rings more room if that count grows.
+             */
+            class AWS_CORE_API RingBufferLogSystem : public LogSystemInterface
+            {
+            public:
+                /**
+                 * ringCount of 0 uses two rings per hardware thread (at most 64). Statements longer than half a ring are truncated.
+                 */
+                RingBufferLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile,
+                        size_t ringCount = 0, size_t ringBufferBytes = DEFAULT_RING_BUFFER_BYTES);
+
+                /**
+                 * Writes to filenamePrefix + "timestamp.log" and rolls the file every hour, like DefaultLogSystem.
+                 */
+                RingBufferLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix,
+                        size_t ringCount = 0, size_t ringBufferBytes = DEFAULT_RING_BUFFER_BYTES);
+
+                virtual ~RingBufferLogSystem();
+
+                /**
+                 * Rule of 5 stuff.
+                 * Don't copy or move
+                 */
+                RingBufferLogSystem(const RingBufferLogSystem&) = delete;
+                RingBufferLogSystem& operator =(const RingBufferLogSystem&) = delete;
+                RingBufferLogSystem(RingBufferLogSystem&&) = delete;
+                RingBufferLogSystem& operator =(RingBufferLogSystem&&) = delete;
+
+                static const size_t DEFAULT_RING_BUFFER_BYTES = 64 * 1024;
+
+                LogLevel GetLogLevel(void) const override { return m_logLevel; }
+
+                /**
+                 * Set a new log level. This has the immediate effect of changing the log output to the new level.
+                 */
+                void SetLogLevel(LogLevel logLevel) { m_logLevel.store(logLevel); RefreshCachedLogLevel(); }
+
+                /**
+                 * printf style statement, formatted straight into the ring.
+                 */
+                void Log(LogLevel logLevel, const char* tag, const char* formatStr, ...) override;
+
+                void LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream& messageStream) override;
+
+                /**
+                 * Blocks until every statement logged before the call has been written to the output.
+                 */
+                void Flush() override;
+
+                /**
+                 * Number of statements dropped so far because their ring was full.
+                 */
+                uint64_t GetDroppedStatementCount() const { return m_droppedStatements.load(std::memory_order_relaxed); }
+
+            private:
+                struct Ring;
+                struct RecordHeader;
+
+                Ring& AcquireRing();
+                void Append(LogLevel logLevel, const char* tag, const char* message, size_t messageLength, const char* formatStr, va_list* args);
+                void WakeDrainer();
+                void StartDrainer(size_t ringCount, size_t ringBufferBytes);
+                void RunDrainer();
+                void DrainOnce();
+                void FormatRecord(const RecordHeader& header, const char* tag, const char* message);
+                void WriteBatch();
+                void RollLogFileIfNeeded();
+
+                std::atomic<LogLevel> m_logLevel;
+                Aws::Vector<Ring*> m_rings;
+                std::atomic<uint64_t> m_droppedStatements;
+
+                std::mutex m_drainLock;
+                std::condition_variable m_drainSignal;
+                std::condition_variable m_flushSignal;
+                std::atomic<bool> m_drainerWaiting;
+                bool m_wakeRequested;
+                bool m_stopDraining;
+                uint64_t m_flushRequested;
+                uint64_t m_flushCompleted;
+                std::thread m_drainer;
+
+                //everything below is only touched by the drainer thread.
+                std::shared_ptr<Aws::OStream> m_log;
+                Aws::String m_filenamePrefix;
+                bool m_rollLog;
+                int32_t m_lastRolledHour;
+                Aws::String m_batch;
+                int64_t m_cachedSecond;
+                char m_cachedSecondText[32];
+                size_t m_cachedSecondLength;
+                Aws::Map<std::thread::id, Aws::String> m_threadIdText;
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,138 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            /**
+             * Memory system that puts everything allocated on a thread inside an ArenaScope into one arena: memory is handed out
+             * from large blocks by bumping a pointer, freeing it only drops a count, and the blocks go back to the underlying
+             * allocator in one go once everything allocated in the arena has been freed.
+             * Generated clients open an ArenaScope around decoding results with list or map members, so a page of DynamoDB items
+             * or S3 keys, with all its strings, maps and vectors, costs a handful of block allocations instead of one per value.
+             *
+             * Install it like any other memory system, through SDKOptions::memoryManagementOptions; the SDK must be built with
+             * custom memory management. Outside of an ArenaScope allocations go to the underlying allocator as usual.
+             * Every allocation carries a 16 byte header and is aligned to the requested alignment, at least to alignof(std::max_align_t).
+             *
+             * A value that is moved out of a decoded result keeps its whole arena alive until it is freed, so move out the
+             * few values you keep and copy the result of a paging loop rather than holding on to pages. The same goes for anything
+             * long lived that code running inside a scope allocates, e.g. a process wide cache; wrap such allocations in a
+             * SuspendArenaScope.
+             */
+            class AWS_CORE_API ArenaMemorySystem : public MemorySystemInterface
+            {
+            public:
+                /**
+                 * Blocks and allocations made outside of an ArenaScope come from underlying, or from malloc if it is null.
+                 */
+                ArenaMemorySystem(MemorySystemInterface* underlying = nullptr);
+
+                /**
+                 * Rule of 5 stuff.
+                 * Don't copy or move
+                 */
+                ArenaMemorySystem(const ArenaMemorySystem&) = delete;
+                ArenaMemorySystem& operator =(const ArenaMemorySystem&) = delete;
+                ArenaMemorySystem(ArenaMemorySystem&&) = delete;
+                ArenaMemorySystem& operator =(ArenaMemorySystem&&) = delete;
+
+                void Begin() override {}
+                void End() override {}
+
+                void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag = nullptr) override;
+                void FreeMemory(void* memoryPtr) override;
+
+                /**
+                 * Number of arenas that still have memory in use.
+                 */
+                size_t GetLiveArenaCount() const { return m_liveArenas.load(); }
+
+            private:
+                struct Arena;
+                struct AllocationHeader;
+                friend class ArenaScope;
+
+                Arena* CreateArena();
+                void* AllocateFromArena(Arena& arena, std::size_t blockSize, std::size_t alignment);
+                void ReleaseArena(Arena* arena);
+                void* AllocateRaw(std::size_t size, const char* allocationTag);
+                void FreeRaw(void* memoryPtr);
+
+                MemorySystemInterface* m_underlying;
+                std::atomic<size_t> m_liveArenas;
+            };
+
+            /**
+             * Puts what an ArenaMemorySystem allocates on this thread into one arena until the scope ends. Scopes nest; an inner
+             * scope shares the arena of the outer one. Without an ArenaMemorySystem installed a scope does nothing.
+             */
+            class AWS_CORE_API ArenaScope
+            {
+            public:
+                ArenaScope();
+                ~ArenaScope();
+
+                /**
+                 * Rule of 5 stuff.
+                 * Don't copy or move
+                 */
+                ArenaScope(const ArenaScope&) = delete;
+                ArenaScope& operator =(const ArenaScope&) = delete;
+                ArenaScope(ArenaScope&&) = delete;
+                ArenaScope& operator =(ArenaScope&&) = delete;
+            };
+
+            /**
+             * Sends what an ArenaMemorySystem allocates on this thread back to the underlying allocator until it ends, even inside
+             * an ArenaScope. Use it around allocations that outlive the scope, which would otherwise keep its whole arena alive.
+             * An ArenaScope opened inside it gets an arena of its own.
+             */
+            class AWS_CORE_API SuspendArenaScope
+            {
+            public:
+                SuspendArenaScope();
+                ~SuspendArenaScope();
+
+                /**
+                 * Rule of 5 stuff.
+                 * Don't copy or move
+                 */
+                SuspendArenaScope(const SuspendArenaScope&) = delete;
+                SuspendArenaScope& operator =(const SuspendArenaScope&) = delete;
+                SuspendArenaScope(SuspendArenaScope&&) = delete;
+                SuspendArenaScope& operator =(SuspendArenaScope&&) = delete;
+
+            private:
+                unsigned m_scopeDepth;
+                ArenaMemorySystem* m_system;
+                void* m_arena;
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,102 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <functional>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Runs tasks once their delay has elapsed. All pending tasks share a single timer thread ordered by deadline,
+            * so a waiting task costs a heap entry instead of a sleeping thread.
+            * Tasks run on the timer thread and should only hand work off (e.g. submit it to an executor), never block.
+            * The timer thread is started by the first call to Schedule.
+            * A task may stop its own queue but must not destroy it: the timer thread can't join itself, so that terminates.
+            */
+            class AWS_CORE_API DelayedTaskQueue
+            {
+            public:
+                DelayedTaskQueue();
+                ~DelayedTaskQueue();
+
+                /**
+                * Rule of 5 stuff.
+                * Don't copy or move
+                */
+                DelayedTaskQueue(const DelayedTaskQueue&) = delete;
+                DelayedTaskQueue& operator =(const DelayedTaskQueue&) = delete;
+                DelayedTaskQueue(DelayedTaskQueue&&) = delete;
+                DelayedTaskQueue& operator =(DelayedTaskQueue&&) = delete;
+
+                /**
+                * Queues task to run after delay. Tasks with the same deadline run in the order they were scheduled.
+                * Returns false if the queue has been stopped.
+                */
+                bool Schedule(std::chrono::milliseconds delay, std::function<void()>&& task);
+
+                /**
+                * Stops the timer thread, then runs every task that has not run yet on the calling thread, in deadline order,
+                * without waiting for its deadline. Safe to call more than once.
+                * Called from a task, it can't wait for the timer thread; that thread exits once the task returns and is
+                * joined by the destructor.
+                */
+                void Stop();
+
+                /**
+                * True once Stop has been called. A task that sees this is being run early by Stop.
+                */
+                bool IsStopped() const;
+
+                /**
+                * Number of tasks still waiting for their deadline.
+                */
+                size_t GetPendingTaskCount() const;
+
+            private:
+                struct DelayedTask
+                {
+                    std::chrono::steady_clock::time_point deadline;
+                    unsigned long long sequence;
+                    std::function<void()> task;
+                };
+
+                struct LaterDeadlineFirst
+                {
+                    bool operator()(const DelayedTask& lhs, const DelayedTask& rhs) const;
+                };
+
+                void Run();
+
+                mutable std::mutex m_lock;
+                std::condition_variable m_signal;
+                Aws::Vector<DelayedTask> m_tasks;
+                unsigned long long m_sequence;
+                bool m_stopped;
+                std::thread m_thread;
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
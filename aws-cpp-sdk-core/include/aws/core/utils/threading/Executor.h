@@ -20,7 +20,9 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/threading/DelayedTaskQueue.h>
 #include <functional>
+#include <chrono>
 #include <future>
 #include <mutex>
 #include <atomic>
@@ -52,11 +54,27 @@ namespace Aws
                     return SubmitToThread(std::move(callable));
                 }
 
+                /**
+                 * Send function and its arguments to the SubmitToThread function once delay has elapsed.
+                 */
+                template<class Fn, class ... Args>
+                bool SubmitAfter(std::chrono::milliseconds delay, Fn&& fn, Args&& ... args)
+                {
+                    std::function<void()> callable{ std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...) };
+                    return SubmitToThreadAfter(delay, std::move(callable));
+                }
+
             protected:
                 /**
                 * To implement your own executor implementation, then simply subclass Executor and implement this method.
                 */
                 virtual bool SubmitToThread(std::function<void()>&&) = 0;
+
+                /**
+                * Default implementation submits a task that sleeps for delay before running, which holds a thread for the whole delay.
+                * Override to park the task on a timer instead, the built in executors use a DelayedTaskQueue.
+                */
+                virtual bool SubmitToThreadAfter(std::chrono::milliseconds delay, std::function<void()>&&);
             };
 
 
@@ -74,9 +92,11 @@ namespace Aws
                     Free, Locked, Shutdown
                 };
                 bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitToThreadAfter(std::chrono::milliseconds delay, std::function<void()>&&) override;
                 void Detach(std::thread::id id);
                 std::atomic<State> m_state;
                 Aws::UnorderedMap<std::thread::id, std::thread> m_threads;
+                DelayedTaskQueue m_delayedTasks;
             };
 
             enum class OverflowPolicy
@@ -105,6 +125,7 @@ namespace Aws
 
             protected:
                 bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitToThreadAfter(std::chrono::milliseconds delay, std::function<void()>&&) override;
 
             private:
                 Aws::Queue<std::function<void()>*> m_tasks;
@@ -113,6 +134,7 @@ namespace Aws
                 Aws::Vector<ThreadTask*> m_threadTaskHandles;
                 size_t m_poolSize;
                 OverflowPolicy m_overflowPolicy;
+                DelayedTaskQueue m_delayedTasks;
 
                 /**
                  * Once you call this, you are responsible for freeing the memory pointed to by task.
@@ -0,0 +1,142 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/DelayedTaskQueue.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <functional>
+#include <type_traits>
+#include <cstddef>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <new>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Thread pool executor built for wide fan out on many core hosts.
+            * Every worker owns a lock-free deque. Tasks submitted from a worker thread stay on that worker's deque,
+            * and tasks submitted from other threads are spread round robin over per-worker inboxes.
+            * Idle workers steal from the others before going to sleep, so no single queue lock is shared by all threads.
+            *
+            * Tasks are stored in recycled nodes with inline storage. Submit called on this type directly
+            * does not allocate a std::function. Tasks arriving through the Executor interface keep the std::function
+            * they came in, moved into the node.
+            *
+            * Tasks still queued when the executor is destroyed are discarded, same as PooledThreadExecutor.
+            */
+            class AWS_CORE_API WorkStealingThreadExecutor : public Executor
+            {
+            public:
+                /**
+                * poolSize of 0 starts one worker per hardware thread.
+                * pinThreadsToCores binds worker i to cpu i modulo the cpu count where the platform supports it (Linux); it is ignored elsewhere.
+                */
+                WorkStealingThreadExecutor(size_t poolSize = 0, bool pinThreadsToCores = false);
+                ~WorkStealingThreadExecutor();
+
+                /**
+                * Rule of 5 stuff.
+                * Don't copy or move
+                */
+                WorkStealingThreadExecutor(const WorkStealingThreadExecutor&) = delete;
+                WorkStealingThreadExecutor& operator =(const WorkStealingThreadExecutor&) = delete;
+                WorkStealingThreadExecutor(WorkStealingThreadExecutor&&) = delete;
+                WorkStealingThreadExecutor& operator =(WorkStealingThreadExecutor&&) = delete;
+
+                /**
+                * Same contract as Executor::Submit, but the bound callable is placed straight into a task node
+                * instead of being wrapped in a std::function first.
+                */
+                template<class Fn, class ... Args>
+                bool Submit(Fn&& fn, Args&& ... args)
+                {
+                    return Enqueue(MakeTask(std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...)));
+                }
+
+                size_t GetPoolSize() const { return m_workers.size(); }
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitToThreadAfter(std::chrono::milliseconds delay, std::function<void()>&&) override;
+
+            private:
+                static const size_t INLINE_TASK_SIZE = 64;
+
+                struct TaskNode;
+                struct Worker;
+
+                typedef void (*TaskInvoker)(void* storage);
+                typedef void (*TaskDestroyer)(void* storage);
+
+                template<typename F>
+                static void InvokeInline(void* storage) { (*static_cast<F*>(storage))(); }
+                template<typename F>
+                static void DestroyInline(void* storage) { static_cast<F*>(storage)->~F(); }
+                template<typename F>
+                static void InvokeHeap(void* storage) { (**static_cast<F**>(storage))(); }
+                template<typename F>
+                static void DestroyHeap(void* storage) { Aws::Delete(*static_cast<F**>(storage)); }
+
+                template<typename F>
+                TaskNode* MakeTask(F&& fn)
+                {
+                    typedef typename std::decay<F>::type Callable;
+                    TaskNode* node = AllocateTaskNode();
+                    void* storage = TaskStorage(node);
+                    if (sizeof(Callable) <= INLINE_TASK_SIZE && alignof(Callable) <= alignof(std::max_align_t))
+                    {
+                        new (storage) Callable(std::forward<F>(fn));
+                        SetTaskFunctions(node, &InvokeInline<Callable>, &DestroyInline<Callable>);
+                    }
+                    else
+                    {
+                        *static_cast<Callable**>(storage) = Aws::New<Callable>("WorkStealingThreadExecutor", std::forward<F>(fn));
+                        SetTaskFunctions(node, &InvokeHeap<Callable>, &DestroyHeap<Callable>);
+                    }
+                    return node;
+                }
+
+                static Worker*& CurrentWorker();
+                TaskNode* AllocateTaskNode();
+                static void* TaskStorage(TaskNode* node);
+                static void SetTaskFunctions(TaskNode* node, TaskInvoker invoker, TaskDestroyer destroyer);
+                void ReleaseTaskNode(TaskNode* node);
+                bool Enqueue(TaskNode* node);
+                void WakeOneWorker();
+                TaskNode* FindWork(Worker& worker);
+                bool HasQueuedWork() const;
+                void RunWorker(Worker* worker, bool pinThreadToCore);
+
+                Aws::Vector<Worker*> m_workers;
+                std::atomic<size_t> m_nextInbox;
+                std::atomic<bool> m_continue;
+                std::atomic<size_t> m_sleepingWorkers;
+                std::mutex m_parkLock;
+                std::condition_variable m_parkSignal;
+                DelayedTaskQueue m_delayedTasks;
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,138 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Xml
+        {
+            /**
+             * Forward only XML reader. Elements are read straight from the stream, a chunk at a time, and handed to the caller in
+             * document order; no DOM is built and the document is never held in memory as a whole.
+             *
+             * NextElement enters the next child element of the element the reader is in. The caller then finishes that element
+             * with exactly one of ReadText or SkipElement, or by calling NextElement until it returns false, e.g.:
+             *
+             *     while (reader.NextElement(name))
+             *     {
+             *         if (name == "Key") key = reader.ReadText();
+             *         else if (name == "Owner") owner = reader;
+             *         else reader.SkipElement();
+             *     }
+             *
+             * The first NextElement call enters the root element. Text is returned with entities decoded, the same as
+             * DecodeEscapedXmlText(XmlNode::GetText()) gives for elements that contain only text, except that a CDATA section
+             * reads as its content where the DOM keeps the markup.
+             * After a syntax error every call returns false or empty text, so loops like the one above end by themselves.
+             */
+            class AWS_CORE_API XmlReader
+            {
+            public:
+                /**
+                 * stream must stay valid for the life of the reader.
+                 */
+                XmlReader(Aws::IStream& stream);
+
+                /**
+                 * Rule of 5 stuff.
+                 * Don't copy or move
+                 */
+                XmlReader(const XmlReader&) = delete;
+                XmlReader& operator =(const XmlReader&) = delete;
+                XmlReader(XmlReader&&) = delete;
+                XmlReader& operator =(XmlReader&&) = delete;
+
+                static const size_t BUFFER_SIZE = 8 * 1024;
+
+                /**
+                 * Enters the next child element of the current element and stores its name in name.
+                 * Returns false, and leaves the current element, after its last child.
+                 */
+                bool NextElement(Aws::String& name);
+
+                /**
+                 * Returns the text of the current element and leaves it. Child elements are skipped.
+                 */
+                Aws::String ReadText();
+
+                /**
+                 * Leaves the current element, skipping everything left in it.
+                 */
+                void SkipElement();
+
+                /**
+                 * Returns the value of an attribute of the element NextElement last entered, or an empty string if it has none by that name.
+                 * Only valid until the next NextElement, ReadText or SkipElement call.
+                 */
+                Aws::String GetAttributeValue(const Aws::String& name) const;
+
+                bool WasParseSuccessful() const { return m_errorMessage.empty(); }
+
+                const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                enum class Token
+                {
+                    START_TAG,
+                    END_TAG,
+                    END_OF_DOCUMENT
+                };
+
+                Token ReadToken(Aws::String* text);
+                bool ReadStartTag();
+                bool ReadEndTag();
+                bool ReadName(Aws::String& name);
+                bool ReadAttributeValue(Aws::String& value);
+                void ReadEntity(Aws::String& value);
+                void SkipWhitespace();
+                bool SkipPast(const char* terminator, Aws::String* text);
+                bool SkipDeclaration();
+                void LeaveElement();
+                int Peek();
+                int NextRawChar();
+                bool Refill();
+                void Fail(const char* reason);
+
+                Aws::IStream& m_stream;
+                char m_buffer[BUFFER_SIZE];
+                size_t m_position;
+                size_t m_end;
+                //stream offset of m_buffer[0], for error messages.
+                uint64_t m_bufferOffset;
+                //names of the elements the reader is in, back to back; m_nameStarts has the offset of each.
+                Aws::String m_openElements;
+                Aws::Vector<size_t> m_nameStarts;
+                //true when the element last entered was written <name/> and has not been left yet.
+                bool m_elementIsEmpty;
+                //attribute names and values of the element last entered, in pairs. Entries past m_attributeCount are kept for reuse.
+                Aws::Vector<Aws::String> m_attributes;
+                size_t m_attributeCount;
+                Aws::String m_errorMessage;
+            };
+
+        } // namespace Xml
+    } // namespace Utils
+} // namespace Aws
@@ -31,6 +31,8 @@
 #include <aws/core/utils/event/EventMessage.h>
 #include <aws/core/utils/event/EventHeader.h>
 
+#include <algorithm>
+#include <cctype>
 #include <cstdio>
 #include <iomanip>
 #include <math.h>
@@ -80,47 +82,6 @@ namespace Aws
     }
 }
 
-static Aws::String CanonicalizeRequestSigningString(HttpRequest& request, bool urlEscapePath)
-{
-    request.CanonicalizeRequest();
-    Aws::StringStream signingStringStream;
-    signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
-
-    URI uriCpy = request.GetUri();
-    // Many AWS services do not decode the URL before calculating SignatureV4 on their end.
-    // This results in the signature getting calculated with a double encoded URL.
-    // That means we have to double encode it here for the signature to match on the service side.
-    if(urlEscapePath)
-    {
-        // RFC3986 is how we encode the URL before sending it on the wire.
-        auto rfc3986EncodedPath = URI::URLEncodePathRFC3986(uriCpy.GetPath());
-        uriCpy.SetPath(rfc3986EncodedPath);
-        // However, SignatureV4 uses this URL encoding scheme
-        signingStringStream << NEWLINE << uriCpy.GetURLEncodedPath() << NEWLINE;
-    }
-    else
-    {
-        // For the services that DO decode the URL first; we don't need to double encode it.
-        uriCpy.SetPath(uriCpy.GetURLEncodedPath());
-        signingStringStream << NEWLINE << uriCpy.GetPath() << NEWLINE;
-    }
-
-    if (request.GetQueryString().find('=') != std::string::npos)
-    {
-        signingStringStream << request.GetQueryString().substr(1) << NEWLINE;
-    }
-    else if (request.GetQueryString().size() > 1)
-    {
-        signingStringStream << request.GetQueryString().substr(1) << "=" << NEWLINE;
-    }
-    else
-    {
-        signingStringStream << NEWLINE;
-    }
-
-    return signingStringStream.str();
-}
-
 static Http::HeaderValueCollection CanonicalizeHeaders(Http::HeaderValueCollection&& headers)
 {
     Http::HeaderValueCollection canonicalHeaders;
@@ -155,6 +116,291 @@ static Http::HeaderValueCollection CanonicalizeHeaders(Http::HeaderValueCollecti
     return canonicalHeaders;
 }
 
+//Canonical request pieces are staged in a fixed buffer and fed to a running sha256 whenever it fills up,
+//so the canonical request is only built as a whole string when debug logging wants to print it.
+class CanonicalRequestHasher
+{
+public:
+    CanonicalRequestHasher(bool keepCopy) : m_used(0), m_keepCopy(keepCopy) {}
+
+    void Append(char c)
+    {
+        if (m_used == sizeof(m_buffer))
+        {
+            Flush();
+        }
+        m_buffer[m_used++] = c;
+    }
+
+    void Append(const char* data, size_t length)
+    {
+        if (length > sizeof(m_buffer) - m_used)
+        {
+            Flush();
+            if (length > sizeof(m_buffer))
+            {
+                Feed(data, length);
+                return;
+            }
+        }
+        std::memcpy(m_buffer + m_used, data, length);
+        m_used += length;
+    }
+
+    void Append(const Aws::String& str) { Append(str.c_str(), str.size()); }
+    void Append(const char* str) { Append(str, strlen(str)); }
+
+    Crypto::HashResult GetHash()
+    {
+        Flush();
+        return m_hash.GetHash();
+    }
+
+    const Aws::String& GetCopy() const { return m_copy; }
+
+private:
+    void Flush()
+    {
+        Feed(m_buffer, m_used);
+        m_used = 0;
+    }
+
+    void Feed(const char* data, size_t length)
+    {
+        if (length == 0)
+        {
+            return;
+        }
+        m_hash.Update(reinterpret_cast<const unsigned char*>(data), length);
+        if (m_keepCopy)
+        {
+            m_copy.append(data, length);
+        }
+    }
+
+    char m_buffer[1024];
+    size_t m_used;
+    bool m_keepCopy;
+    Crypto::Sha256 m_hash;
+    Aws::String m_copy;
+};
+
+static bool IsDebugLoggingEnabled()
+{
+#ifdef DISABLE_AWS_LOGGING
+    return false;
+#else
+    if (!AWS_LOG_LEVEL_ENABLED(LogLevel::Debug))
+    {
+        return false;
+    }
+    LogSystemInterface* logSystem = GetLogSystem();
+    return logSystem && logSystem->GetLogLevel() >= LogLevel::Debug;
+#endif
+}
+
+static void AppendHex(Aws::String& out, const ByteBuffer& bytes)
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    size_t offset = out.size();
+    out.resize(offset + 2 * bytes.GetLength());
+    for (size_t i = 0; i < bytes.GetLength(); ++i)
+    {
+        out[offset++] = HEX_DIGITS[bytes[i] >> 4];
+        out[offset++] = HEX_DIGITS[bytes[i] & 0x0f];
+    }
+}
+
+//same notion of whitespace as StringUtils::Trim.
+static bool IsSpace(char ch)
+{
+    int value = ch;
+    if (value < -1 || value > 255)
+    {
+        return false;
+    }
+
+    return ::isspace(value) != 0;
+}
+
+static void TrimRange(const char*& begin, const char*& end)
+{
+    while (begin < end && IsSpace(*begin))
+    {
+        ++begin;
+    }
+    while (end > begin && IsSpace(*(end - 1)))
+    {
+        --end;
+    }
+}
+
+//appends the method, path and query string lines of the canonical request.
+static void AppendCanonicalRequestLines(HttpRequest& request, bool urlEscapePath, CanonicalRequestHasher& canonicalRequest)
+{
+    request.CanonicalizeRequest();
+    canonicalRequest.Append(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod()));
+    canonicalRequest.Append('\n');
+
+    const Aws::String& path = request.GetUri().GetPath();
+    if (path.empty())
+    {
+        canonicalRequest.Append('/');
+    }
+    // Many AWS services do not decode the URL before calculating SignatureV4 on their end.
+    // This results in the signature getting calculated with a double encoded URL.
+    // That means we have to double encode it here for the signature to match on the service side.
+    else if(urlEscapePath)
+    {
+        // RFC3986 is how we encode the URL before sending it on the wire.
+        // However, SignatureV4 uses the URLEncodePath encoding scheme on top of that.
+        canonicalRequest.Append(URI::URLEncodePath(URI::URLEncodePathRFC3986(path)));
+    }
+    else
+    {
+        // For the services that DO decode the URL first; we don't need to double encode it.
+        canonicalRequest.Append(URI::URLEncodePath(path));
+    }
+    canonicalRequest.Append('\n');
+
+    const Aws::String& queryString = request.GetQueryString();
+    if (queryString.size() > 1)
+    {
+        canonicalRequest.Append(queryString.c_str() + 1, queryString.size() - 1);
+        if (queryString.find('=') == std::string::npos)
+        {
+            canonicalRequest.Append('=');
+        }
+    }
+    canonicalRequest.Append('\n');
+}
+
+//header value canonicalization: trimmed, multiline gets converted to line1,line2,etc... and duplicate spaces are converted to one.
+static void AppendCanonicalHeaderValue(const Aws::String& value, CanonicalRequestHasher& canonicalRequest)
+{
+    const char* begin = value.c_str();
+    const char* end = begin + value.size();
+    TrimRange(begin, end);
+
+    bool firstLine = true;
+    char previous = '\0';
+    while (begin < end)
+    {
+        const char* lineBegin = begin;
+        const char* lineEnd = std::find(begin, end, '\n');
+        begin = lineEnd == end ? end : lineEnd + 1;
+        if (lineBegin == lineEnd)
+        {
+            continue;
+        }
+
+        if (!firstLine)
+        {
+            TrimRange(lineBegin, lineEnd);
+            canonicalRequest.Append(',');
+            previous = ',';
+        }
+        firstLine = false;
+
+        for (const char* current = lineBegin; current < lineEnd; ++current)
+        {
+            if (*current != ' ' || previous != ' ')
+            {
+                canonicalRequest.Append(*current);
+            }
+            previous = *current;
+        }
+    }
+}
+
+static bool HeaderNamesNeedTrimming(const Http::HeaderValueCollection& headers)
+{
+    for (const auto& header : headers)
+    {
+        if (header.first.empty() || IsSpace(header.first.front()) || IsSpace(header.first.back()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static Http::HeaderValueCollection GetHeadersToCanonicalize(const HttpRequest& request)
+{
+    Http::HeaderValueCollection headers = request.GetHeaders();
+    //header names are normally stored trimmed already, only re-key the collection when they are not.
+    if (HeaderNamesNeedTrimming(headers))
+    {
+        return CanonicalizeHeaders(std::move(headers));
+    }
+    return headers;
+}
+
+template<typename ShouldSignHeaderFn>
+static Aws::String BuildSignedHeadersValue(const Http::HeaderValueCollection& headers, const ShouldSignHeaderFn& shouldSignHeader)
+{
+    Aws::String signedHeadersValue;
+    for (const auto& header : headers)
+    {
+        if (shouldSignHeader(header.first))
+        {
+            if (!signedHeadersValue.empty())
+            {
+                signedHeadersValue.push_back(';');
+            }
+            signedHeadersValue.append(header.first);
+        }
+    }
+    return signedHeadersValue;
+}
+
+//appends the canonical headers and the signed headers line of the canonical request, and returns the signed headers value.
+template<typename ShouldSignHeaderFn>
+static Aws::String AppendCanonicalHeaders(const Http::HeaderValueCollection& headers, const ShouldSignHeaderFn& shouldSignHeader,
+        CanonicalRequestHasher& canonicalRequest)
+{
+    for (const auto& header : headers)
+    {
+        if (shouldSignHeader(header.first))
+        {
+            canonicalRequest.Append(header.first);
+            canonicalRequest.Append(':');
+            AppendCanonicalHeaderValue(header.second, canonicalRequest);
+            canonicalRequest.Append('\n');
+        }
+    }
+
+    Aws::String signedHeadersValue = BuildSignedHeadersValue(headers, shouldSignHeader);
+    canonicalRequest.Append('\n');
+    canonicalRequest.Append(signedHeadersValue);
+    canonicalRequest.Append('\n');
+    return signedHeadersValue;
+}
+
+static Aws::String BuildStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate,
+        const Aws::String& canonicalRequestHash, const Aws::String& region, const Aws::String& serviceName)
+{
+    Aws::String stringToSign;
+    stringToSign.reserve(40 + dateValue.size() + simpleDate.size() + region.size() + serviceName.size() + canonicalRequestHash.size());
+    stringToSign.append(AWS_HMAC_SHA256).append(NEWLINE).append(dateValue).append(NEWLINE);
+    stringToSign.append(simpleDate).append("/").append(region).append("/").append(serviceName).append("/").append(AWS4_REQUEST);
+    stringToSign.append(NEWLINE).append(canonicalRequestHash);
+    return stringToSign;
+}
+
+//Authorization header value for AWS4-HMAC-SHA256.
+static Aws::String BuildAuthorizationHeader(const Aws::String& accessKeyId, const Aws::String& simpleDate, const Aws::String& region,
+        const Aws::String& serviceName, const Aws::String& signedHeadersValue, const Aws::String& signature)
+{
+    Aws::String authorization;
+    authorization.reserve(160 + accessKeyId.size() + region.size() + serviceName.size() + signedHeadersValue.size() + signature.size());
+    authorization.append(AWS_HMAC_SHA256).append(" ").append(CREDENTIAL).append(EQ).append(accessKeyId);
+    authorization.append("/").append(simpleDate).append("/").append(region).append("/").append(serviceName).append("/").append(AWS4_REQUEST);
+    authorization.append(", ").append(SIGNED_HEADERS).append(EQ).append(signedHeadersValue);
+    authorization.append(", ").append(SIGNATURE).append(EQ).append(signature);
+    return authorization;
+}
+
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
     const char* serviceName, const Aws::String& region, PayloadSigningPolicy signingPolicy, bool urlEscapePath) :
     m_includeSha256HashHeader(true),
@@ -179,6 +425,11 @@ AWSAuthV4Signer::~AWSAuthV4Signer()
 
 bool AWSAuthV4Signer::ShouldSignHeader(const Aws::String& header) const
 {
+    //header names coming from the request are already lower case, skip making a lower case copy for those.
+    if (std::none_of(header.cbegin(), header.cend(), [](char c) { return c >= 'A' && c <= 'Z'; }))
+    {
+        return m_unsignedHeaders.find(header) == m_unsignedHeaders.cend();
+    }
     return m_unsignedHeaders.find(Aws::Utils::StringUtils::ToLower(header.c_str())) == m_unsignedHeaders.cend();
 }
 
@@ -241,66 +492,34 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody
     Aws::String dateHeaderValue = now.ToGmtString(LONG_DATE_FORMAT_STR);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
-
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
-
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    if (!signedHeadersValue.empty())
-    {
-        signedHeadersValue.pop_back();
-    }
+    //generate the canonical request and compute sha256 on it as it is built.
+    CanonicalRequestHasher canonicalRequest(IsDebugLoggingEnabled());
+    AppendCanonicalRequestLines(request, m_urlEscapePath, canonicalRequest);
+    Aws::String signedHeadersValue = AppendCanonicalHeaders(GetHeadersToCanonicalize(request),
+            [this](const Aws::String& header) { return ShouldSignHeader(header); }, canonicalRequest);
+    canonicalRequest.Append(payloadHash);
 
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequest.GetCopy());
 
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
-
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(payloadHash);
-
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
-
-    //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
+    auto hashResult = canonicalRequest.GetHash();
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string");
-        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequestString << "\"");
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequest.GetCopy() << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    Aws::String cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
+    Aws::String cannonicalRequestHash;
+    AppendHex(cannonicalRequestHash, hashResult.GetResult());
     Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
 
     Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, cannonicalRequestHash, m_region,
             m_serviceName);
     auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate);
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << finalSignature;
-
-    auto awsAuthString = ss.str();
+    auto awsAuthString = BuildAuthorizationHeader(credentials.GetAWSAccessKeyId(), simpleDate, m_region, m_serviceName,
+            signedHeadersValue, finalSignature);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
@@ -342,72 +561,50 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
     Aws::String dateQueryValue = now.ToGmtString(LONG_DATE_FORMAT_STR);
     request.AddQueryStringParameter(Http::AWS_DATE_HEADER, dateQueryValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
-
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
-
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue(signedHeadersStream.str());
-    //remove that last semi-colon
-    if (!signedHeadersValue.empty())
-    {
-        signedHeadersValue.pop_back();
-    }
+    auto shouldSignHeader = [this](const Aws::String& header) { return ShouldSignHeader(header); };
+    auto headers = GetHeadersToCanonicalize(request);
+    //the signed headers go into the query string, so they are needed before the request lines are canonicalized.
+    Aws::String signedHeadersValue = BuildSignedHeadersValue(headers, shouldSignHeader);
 
     request.AddQueryStringParameter(X_AMZ_SIGNED_HEADERS, signedHeadersValue);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value: " << signedHeadersValue);
 
-    Aws::StringStream ss;
     Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
-    ss << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << region << "/" << serviceName << "/" << AWS4_REQUEST;
+    Aws::String credentialScope;
+    credentialScope.reserve(credentials.GetAWSAccessKeyId().size() + simpleDate.size() + strlen(region) + strlen(serviceName) + 16);
+    credentialScope.append(credentials.GetAWSAccessKeyId()).append("/").append(simpleDate)
+        .append("/").append(region).append("/").append(serviceName).append("/").append(AWS4_REQUEST);
 
     request.AddQueryStringParameter(X_AMZ_ALGORITHM, AWS_HMAC_SHA256);
-    request.AddQueryStringParameter(X_AMZ_CREDENTIAL, ss.str());
-    ss.str("");
+    request.AddQueryStringParameter(X_AMZ_CREDENTIAL, credentialScope);
 
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
     request.SetSigningRegion(region);
 
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
-
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
+    //generate the canonical request and compute sha256 on it as it is built.
+    CanonicalRequestHasher canonicalRequest(IsDebugLoggingEnabled());
+    AppendCanonicalRequestLines(request, m_urlEscapePath, canonicalRequest);
+    AppendCanonicalHeaders(headers, shouldSignHeader, canonicalRequest);
     if (ServiceRequireUnsignedPayload(serviceName))
     {
-        canonicalRequestString.append(UNSIGNED_PAYLOAD);
+        canonicalRequest.Append(UNSIGNED_PAYLOAD);
     }
     else
     {
-        canonicalRequestString.append(EMPTY_STRING_SHA256);
+        canonicalRequest.Append(EMPTY_STRING_SHA256);
     }
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequest.GetCopy());
 
-    //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
+    auto hashResult = canonicalRequest.GetHash();
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string");
-        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequestString << "\"");
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequest.GetCopy() << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    auto cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
+    Aws::String cannonicalRequestHash;
+    AppendHex(cannonicalRequestHash, hashResult.GetResult());
 
     auto stringToSign = GenerateStringToSign(dateQueryValue, simpleDate, cannonicalRequestHash, region, serviceName);
 
@@ -452,8 +649,6 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign,
 {
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Final String to sign: " << stringToSign);
 
-    Aws::StringStream ss;
-
     auto hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), key);
     if (!hashResult.IsSuccess())
     {
@@ -463,9 +658,8 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign,
     }
 
     //now we finally sign our request string with our hex encoded derived hash.
-    auto finalSigningDigest = hashResult.GetResult();
-
-    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
+    Aws::String finalSigningHash;
+    AppendHex(finalSigningHash, hashResult.GetResult());
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
 
     return finalSigningHash;
@@ -505,32 +699,32 @@ Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue,
         const Aws::String& canonicalRequestHash, const Aws::String& region, const Aws::String& serviceName) const
 {
     //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
-
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << region << "/"
-        << serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
-
-    return ss.str();
+    return BuildStringToSign(dateValue, simpleDate, canonicalRequestHash, region, serviceName);
 }
 
 ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey, const Aws::String& simpleDate) const
 {
-    Utils::Threading::ReaderLockGuard guard(m_partialSignatureLock);
-    if (m_currentDateStr != simpleDate || m_currentSecretKey != secretKey)
+    return ComputeHash(secretKey, simpleDate, m_region, m_serviceName);
+}
+
+Aws::Utils::ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey,
+        const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const
+{
+    ByteBuffer derivedKey;
+    if (m_signingKeyCache.Get(secretKey, simpleDate, region, serviceName, derivedKey))
     {
-        guard.UpgradeToWriterLock();
-        // check again to prevent racing writers
-        if (m_currentDateStr != simpleDate || m_currentSecretKey != secretKey)
-        {
-            m_currentSecretKey = secretKey;
-            m_currentDateStr = simpleDate;
-            m_partialSignature = ComputeHash(m_currentSecretKey, m_currentDateStr, m_region, m_serviceName);
-        }
+        return derivedKey;
+    }
+
+    derivedKey = DeriveSigningKey(secretKey, simpleDate, region, serviceName);
+    if (derivedKey.GetLength() > 0)
+    {
+        m_signingKeyCache.Put(secretKey, simpleDate, region, serviceName, derivedKey);
     }
-    return m_partialSignature;
+    return derivedKey;
 }
 
-Aws::Utils::ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey,
+Aws::Utils::ByteBuffer AWSAuthV4Signer::DeriveSigningKey(const Aws::String& secretKey,
         const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const
 {
     Aws::String signingKey(SIGNING_KEY);
@@ -605,66 +799,35 @@ bool AWSAuthEventStreamV4Signer::SignRequest(Aws::Http::HttpRequest& request, bo
     Aws::String dateHeaderValue = now.ToGmtString(LONG_DATE_FORMAT_STR);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
-
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Canonical Header String: " << canonicalHeadersString);
-
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    if (!signedHeadersValue.empty())
-    {
-        signedHeadersValue.pop_back();
-    }
+    //generate the canonical request and compute sha256 on it as it is built.
+    CanonicalRequestHasher canonicalRequest(IsDebugLoggingEnabled());
+    AppendCanonicalRequestLines(request, true/* m_urlEscapePath */, canonicalRequest);
+    Aws::String signedHeadersValue = AppendCanonicalHeaders(GetHeadersToCanonicalize(request),
+            [this](const Aws::String& header) { return ShouldSignHeader(header); }, canonicalRequest);
+    canonicalRequest.Append(EVENT_STREAM_CONTENT_SHA256);
 
     AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Signed Headers value:" << signedHeadersValue);
+    AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Canonical Request String: " << canonicalRequest.GetCopy());
 
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, true/* m_urlEscapePath */);
-
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(EVENT_STREAM_CONTENT_SHA256);
-
-    AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Canonical Request String: " << canonicalRequestString);
-
-    //now compute sha256 on that request string
-    auto hashResult = m_hash.Calculate(canonicalRequestString);
+    auto hashResult = canonicalRequest.GetHash();
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4StreamingLogTag, "Failed to hash (sha256) request string");
-        AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "The request string is: \"" << canonicalRequestString << "\"");
+        AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "The request string is: \"" << canonicalRequest.GetCopy() << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    Aws::String cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
+    Aws::String cannonicalRequestHash;
+    AppendHex(cannonicalRequestHash, hashResult.GetResult());
     Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
 
     Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, cannonicalRequestHash, m_region,
             m_serviceName);
-    auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate);
-
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << HashingUtils::HexEncode(finalSignature);
+    Aws::String finalSignature;
+    AppendHex(finalSignature, GenerateSignature(credentials, stringToSign, simpleDate));
 
-    auto awsAuthString = ss.str();
+    auto awsAuthString = BuildAuthorizationHeader(credentials.GetAWSAccessKeyId(), simpleDate, m_region, m_serviceName,
+            signedHeadersValue, finalSignature);
     AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
@@ -794,12 +957,7 @@ Aws::String AWSAuthEventStreamV4Signer::GenerateStringToSign(const Aws::String&
         const Aws::String& canonicalRequestHash, const Aws::String& region, const Aws::String& serviceName) const
 {
     //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
-
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << region << "/"
-        << serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
-
-    return ss.str();
+    return BuildStringToSign(dateValue, simpleDate, canonicalRequestHash, region, serviceName);
 }
 
 ByteBuffer AWSAuthEventStreamV4Signer::ComputeHash(const Aws::String& secretKey, const Aws::String& simpleDate) const
@@ -0,0 +1,188 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/SigningKeyCache.h>
+
+#include <cstring>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+static const size_t KEY_BYTES = SigningKeyCache::KEY_WORDS * sizeof(uint64_t);
+static const size_t DERIVED_KEY_BYTES = SigningKeyCache::DERIVED_KEY_WORDS * sizeof(uint64_t);
+static const size_t BUCKET_SIZE = 2;
+static const unsigned char KEY_MARKER = 1;
+
+static bool AppendKeyPart(const Aws::String& part, unsigned char* key, size_t& used)
+{
+    if (part.size() > 0xff || used + 1 + part.size() > KEY_BYTES)
+    {
+        return false;
+    }
+    key[used++] = static_cast<unsigned char>(part.size());
+    std::memcpy(key + used, part.data(), part.size());
+    used += part.size();
+    return true;
+}
+
+//packs the length prefixed parts into zero padded words. The leading marker byte keeps an empty slot from matching any key.
+//returns false when the parts don't fit in a slot.
+static bool EncodeKey(const Aws::String& secretKey, const Aws::String& simpleDate, const Aws::String& region,
+        const Aws::String& serviceName, uint64_t* keyWords, size_t& bucket)
+{
+    unsigned char key[KEY_BYTES] = {0};
+    size_t used = 0;
+    key[used++] = KEY_MARKER;
+    if (!AppendKeyPart(secretKey, key, used) || !AppendKeyPart(simpleDate, key, used) ||
+        !AppendKeyPart(region, key, used) || !AppendKeyPart(serviceName, key, used))
+    {
+        return false;
+    }
+    std::memcpy(keyWords, key, KEY_BYTES);
+
+    //FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < used; ++i)
+    {
+        hash ^= key[i];
+        hash *= 1099511628211ULL;
+    }
+    bucket = static_cast<size_t>(hash % (SigningKeyCache::SLOT_COUNT / BUCKET_SIZE));
+    return true;
+}
+
+SigningKeyCache::SigningKeyCache() : m_writeStamp(0)
+{
+    for (auto& slot : m_slots)
+    {
+        slot.sequence.store(0, std::memory_order_relaxed);
+        slot.writeStamp.store(0, std::memory_order_relaxed);
+        for (auto& word : slot.key)
+        {
+            word.store(0, std::memory_order_relaxed);
+        }
+        for (auto& word : slot.derivedKey)
+        {
+            word.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool SigningKeyCache::ReadSlot(const Slot& slot, const uint64_t* key, uint64_t* derivedKey) const
+{
+    uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence & 1)
+    {
+        return false;
+    }
+
+    bool matches = true;
+    for (size_t i = 0; i < KEY_WORDS && matches; ++i)
+    {
+        matches = slot.key[i].load(std::memory_order_relaxed) == key[i];
+    }
+    if (!matches)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < DERIVED_KEY_WORDS; ++i)
+    {
+        derivedKey[i] = slot.derivedKey[i].load(std::memory_order_relaxed);
+    }
+
+    //a writer that started after the first sequence read shows up as a changed sequence here.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+bool SigningKeyCache::Get(const Aws::String& secretKey, const Aws::String& simpleDate, const Aws::String& region,
+        const Aws::String& serviceName, ByteBuffer& derivedKey) const
+{
+    uint64_t key[KEY_WORDS];
+    size_t bucket = 0;
+    if (!EncodeKey(secretKey, simpleDate, region, serviceName, key, bucket))
+    {
+        return false;
+    }
+
+    uint64_t derivedKeyWords[DERIVED_KEY_WORDS];
+    for (size_t i = 0; i < BUCKET_SIZE; ++i)
+    {
+        if (ReadSlot(m_slots[bucket * BUCKET_SIZE + i], key, derivedKeyWords))
+        {
+            derivedKey = ByteBuffer(DERIVED_KEY_BYTES);
+            std::memcpy(derivedKey.GetUnderlyingData(), derivedKeyWords, DERIVED_KEY_BYTES);
+            return true;
+        }
+    }
+    return false;
+}
+
+void SigningKeyCache::Put(const Aws::String& secretKey, const Aws::String& simpleDate, const Aws::String& region,
+        const Aws::String& serviceName, const ByteBuffer& derivedKey)
+{
+    uint64_t key[KEY_WORDS];
+    size_t bucket = 0;
+    if (derivedKey.GetLength() != DERIVED_KEY_BYTES || !EncodeKey(secretKey, simpleDate, region, serviceName, key, bucket))
+    {
+        return;
+    }
+
+    //overwrite an entry with the same key if there is one, otherwise the entry of the bucket written least recently.
+    Slot* victim = nullptr;
+    uint64_t unused[DERIVED_KEY_WORDS];
+    for (size_t i = 0; i < BUCKET_SIZE && !victim; ++i)
+    {
+        if (ReadSlot(m_slots[bucket * BUCKET_SIZE + i], key, unused))
+        {
+            victim = &m_slots[bucket * BUCKET_SIZE + i];
+        }
+    }
+    if (!victim)
+    {
+        victim = &m_slots[bucket * BUCKET_SIZE];
+        for (size_t i = 1; i < BUCKET_SIZE; ++i)
+        {
+            Slot& candidate = m_slots[bucket * BUCKET_SIZE + i];
+            if (candidate.writeStamp.load(std::memory_order_relaxed) < victim->writeStamp.load(std::memory_order_relaxed))
+            {
+                victim = &candidate;
+            }
+        }
+    }
+
+    uint32_t sequence = victim->sequence.load(std::memory_order_relaxed);
+    //another writer owns the slot right now; skip caching rather than wait for it.
+    if ((sequence & 1) || !victim->sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed))
+    {
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint64_t derivedKeyWords[DERIVED_KEY_WORDS];
+    std::memcpy(derivedKeyWords, derivedKey.GetUnderlyingData(), DERIVED_KEY_BYTES);
+    for (size_t i = 0; i < KEY_WORDS; ++i)
+    {
+        victim->key[i].store(key[i], std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < DERIVED_KEY_WORDS; ++i)
+    {
+        victim->derivedKey[i].store(derivedKeyWords[i], std::memory_order_relaxed);
+    }
+    victim->writeStamp.store(++m_writeStamp, std::memory_order_relaxed);
+
+    victim->sequence.store(sequence + 2, std::memory_order_release);
+}
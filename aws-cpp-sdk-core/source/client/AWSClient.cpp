@@ -41,9 +41,12 @@
 #include <aws/core/http/URI.h>
 #include <aws/core/monitoring/MonitoringManager.h>
 #include <aws/core/utils/event/EventStream.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/DelayedTaskQueue.h>
 
 #include <cstring>
 #include <cassert>
+#include <future>
 
 using namespace Aws;
 using namespace Aws::Client;
@@ -86,7 +89,10 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_executor(configuration.executor),
+    m_retryTimer(Aws::MakeShared<Aws::Utils::Threading::DelayedTaskQueue>(AWS_CLIENT_LOG_TAG)),
+    m_asyncAttemptsInFlight(0)
 {
 }
 
@@ -101,10 +107,18 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_executor(configuration.executor),
+    m_retryTimer(Aws::MakeShared<Aws::Utils::Threading::DelayedTaskQueue>(AWS_CLIENT_LOG_TAG)),
+    m_asyncAttemptsInFlight(0)
 {
 }
 
+AWSClient::~AWSClient()
+{
+    DrainAsyncAttempts();
+}
+
 void AWSClient::DisableRequestProcessing() 
 { 
     m_httpClient->DisableRequestProcessing(); 
@@ -115,6 +129,16 @@ void AWSClient::EnableRequestProcessing()
     m_httpClient->EnableRequestProcessing();
 }
 
+size_t AWSClient::WarmUp(size_t connections) const
+{
+    if (m_warmUpEndpoint.empty())
+    {
+        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Cannot warm up connections, no endpoint has been set for this client.");
+        return 0;
+    }
+    return m_httpClient->WarmUp(m_warmUpEndpoint, connections);
+}
+
 Aws::Client::AWSAuthSigner* AWSClient::GetSignerByName(const char* name) const
 {
     const auto& signer =  m_signerProvider->GetSigner(name);
@@ -173,6 +197,19 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
     HttpMethod method,
     const char* signerName) const
 {
+    if (m_httpClient->SupportsAsyncRequests())
+    {
+        //run the attempts as continuations so retry backoff waits on the client's timer instead of this thread,
+        //then block on the final outcome. The caller keeps ownership of request until we return, so don't take it.
+        //no executor: the outcome only fulfils the promise, and this thread may well be one of the executor's.
+        std::shared_ptr<const Aws::AmazonWebServiceRequest> requestRef(&request, [](const Aws::AmazonWebServiceRequest*) {});
+        auto outcomePromise = Aws::MakeShared<std::promise<HttpResponseOutcome>>(AWS_CLIENT_LOG_TAG);
+        auto outcomeFuture = outcomePromise->get_future();
+        AttemptExhaustivelyAsync(uri, requestRef, method, signerName, nullptr,
+            [outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise->set_value(outcome); });
+        return outcomeFuture.get();
+    }
+
     std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
     HttpResponseOutcome outcome;
     Aws::Monitoring::CoreMetricsCollection coreMetrics;
@@ -288,6 +325,220 @@ static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& respo
 
 }
 
+struct AWSClient::AsyncAttemptContext
+{
+    Aws::Http::URI uri;
+    std::shared_ptr<const Aws::AmazonWebServiceRequest> request;
+    HttpMethod method;
+    const char* signerName;
+    //captured up front: a completion may arrive while a subclass destructor drains us, when the override is gone.
+    const char* serviceClientName;
+    std::shared_ptr<Aws::Utils::Threading::Executor> executor;
+    HttpResponseOutcomeReceivedHandler onOutcomeReceived;
+    std::shared_ptr<HttpRequest> httpRequest;
+    Aws::Monitoring::CoreMetricsCollection coreMetrics;
+    Aws::Vector<void*> monitoringContexts;
+    long retries;
+};
+
+void AWSClient::DrainAsyncAttempts()
+{
+    DisableRequestProcessing();
+    //runs the retries still waiting out their backoff now, and they fail because the timer is stopped.
+    m_retryTimer->Stop();
+
+    std::unique_lock<std::mutex> locker(m_asyncAttemptsLock);
+    m_asyncAttemptsDrained.wait(locker, [this]() { return m_asyncAttemptsInFlight == 0; });
+}
+
+bool AWSClient::HttpClientSupportsAsyncRequests() const
+{
+    return m_httpClient->SupportsAsyncRequests();
+}
+
+void AWSClient::AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    HttpMethod method,
+    const char* signerName,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    const HttpResponseOutcomeReceivedHandler& onOutcomeReceived) const
+{
+    {
+        std::lock_guard<std::mutex> locker(m_asyncAttemptsLock);
+        ++m_asyncAttemptsInFlight;
+    }
+
+    auto attemptContext = Aws::MakeShared<AsyncAttemptContext>(AWS_CLIENT_LOG_TAG);
+    attemptContext->uri = uri;
+    attemptContext->request = request;
+    attemptContext->method = method;
+    attemptContext->signerName = signerName;
+    attemptContext->serviceClientName = this->GetServiceClientName();
+    attemptContext->executor = executor;
+    attemptContext->onOutcomeReceived = onOutcomeReceived;
+    attemptContext->httpRequest = CreateHttpRequest(uri, method, request->GetResponseStreamFactory());
+    attemptContext->monitoringContexts = Aws::Monitoring::OnRequestStarted(attemptContext->serviceClientName, request->GetServiceRequestName(), attemptContext->httpRequest);
+    attemptContext->retries = 0;
+
+    AttemptOneRequestAsync(attemptContext);
+}
+
+void AWSClient::AttemptOneRequestAsync(const std::shared_ptr<AsyncAttemptContext>& attemptContext) const
+{
+    const Aws::AmazonWebServiceRequest& request = *attemptContext->request;
+    const std::shared_ptr<HttpRequest>& httpRequest = attemptContext->httpRequest;
+
+    BuildHttpRequest(request, httpRequest);
+    auto signer = GetSignerByName(attemptContext->signerName);
+    if (!signer->SignRequest(*httpRequest, request.SignBody()))
+    {
+        AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
+        HttpResponseOutcome outcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
+        OnAsyncAttemptCompleted(attemptContext, outcome);
+        return;
+    }
+
+    if (request.GetRequestSignedHandler())
+    {
+        request.GetRequestSignedHandler()(*httpRequest);
+    }
+
+    AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
+    m_httpClient->MakeAsyncRequest(httpRequest,
+        [this, attemptContext](const std::shared_ptr<HttpRequest>& completedRequest, const std::shared_ptr<HttpResponse>& httpResponse)
+        {
+            HttpResponseOutcome outcome = BuildHttpResponseOutcome(completedRequest, httpResponse);
+            OnAsyncAttemptCompleted(attemptContext, outcome);
+        },
+        m_readRateLimiter.get(), m_writeRateLimiter.get());
+}
+
+void AWSClient::OnAsyncAttemptCompleted(const std::shared_ptr<AsyncAttemptContext>& attemptContext, HttpResponseOutcome& outcome) const
+{
+    const Aws::AmazonWebServiceRequest& request = *attemptContext->request;
+    attemptContext->coreMetrics.httpClientMetrics = attemptContext->httpRequest->GetRequestMetrics();
+
+    bool retry = false;
+    long sleepMillis = 0;
+    bool shouldSleep = false;
+    if (outcome.IsSuccess())
+    {
+        Aws::Monitoring::OnRequestSucceeded(attemptContext->serviceClientName, request.GetServiceRequestName(), attemptContext->httpRequest, outcome,
+                attemptContext->coreMetrics, attemptContext->monitoringContexts);
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
+    }
+    else
+    {
+        Aws::Monitoring::OnRequestFailed(attemptContext->serviceClientName, request.GetServiceRequestName(), attemptContext->httpRequest, outcome,
+                attemptContext->coreMetrics, attemptContext->monitoringContexts);
+
+        if (!m_httpClient->IsRequestProcessingEnabled())
+        {
+            AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
+        }
+        else
+        {
+            sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), attemptContext->retries);
+            //AdjustClockSkew returns true means clock skew was the problem and skew was adjusted, false otherwise.
+            //sleep if clock skew was NOT the problem. AdjustClockSkew may update error inside outcome.
+            shouldSleep = !AdjustClockSkew(outcome, attemptContext->signerName);
+            retry = m_retryStrategy->ShouldRetry(outcome.GetError(), attemptContext->retries);
+        }
+    }
+
+    if (!retry)
+    {
+        Aws::Monitoring::OnFinish(attemptContext->serviceClientName, request.GetServiceRequestName(), attemptContext->httpRequest, attemptContext->monitoringContexts);
+        CompleteAsyncAttempt(attemptContext, outcome);
+        return;
+    }
+
+    AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
+    if (request.GetBody())
+    {
+        request.GetBody()->clear();
+        request.GetBody()->seekg(0);
+    }
+
+    if (request.GetRequestRetryHandler())
+    {
+        request.GetRequestRetryHandler()(request);
+    }
+
+    attemptContext->retries++;
+    auto nextAttempt = [this, attemptContext]()
+    {
+        attemptContext->httpRequest = CreateHttpRequest(attemptContext->uri, attemptContext->method, attemptContext->request->GetResponseStreamFactory());
+        Aws::Monitoring::OnRequestRetry(attemptContext->serviceClientName, attemptContext->request->GetServiceRequestName(), attemptContext->httpRequest,
+                attemptContext->monitoringContexts);
+        AttemptOneRequestAsync(attemptContext);
+    };
+
+    if (!shouldSleep || sleepMillis <= 0)
+    {
+        nextAttempt();
+        return;
+    }
+
+    //park the next attempt on the client's timer, not the executor. A synchronous caller may itself be sitting on
+    //an executor thread, so resuming through the executor could wait on the very thread that is blocked on us.
+    //sending the next attempt only signs and hands off to the http client, which is cheap enough for the timer thread.
+    auto retryTimer = m_retryTimer.get();
+    auto scheduled = retryTimer->Schedule(std::chrono::milliseconds(sleepMillis), [this, attemptContext, retryTimer, nextAttempt]()
+    {
+        if (retryTimer->IsStopped())
+        {
+            FailAsyncAttempt(attemptContext);
+            return;
+        }
+        nextAttempt();
+    });
+
+    if (!scheduled)
+    {
+        FailAsyncAttempt(attemptContext);
+    }
+}
+
+void AWSClient::FailAsyncAttempt(const std::shared_ptr<AsyncAttemptContext>& attemptContext) const
+{
+    AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Client is shutting down, abandoning retry of " << attemptContext->request->GetServiceRequestName());
+    HttpResponseOutcome outcome(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, "", "Client was destroyed while the request was waiting to be retried", false/*retryable*/));
+    Aws::Monitoring::OnFinish(attemptContext->serviceClientName, attemptContext->request->GetServiceRequestName(), attemptContext->httpRequest, attemptContext->monitoringContexts);
+    CompleteAsyncAttempt(attemptContext, outcome);
+}
+
+void AWSClient::CompleteAsyncAttempt(const std::shared_ptr<AsyncAttemptContext>& attemptContext, const HttpResponseOutcome& outcome) const
+{
+    //completions arrive on the http client's event loop. Parsing and user handlers run on the executor so a slow
+    //handler can't stall other transfers, and a synchronous call made from a handler can't wait on its own event loop.
+    //the handler only holds what it captured, so the attempt counts as done once it is handed off, and the handler
+    //is free to destroy the client.
+    auto onOutcomeReceived = attemptContext->onOutcomeReceived;
+    auto executor = attemptContext->executor;
+    bool submitted = false;
+    if (executor)
+    {
+        submitted = executor->Submit([onOutcomeReceived, outcome]() { onOutcomeReceived(outcome); });
+        if (!submitted)
+        {
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Executor rejected the completion of " << attemptContext->request->GetServiceRequestName() << ", running it inline.");
+        }
+    }
+
+    {
+        //notify under the lock, DrainAsyncAttempts may destroy the condition variable as soon as it sees zero.
+        std::lock_guard<std::mutex> locker(m_asyncAttemptsLock);
+        --m_asyncAttemptsInFlight;
+        m_asyncAttemptsDrained.notify_all();
+    }
+
+    if (!submitted)
+    {
+        onOutcomeReceived(outcome);
+    }
+}
+
 HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest,
     const Aws::AmazonWebServiceRequest& request, const char* signerName) const
 {
@@ -308,6 +559,12 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpReque
     std::shared_ptr<HttpResponse> httpResponse(
         m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
 
+    return BuildHttpResponseOutcome(httpRequest, httpResponse);
+}
+
+HttpResponseOutcome AWSClient::BuildHttpResponseOutcome(const std::shared_ptr<HttpRequest>& httpRequest,
+    const std::shared_ptr<HttpResponse>& httpResponse) const
+{
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
@@ -384,6 +641,29 @@ StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::Http::URI& u
     return StreamOutcome(httpResponseOutcome.GetError());
 }
 
+void AWSClient::MakeRequestWithUnparsedResponseAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    Http::HttpMethod method,
+    const char* signerName,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    const StreamOutcomeReceivedHandler& onOutcomeReceived) const
+{
+    AttemptExhaustivelyAsync(uri, request, method, signerName, executor,
+        [onOutcomeReceived](const HttpResponseOutcome& httpResponseOutcome)
+        {
+            if (httpResponseOutcome.IsSuccess())
+            {
+                onOutcomeReceived(StreamOutcome(AmazonWebServiceResult<Stream::ResponseStream>(
+                    httpResponseOutcome.GetResult()->SwapResponseStreamOwnership(),
+                    httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode())));
+            }
+            else
+            {
+                onOutcomeReceived(StreamOutcome(httpResponseOutcome.GetError()));
+            }
+        });
+}
+
 XmlOutcome AWSXMLClient::MakeRequestWithEventStream(const Aws::Http::URI& uri,
     const Aws::AmazonWebServiceRequest& request,
     Http::HttpMethod method,
@@ -520,6 +800,14 @@ void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
     httpRequest->SetDataSentEventHandler(request.GetDataSentEventHandler());
     httpRequest->SetContinueRequestHandle(request.GetContinueRequestHandler());
+    //an earlier attempt may have written part of a successful body before it failed. This attempt may not deliver a
+    //body at all, so start the sink over here rather than only when a successful body begins.
+    const auto& responseBodySink = request.GetResponseBodySink();
+    if (responseBodySink)
+    {
+        responseBodySink->Reset();
+    }
+    httpRequest->SetResponseBodySink(responseBodySink);
 
     request.AddQueryStringParameters(httpRequest->GetUri());
 }
@@ -708,6 +996,46 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
     return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
 }
 
+AWSJsonClient::~AWSJsonClient()
+{
+    //BuildAWSError is still ours here, in-flight completions need it.
+    DrainAsyncAttempts();
+}
+
+void AWSJsonClient::MakeRequestAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    Http::HttpMethod method,
+    const char* signerName,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    const JsonOutcomeReceivedHandler& onOutcomeReceived) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, signerName, executor,
+        [onOutcomeReceived](const HttpResponseOutcome& httpOutcome)
+        {
+            if (!httpOutcome.IsSuccess())
+            {
+                onOutcomeReceived(JsonOutcome(httpOutcome.GetError()));
+            }
+            else if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
+            {
+                JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
+                if (!jsonValue.WasParseSuccessful())
+                {
+                    onOutcomeReceived(JsonOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", jsonValue.GetErrorMessage(), false)));
+                    return;
+                }
+
+                onOutcomeReceived(JsonOutcome(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
+                    httpOutcome.GetResult()->GetHeaders(),
+                    httpOutcome.GetResult()->GetResponseCode())));
+            }
+            else
+            {
+                onOutcomeReceived(JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders())));
+            }
+        });
+}
+
 JsonOutcome AWSJsonClient::MakeEventStreamRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const
 {
     // request is assumed to be signed
@@ -838,6 +1166,48 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
     return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
 }
 
+AWSXMLClient::~AWSXMLClient()
+{
+    //BuildAWSError is still ours here, in-flight completions need it.
+    DrainAsyncAttempts();
+}
+
+void AWSXMLClient::MakeRequestAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    Http::HttpMethod method,
+    const char* signerName,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    const XmlOutcomeReceivedHandler& onOutcomeReceived) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, signerName, executor,
+        [onOutcomeReceived](const HttpResponseOutcome& httpOutcome)
+        {
+            if (!httpOutcome.IsSuccess())
+            {
+                onOutcomeReceived(XmlOutcome(httpOutcome.GetError()));
+                return;
+            }
+
+            if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
+            {
+                XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
+
+                if (!xmlDoc.WasParseSuccessful())
+                {
+                    AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Xml parsing for error failed with message " << xmlDoc.GetErrorMessage().c_str());
+                    onOutcomeReceived(XmlOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", xmlDoc.GetErrorMessage(), false)));
+                    return;
+                }
+
+                onOutcomeReceived(XmlOutcome(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
+                    httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode())));
+                return;
+            }
+
+            onOutcomeReceived(XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders())));
+        });
+}
+
 AWSError<CoreErrors> AWSXMLClient::BuildAWSError(const std::shared_ptr<Http::HttpResponse>& httpResponse) const
 {
     AWSError<CoreErrors> error;
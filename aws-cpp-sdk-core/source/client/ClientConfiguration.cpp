@@ -55,6 +55,9 @@ ClientConfiguration::ClientConfiguration() :
     enableTcpKeepAlive(true),
     tcpKeepAliveIntervalMs(30000),
     lowSpeedLimit(1),
+    maxIdleConnectionTimeMs(0),
+    connectionPoolWarmUpSize(0),
+    idleConnectionRefreshIntervalMs(0),
     retryStrategy(Aws::MakeShared<DefaultRetryStrategy>(CLIENT_CONFIG_TAG)),
     proxyScheme(Aws::Http::Scheme::HTTP),
     proxyPort(0),
@@ -63,6 +66,7 @@ ClientConfiguration::ClientConfiguration() :
     writeRateLimiter(nullptr),
     readRateLimiter(nullptr),
     httpLibOverride(Aws::Http::TransferLibType::DEFAULT_CLIENT),
+    eventLoopThreads(1),
     followRedirects(true),
     disableExpectHeader(false),
     enableClockSkewAdjustment(true),
@@ -15,6 +15,12 @@
 
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <thread>
 
 using namespace Aws;
 using namespace Aws::Http;
@@ -48,6 +54,59 @@ void HttpClient::RetryRequestSleep(std::chrono::milliseconds sleepTime)
     m_requestProcessingSignal.wait_for(signalLocker, sleepTime, [this](){ return m_disableRequestProcessing.load() == true; });
 }
 
+void HttpClient::MakeAsyncRequest(const std::shared_ptr<HttpRequest>& request,
+        const AsyncResponseReceivedHandler& onResponseReceived,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    std::shared_ptr<HttpResponse> response = MakeRequest(request, readLimiter, writeLimiter);
+    if (onResponseReceived)
+    {
+        onResponseReceived(request, response);
+    }
+}
+
+size_t HttpClient::WarmUp(const Aws::String& endpoint, size_t connections) const
+{
+    std::mutex completionLock;
+    std::condition_variable completionSignal;
+    size_t completed = 0;
+    size_t opened = 0;
+    auto onResponseReceived = [&](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+    {
+        std::lock_guard<std::mutex> locker(completionLock);
+        if (response && response->GetResponseCode() != HttpResponseCode::REQUEST_NOT_MADE)
+        {
+            ++opened;
+        }
+        ++completed;
+        completionSignal.notify_one();
+    };
+
+    //synchronous clients need a thread per request, otherwise each request would reuse the connection of the one before it.
+    Aws::Vector<std::thread> threads;
+    for (size_t i = 0; i < connections; ++i)
+    {
+        auto request = CreateHttpRequest(endpoint, HttpMethod::HTTP_HEAD, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        if (SupportsAsyncRequests())
+        {
+            MakeAsyncRequest(request, onResponseReceived);
+        }
+        else
+        {
+            threads.emplace_back([this, request, &onResponseReceived]() { onResponseReceived(request, MakeRequest(request)); });
+        }
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    std::unique_lock<std::mutex> locker(completionLock);
+    completionSignal.wait(locker, [&]() { return completed == connections; });
+    return opened;
+}
+
 bool HttpClient::ContinueRequest(const Aws::Http::HttpRequest& request) const
 {
     if (request.GetContinueRequestHandler())
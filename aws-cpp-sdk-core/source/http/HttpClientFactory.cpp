@@ -17,6 +17,8 @@
 
 #if ENABLE_CURL_CLIENT
 #include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <aws/core/client/ClientConfiguration.h>
 #include <signal.h>
 
 #elif ENABLE_WINDOWS_CLIENT
@@ -100,6 +102,13 @@ namespace Aws
                 }
 #endif // ENABLE_WINDOWS_IXML_HTTP_REQUEST_2_CLIENT
 #elif ENABLE_CURL_CLIENT
+#if !defined(_WIN32)
+                if (clientConfiguration.httpLibOverride == TransferLibType::CURL_MULTI_CLIENT)
+                {
+                    AWS_LOGSTREAM_INFO(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, "Creating curl multi http client.");
+                    return Aws::MakeShared<CurlMultiHttpClient>(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, clientConfiguration);
+                }
+#endif
                 return Aws::MakeShared<CurlHttpClient>(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, clientConfiguration);
 #else
                 // When neither of these clients is enabled, gcc gives a warning (converted
@@ -0,0 +1,79 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/ResponseBodySink.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+
+CallbackResponseBodySink::CallbackResponseBodySink(const ResponseBodyDataHandler& onData, const std::function<void()>& onReset) :
+    m_onData(onData),
+    m_onReset(onReset)
+{
+}
+
+void CallbackResponseBodySink::Reset()
+{
+    if (m_onReset)
+    {
+        m_onReset();
+    }
+}
+
+bool CallbackResponseBodySink::OnBodyData(const char* data, std::size_t length)
+{
+    return m_onData(data, length);
+}
+
+BufferResponseBodySink::BufferResponseBodySink(unsigned char* buffer, std::size_t length) :
+    m_buffer(buffer),
+    m_length(length),
+    m_bytesWritten(0)
+{
+}
+
+bool BufferResponseBodySink::OnBodyData(const char* data, std::size_t length)
+{
+    if (length > m_length - m_bytesWritten)
+    {
+        return false;
+    }
+
+    std::memcpy(m_buffer + m_bytesWritten, data, length);
+    m_bytesWritten += length;
+    return true;
+}
+
+namespace Aws
+{
+    namespace Http
+    {
+        ResponseBodySink* BeginResponseBody(const HttpRequest& request, const HttpResponse& response)
+        {
+            const auto& sink = request.GetResponseBodySink();
+            int responseCode = static_cast<int>(response.GetResponseCode());
+            if (!sink || responseCode < 200 || responseCode >= 300)
+            {
+                return nullptr;
+            }
+
+            sink->Reset();
+            return sink.get();
+        }
+    } // namespace Http
+} // namespace Aws
@@ -15,8 +15,10 @@
 
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #include <algorithm>
+#include <cstring>
 
 using namespace Aws::Utils::Logging;
 using namespace Aws::Http;
@@ -25,11 +27,26 @@ static const char* CURL_HANDLE_CONTAINER_TAG = "CurlHandleContainer";
 
 
 CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long httpRequestTimeout, long connectTimeout, bool enableTcpKeepAlive, 
-                                        unsigned long tcpKeepAliveIntervalMs, long lowSpeedTime, unsigned long lowSpeedLimit) :
+                                        unsigned long tcpKeepAliveIntervalMs, long lowSpeedTime, unsigned long lowSpeedLimit,
+                                        unsigned long maxIdleConnectionTimeMs) :
                 m_maxPoolSize(maxSize), m_httpRequestTimeout(httpRequestTimeout), m_connectTimeout(connectTimeout), m_enableTcpKeepAlive(enableTcpKeepAlive), 
-                m_tcpKeepAliveIntervalMs(tcpKeepAliveIntervalMs), m_lowSpeedTime(lowSpeedTime), m_lowSpeedLimit(lowSpeedLimit), m_poolSize(0)
+                m_tcpKeepAliveIntervalMs(tcpKeepAliveIntervalMs), m_lowSpeedTime(lowSpeedTime), m_lowSpeedLimit(lowSpeedLimit),
+                m_maxIdleConnectionTimeMs(maxIdleConnectionTimeMs), m_poolSize(0), m_shareHandle(curl_share_init())
 {
     AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Initializing CurlHandleContainer with size " << maxSize);
+
+    if (m_shareHandle)
+    {
+        curl_share_setopt(m_shareHandle, CURLSHOPT_LOCKFUNC, &CurlHandleContainer::LockShareData);
+        curl_share_setopt(m_shareHandle, CURLSHOPT_UNLOCKFUNC, &CurlHandleContainer::UnlockShareData);
+        curl_share_setopt(m_shareHandle, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+    else
+    {
+        AWS_LOGSTREAM_WARN(CURL_HANDLE_CONTAINER_TAG, "curl_share_init failed, handles will not share dns and tls session caches.");
+    }
 }
 
 CurlHandleContainer::~CurlHandleContainer()
@@ -40,6 +57,11 @@ CurlHandleContainer::~CurlHandleContainer()
         AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Cleaning up " << handle);
         curl_easy_cleanup(handle);
     }
+
+    if (m_shareHandle)
+    {
+        curl_share_cleanup(m_shareHandle);
+    }
 }
 
 CURL* CurlHandleContainer::AcquireCurlHandle()
@@ -62,6 +84,8 @@ void CurlHandleContainer::ReleaseCurlHandle(CURL* handle)
 {
     if (handle)
     {
+        RecordTransfer(handle);
+        //the share handle survives the reset, everything else goes back to the defaults.
         curl_easy_reset(handle);
         SetDefaultOptionsOnHandle(handle);
         AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Releasing curl handle " << handle);
@@ -86,6 +110,10 @@ bool CurlHandleContainer::CheckAndGrowPool()
 
             if (curlHandle)
             {
+                if (m_shareHandle)
+                {
+                    curl_easy_setopt(curlHandle, CURLOPT_SHARE, m_shareHandle);
+                }
                 SetDefaultOptionsOnHandle(curlHandle);
                 m_handleContainer.Release(curlHandle);
                 ++actuallyAdded;
@@ -124,4 +152,109 @@ void CurlHandleContainer::SetDefaultOptionsOnHandle(CURL* handle)
 #ifdef CURL_HAS_H2
     curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
 #endif
+#if LIBCURL_VERSION_NUM >= 0x074100
+    if (m_maxIdleConnectionTimeMs > 0)
+    {
+        //curl counts idle time in whole seconds, round up so a small non zero value does not mean "never reuse".
+        curl_easy_setopt(handle, CURLOPT_MAXAGE_CONN, static_cast<long>((m_maxIdleConnectionTimeMs + 999) / 1000));
+    }
+#endif
+}
+
+unsigned CurlHandleContainer::GetPoolSize() const
+{
+    std::lock_guard<std::mutex> locker(m_containerLock);
+    return m_poolSize;
+}
+
+Aws::Map<Aws::String, CurlHostConnectionStats> CurlHandleContainer::GetHostConnectionStats() const
+{
+    std::lock_guard<std::mutex> locker(m_statsLock);
+    return m_hostStats;
+}
+
+void CurlHandleContainer::RecordTransfer(CURL* handle)
+{
+    char* url = nullptr;
+    curl_easy_getinfo(handle, CURLINFO_EFFECTIVE_URL, &url);
+    if (!url || !*url)
+    {
+        return;
+    }
+
+    long newConnections = 0;
+    long responseCode = 0;
+    curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &newConnections);
+    curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &responseCode);
+
+    //key on scheme://authority, the path and query do not matter for connection reuse.
+    const char* authority = strstr(url, "://");
+    authority = authority ? authority + 3 : url;
+    size_t keyLength = authority - url + strcspn(authority, "/?#");
+
+    Aws::String host(url, keyLength);
+    std::lock_guard<std::mutex> locker(m_statsLock);
+    //a refresh only keeps the connection alive, it is not a transfer the caller made.
+    if (m_refreshingHandles.erase(handle) > 0)
+    {
+        if (newConnections > 0 || responseCode > 0)
+        {
+            m_lastActivity[handle] = std::make_pair(std::move(host), std::chrono::steady_clock::now());
+        }
+        else
+        {
+            //nothing left to keep alive, and refreshing it again would fail the same way.
+            m_lastActivity.erase(handle);
+        }
+        return;
+    }
+
+    CurlHostConnectionStats& stats = m_hostStats[host];
+    ++stats.requestCount;
+    if (newConnections > 0)
+    {
+        ++stats.newConnectionCount;
+    }
+    //no new connection and no response means the transfer never got anywhere, e.g. dns or connect failed.
+    else if (responseCode > 0)
+    {
+        ++stats.reusedConnectionCount;
+    }
+    else
+    {
+        return;
+    }
+    m_lastActivity[handle] = std::make_pair(std::move(host), std::chrono::steady_clock::now());
+}
+
+CURL* CurlHandleContainer::AcquireIdleCurlHandle(std::chrono::milliseconds idleFor, Aws::String& host)
+{
+    auto idleSince = std::chrono::steady_clock::now() - idleFor;
+    std::lock_guard<std::mutex> locker(m_statsLock);
+    CURL* handle = nullptr;
+    bool acquired = m_handleContainer.TryAcquireIf([&](CURL* candidate)
+    {
+        auto activity = m_lastActivity.find(candidate);
+        return activity != m_lastActivity.end() && activity->second.second <= idleSince;
+    }, handle);
+    if (!acquired)
+    {
+        return nullptr;
+    }
+    host = m_lastActivity[handle].first;
+    m_refreshingHandles.insert(handle);
+    return handle;
+}
+
+void CurlHandleContainer::LockShareData(CURL* handle, curl_lock_data data, curl_lock_access access, void* userp)
+{
+    AWS_UNREFERENCED_PARAM(handle);
+    AWS_UNREFERENCED_PARAM(access);
+    static_cast<CurlHandleContainer*>(userp)->m_shareLocks[data].lock();
+}
+
+void CurlHandleContainer::UnlockShareData(CURL* handle, curl_lock_data data, void* userp)
+{
+    AWS_UNREFERENCED_PARAM(handle);
+    static_cast<CurlHandleContainer*>(userp)->m_shareLocks[data].unlock();
 }
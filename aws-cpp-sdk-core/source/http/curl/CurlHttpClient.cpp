@@ -15,14 +15,18 @@
 
 #include <aws/core/http/curl/CurlHttpClient.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/DateTime.h>
 #include <aws/core/monitoring/HttpClientMetrics.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <cassert>
 #include <algorithm>
+#include <thread>
 
 
 using namespace Aws::Client;
@@ -130,39 +134,6 @@ static char* strdup_callback(const char* str)
 
 #endif
 
-struct CurlWriteCallbackContext
-{
-    CurlWriteCallbackContext(const CurlHttpClient* client,
-                             HttpRequest* request, 
-                             HttpResponse* response, 
-                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
-        m_client(client),
-        m_request(request),
-        m_response(response),
-        m_rateLimiter(rateLimiter),
-        m_numBytesResponseReceived(0)
-    {}
-
-    const CurlHttpClient* m_client;
-    HttpRequest* m_request;
-    HttpResponse* m_response;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
-    int64_t m_numBytesResponseReceived;
-};
-
-struct CurlReadCallbackContext
-{
-    CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request, Aws::Utils::RateLimits::RateLimiterInterface* limiter) :
-        m_client(client),
-        m_rateLimiter(limiter),
-        m_request(request)
-    {}
-
-    const CurlHttpClient* m_client;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
-    HttpRequest* m_request;
-};
-
 static const char* CURL_HTTP_CLIENT_TAG = "CurlHttpClient";
 
 static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
@@ -171,7 +142,7 @@ static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
     {
         CurlWriteCallbackContext* context = reinterpret_cast<CurlWriteCallbackContext*>(userdata);
 
-        const CurlHttpClient* client = context->m_client;
+        const HttpClient* client = context->m_client;
         if(!client->ContinueRequest(*context->m_request) || !client->IsRequestProcessingEnabled())
         {
             return 0;
@@ -184,7 +155,31 @@ static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
             context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
         }
 
-        response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        if (!context->m_bodyStarted)
+        {
+            //only successful bodies go to a sink, curl knows the final status by the time the body arrives.
+            if (context->m_request->GetResponseBodySink())
+            {
+                long responseCode = 0;
+                curl_easy_getinfo(context->m_curlHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+                response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+                context->m_bodySink = BeginResponseBody(*context->m_request, *response);
+            }
+            context->m_bodyStarted = true;
+        }
+
+        if (context->m_bodySink)
+        {
+            if (!context->m_bodySink->OnBodyData(ptr, sizeToWrite))
+            {
+                AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body sink rejected " << sizeToWrite << " bytes, aborting the transfer.");
+                return 0;
+            }
+        }
+        else
+        {
+            response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        }
         auto& receivedHandler = context->m_request->GetDataReceivedEventHandler();
         if (receivedHandler)
         {
@@ -226,7 +221,7 @@ static size_t ReadBody(char* ptr, size_t size, size_t nmemb, void* userdata)
         return 0;
     }
 
-    const CurlHttpClient* client = context->m_client;
+    const HttpClient* client = context->m_client;
     if(!client->ContinueRequest(*context->m_request) || !client->IsRequestProcessingEnabled())
     {
         return CURL_READFUNC_ABORT;
@@ -265,7 +260,7 @@ static size_t SeekBody(void* userdata, curl_off_t offset, int origin)
         return CURL_SEEKFUNC_FAIL;
     }
 
-    const CurlHttpClient* client = context->m_client;
+    const HttpClient* client = context->m_client;
     if(!client->ContinueRequest(*context->m_request) || !client->IsRequestProcessingEnabled())
     {
         return CURL_SEEKFUNC_FAIL;
@@ -431,7 +426,7 @@ int CurlDebugCallback(CURL *handle, curl_infotype type, char *data, size_t size,
 CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     Base(),   
     m_curlHandleContainer(clientConfig.maxConnections, clientConfig.httpRequestTimeoutMs, clientConfig.connectTimeoutMs, clientConfig.enableTcpKeepAlive,
-                          clientConfig.tcpKeepAliveIntervalMs, clientConfig.requestTimeoutMs, clientConfig.lowSpeedLimit),
+                          clientConfig.tcpKeepAliveIntervalMs, clientConfig.requestTimeoutMs, clientConfig.lowSpeedLimit, clientConfig.maxIdleConnectionTimeMs),
     m_isUsingProxy(!clientConfig.proxyHost.empty()), m_proxyUserName(clientConfig.proxyUserName),
     m_proxyPassword(clientConfig.proxyPassword), m_proxyScheme(SchemeMapper::ToString(clientConfig.proxyScheme)), m_proxyHost(clientConfig.proxyHost),
     m_proxySSLCertPath(clientConfig.proxySSLCertPath), m_proxySSLCertType(clientConfig.proxySSLCertType),
@@ -440,15 +435,129 @@ CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath),
     m_caFile(clientConfig.caFile), 
     m_disableExpectHeader(clientConfig.disableExpectHeader),
-    m_allowRedirects(clientConfig.followRedirects)
+    m_allowRedirects(clientConfig.followRedirects),
+    m_idleConnectionRefreshIntervalMs(clientConfig.idleConnectionRefreshIntervalMs),
+    m_stopRefreshing(false)
 {
+    size_t warmUpConnections = (std::min)(clientConfig.connectionPoolWarmUpSize, clientConfig.maxConnections);
+    if (warmUpConnections > 0 && !clientConfig.endpointOverride.empty())
+    {
+        WarmUp(EndpointWithScheme(clientConfig), warmUpConnections);
+    }
+
+    if (m_idleConnectionRefreshIntervalMs > 0)
+    {
+        m_refreshThread = std::thread(&CurlHttpClient::RefreshIdleConnections, this);
+    }
+}
+
+CurlHttpClient::~CurlHttpClient()
+{
+    if (m_refreshThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_refreshLock);
+            m_stopRefreshing = true;
+        }
+        m_refreshSignal.notify_one();
+        m_refreshThread.join();
+    }
+}
+
+Aws::String CurlHttpClient::EndpointWithScheme(const ClientConfiguration& clientConfig)
+{
+    const Aws::String& endpoint = clientConfig.endpointOverride;
+    if (endpoint.find("://") != Aws::String::npos)
+    {
+        return endpoint;
+    }
+    return SchemeMapper::ToString(clientConfig.scheme) + Aws::String("://") + endpoint;
+}
+
+size_t CurlHttpClient::WarmUp(const Aws::String& endpoint, size_t connections) const
+{
+    AWS_LOGSTREAM_INFO(CURL_HTTP_CLIENT_TAG, "Opening " << connections << " connections to " << endpoint);
+    size_t opened = Base::WarmUp(endpoint, connections);
+    AWS_LOGSTREAM_INFO(CURL_HTTP_CLIENT_TAG, "Opened " << opened << " of " << connections << " connections to " << endpoint);
+    return opened;
+}
+
+void CurlHttpClient::RefreshIdleConnections()
+{
+    auto interval = std::chrono::milliseconds(m_idleConnectionRefreshIntervalMs);
+    std::unique_lock<std::mutex> locker(m_refreshLock);
+    while (!m_refreshSignal.wait_for(locker, interval, [this]() { return m_stopRefreshing; }))
+    {
+        //a HEAD over each idle connection resets the server's idle timer; if the server already dropped it, curl reconnects.
+        //one handle is out of the pool at a time, so requests made meanwhile still find the others. A refreshed handle
+        //is no longer idle, so this ends once every handle was refreshed or was in use.
+        Aws::String host;
+        CURL* idleHandle = nullptr;
+        while (!m_stopRefreshing && (idleHandle = m_curlHandleContainer.AcquireIdleCurlHandle(interval, host)) != nullptr)
+        {
+            locker.unlock();
+            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Refreshing idle connection handle " << idleHandle << " to " << host);
+            auto request = CreateHttpRequest(host, HttpMethod::HTTP_HEAD, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            auto response = Aws::MakeShared<StandardHttpResponse>(CURL_HTTP_CLIENT_TAG, request);
+            MakeRequestOnHandle(idleHandle, *request, response, nullptr, nullptr);
+            locker.lock();
+        }
+    }
 }
 
+Aws::Map<Aws::String, CurlHostConnectionStats> CurlHttpClient::GetHostConnectionStats() const
+{
+    return m_curlHandleContainer.GetHostConnectionStats();
+}
 
 void CurlHttpClient::MakeRequestInternal(HttpRequest& request, 
         std::shared_ptr<StandardHttpResponse>& response,
         Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, 
         Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request.GetSize());
+    }
+
+    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+
+    if (connectionHandle)
+    {
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Obtained connection handle " << connectionHandle);
+        MakeRequestOnHandle(connectionHandle, request, response, readLimiter, writeLimiter);
+    }
+}
+
+void CurlHttpClient::MakeRequestOnHandle(CURL* connectionHandle, HttpRequest& request,
+        std::shared_ptr<StandardHttpResponse>& response,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
+    CurlReadCallbackContext readContext(this, &request, writeLimiter);
+    struct curl_slist* headers = PrepareCurlHandle(connectionHandle, request, writeContext, readContext);
+
+    Aws::Utils::DateTime startTransmissionTime = Aws::Utils::DateTime::Now();
+    CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
+    OnTransferComplete(connectionHandle, curlResponseCode, request, response, writeContext);
+
+    m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
+    //go ahead and flush the response body stream
+    if(response)
+    {
+        response->GetResponseBody().flush();
+    }
+    request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency), (DateTime::Now() - startTransmissionTime).count());
+
+    if (headers)
+    {
+        curl_slist_free_all(headers);
+    }
+}
+
+struct curl_slist* CurlHttpClient::PrepareCurlHandle(CURL* connectionHandle, HttpRequest& request,
+        CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const
 {
     URI uri = request.GetUri();
     Aws::String url = uri.GetURIString();
@@ -456,11 +565,6 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
     AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Making request to " << url);
     struct curl_slist* headers = NULL;
 
-    if (writeLimiter != nullptr)
-    {
-        writeLimiter->ApplyAndPayForCost(request.GetSize());
-    }
-
     Aws::StringStream headerStream;
     HeaderValueCollection requestHeaders = request.GetHeaders();
 
@@ -495,203 +599,186 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
         headers = curl_slist_append(headers, "Expect:");
     }
 
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
-
-    if (connectionHandle)
+    if (headers)
     {
-        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Obtained connection handle " << connectionHandle);
-
-        if (headers)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
-        }
-
-        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
-        CurlReadCallbackContext readContext(this, &request, writeLimiter);
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
+    }
 
-        SetOptCodeForHttpMethod(connectionHandle, request);
+    SetOptCodeForHttpMethod(connectionHandle, request);
 
-        curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, WriteData);
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, WriteHeader);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, response.get());
+    curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, WriteData);
+    writeContext.m_curlHandle = connectionHandle;
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, WriteHeader);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, writeContext.m_response);
 
-        //we only want to override the default path if someone has explicitly told us to.
-        if(!m_caPath.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
-        }
-        if(!m_caFile.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAINFO, m_caFile.c_str());
-        }
+    //we only want to override the default path if someone has explicitly told us to.
+    if(!m_caPath.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
+    }
+    if(!m_caFile.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAINFO, m_caFile.c_str());
+    }
 
-	// only set by android test builds because the emulator is missing a cert needed for aws services
+// only set by android test builds because the emulator is missing a cert needed for aws services
 #ifdef TEST_CERT_PATH
-	curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
+    curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
 #endif // TEST_CERT_PATH
 
-        if (m_verifySSL)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
+    if (m_verifySSL)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
 
 #if LIBCURL_VERSION_MAJOR >= 7
 #if LIBCURL_VERSION_MINOR >= 34
-            curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
 #endif //LIBCURL_VERSION_MINOR
 #endif //LIBCURL_VERSION_MAJOR
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
-        }
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
 
-        if (m_allowRedirects)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
-        }
+    if (m_allowRedirects)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
+    }
 
 #ifdef ENABLE_CURL_LOGGING
-        curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
-        curl_easy_setopt(connectionHandle, CURLOPT_DEBUGFUNCTION, CurlDebugCallback);
+    curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
+    curl_easy_setopt(connectionHandle, CURLOPT_DEBUGFUNCTION, CurlDebugCallback);
 #endif
-        if (m_isUsingProxy)
+    if (m_isUsingProxy)
+    {
+        Aws::StringStream ss;
+        ss << m_proxyScheme << "://" << m_proxyHost;
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, ss.str().c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
+        if (!m_proxyUserName.empty() || !m_proxyPassword.empty())
         {
-            Aws::StringStream ss;
-            ss << m_proxyScheme << "://" << m_proxyHost;
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, ss.str().c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
-            if (!m_proxyUserName.empty() || !m_proxyPassword.empty())
-            {
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
-            }
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
+        }
 #ifdef CURL_HAS_TLS_PROXY
-            if (!m_proxySSLCertPath.empty())
-            {
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERT, m_proxySSLCertPath.c_str());
-                if (!m_proxySSLCertType.empty())
-                {
-                    curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERTTYPE, m_proxySSLCertType.c_str());
-                }
-            }
-            if (!m_proxySSLKeyPath.empty())
+        if (!m_proxySSLCertPath.empty())
+        {
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERT, m_proxySSLCertPath.c_str());
+            if (!m_proxySSLCertType.empty())
             {
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEY, m_proxySSLKeyPath.c_str());
-                if (!m_proxySSLKeyType.empty())
-                {
-                    curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEYTYPE, m_proxySSLKeyType.c_str());
-                }
-                if (!m_proxyKeyPasswd.empty())
-                {
-                    curl_easy_setopt(connectionHandle, CURLOPT_PROXY_KEYPASSWD, m_proxyKeyPasswd.c_str());
-                }
+                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERTTYPE, m_proxySSLCertType.c_str());
             }
-#endif //CURL_HAS_TLS_PROXY
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, "");
-        }
-
-        if (request.GetContentBody())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, ReadBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
-            curl_easy_setopt(connectionHandle, CURLOPT_SEEKFUNCTION, SeekBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &readContext);
-        }
-        Aws::Utils::DateTime startTransmissionTime = Aws::Utils::DateTime::Now();
-        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
-        bool shouldContinueRequest = ContinueRequest(request);
-        if (curlResponseCode != CURLE_OK && shouldContinueRequest)
-        {
-            response = nullptr;
-            AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Curl returned error code " << curlResponseCode
-                    << " - " << curl_easy_strerror(curlResponseCode));
         }
-        else if(!shouldContinueRequest)
+        if (!m_proxySSLKeyPath.empty())
         {
-            response->SetResponseCode(HttpResponseCode::REQUEST_NOT_MADE);
-        }
-        else
-        {
-            long responseCode;
-            curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
-            response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
-            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned http response code " << responseCode);
-
-            char* contentType = nullptr;
-            curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
-            if (contentType)
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEY, m_proxySSLKeyPath.c_str());
+            if (!m_proxySSLKeyType.empty())
             {
-                response->SetContentType(contentType);
-                AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned content type " << contentType);
+                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEYTYPE, m_proxySSLKeyType.c_str());
             }
-
-            if (request.GetMethod() != HttpMethod::HTTP_HEAD &&
-                writeContext.m_client->IsRequestProcessingEnabled() &&
-                response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
+            if (!m_proxyKeyPasswd.empty())
             {
-                const Aws::String& contentLength = response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER);
-                int64_t numBytesResponseReceived = writeContext.m_numBytesResponseReceived;
-                AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response content-length header: " << contentLength);
-                AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response body length: " << numBytesResponseReceived);
-                if (StringUtils::ConvertToInt64(contentLength.c_str()) != numBytesResponseReceived)
-                {
-                    response = nullptr;
-                    AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body length doesn't match the content-length header.");
-                }
+                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_KEYPASSWD, m_proxyKeyPasswd.c_str());
             }
-
-            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Releasing curl handle " << connectionHandle);
         }
+#endif //CURL_HAS_TLS_PROXY
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, "");
+    }
 
-        double timep;
-        CURLcode ret = curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &timep); // DNS Resolve Latency, seconds.
-        if (ret == CURLE_OK)
-        {
-            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency), static_cast<int64_t>(timep * 1000));// to milliseconds
-        }
+    if (request.GetContentBody())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, ReadBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
+        curl_easy_setopt(connectionHandle, CURLOPT_SEEKFUNCTION, SeekBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &readContext);
+    }
 
-        ret = curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &timep); // Connect Latency 
-        if (ret == CURLE_OK)
-        {
-            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency), static_cast<int64_t>(timep * 1000));
-        }
+    return headers;
+}
 
-        ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &timep); // Ssl Latency
-        if (ret == CURLE_OK)
+void CurlHttpClient::OnTransferComplete(CURL* connectionHandle, CURLcode curlResponseCode, HttpRequest& request,
+        std::shared_ptr<StandardHttpResponse>& response, const CurlWriteCallbackContext& writeContext) const
+{
+    bool shouldContinueRequest = ContinueRequest(request);
+    if (curlResponseCode != CURLE_OK && shouldContinueRequest)
+    {
+        response = nullptr;
+        AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Curl returned error code " << curlResponseCode
+                << " - " << curl_easy_strerror(curlResponseCode));
+    }
+    else if(!shouldContinueRequest)
+    {
+        response->SetResponseCode(HttpResponseCode::REQUEST_NOT_MADE);
+    }
+    else
+    {
+        long responseCode;
+        curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+        response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned http response code " << responseCode);
+
+        char* contentType = nullptr;
+        curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
+        if (contentType)
         {
-            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
+            response->SetContentType(contentType);
+            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned content type " << contentType);
         }
 
-        const char* ip = nullptr;
-        auto curlGetInfoResult = curl_easy_getinfo(connectionHandle, CURLINFO_PRIMARY_IP, &ip); // Get the IP address of the remote endpoint
-        if (curlGetInfoResult == CURLE_OK && ip)
+        if (request.GetMethod() != HttpMethod::HTTP_HEAD &&
+            writeContext.m_client->IsRequestProcessingEnabled() &&
+            response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
         {
-            request.SetResolvedRemoteHost(ip);
+            const Aws::String& contentLength = response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER);
+            int64_t numBytesResponseReceived = writeContext.m_numBytesResponseReceived;
+            AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response content-length header: " << contentLength);
+            AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response body length: " << numBytesResponseReceived);
+            if (StringUtils::ConvertToInt64(contentLength.c_str()) != numBytesResponseReceived)
+            {
+                response = nullptr;
+                AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body length doesn't match the content-length header.");
+            }
         }
 
-        m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
-        //go ahead and flush the response body stream
-        if(response)
-        {
-            response->GetResponseBody().flush();
-        }
-        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency), (DateTime::Now() - startTransmissionTime).count());
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Releasing curl handle " << connectionHandle);
     }
 
-    if (headers)
+    double timep;
+    CURLcode ret = curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &timep); // DNS Resolve Latency, seconds.
+    if (ret == CURLE_OK)
     {
-        curl_slist_free_all(headers);
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency), static_cast<int64_t>(timep * 1000));// to milliseconds
+    }
+
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &timep); // Connect Latency 
+    if (ret == CURLE_OK)
+    {
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency), static_cast<int64_t>(timep * 1000));
+    }
+
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &timep); // Ssl Latency
+    if (ret == CURLE_OK)
+    {
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
+    }
+
+    const char* ip = nullptr;
+    auto curlGetInfoResult = curl_easy_getinfo(connectionHandle, CURLINFO_PRIMARY_IP, &ip); // Get the IP address of the remote endpoint
+    if (curlGetInfoResult == CURLE_OK && ip)
+    {
+        request.SetResolvedRemoteHost(ip);
     }
 }
 
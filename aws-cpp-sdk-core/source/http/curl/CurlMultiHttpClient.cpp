@@ -0,0 +1,594 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#if !defined(_WIN32)
+
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/monitoring/HttpClientMetrics.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#else
+#include <poll.h>
+#endif
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+using namespace Aws::Monitoring;
+
+static const char* CURL_MULTI_HTTP_CLIENT_TAG = "CurlMultiHttpClient";
+// Upper bound on a single wait so a missed timer callback can never wedge the loop.
+static const long MAX_EVENT_LOOP_WAIT_MS = 1000;
+static const int MAX_EVENTS_PER_WAIT = 256;
+
+namespace
+{
+
+/**
+ * Readiness notification for the sockets curl asks us to watch, plus the read end of a self-pipe used to wake the loop
+ * when new transfers are queued or the loop is shutting down.
+ */
+class SocketPoller
+{
+public:
+    SocketPoller() : m_pollFd(-1)
+    {
+        m_wakeFds[0] = m_wakeFds[1] = -1;
+        if (pipe(m_wakeFds) == 0)
+        {
+            fcntl(m_wakeFds[0], F_SETFL, fcntl(m_wakeFds[0], F_GETFL) | O_NONBLOCK);
+            fcntl(m_wakeFds[1], F_SETFL, fcntl(m_wakeFds[1], F_GETFL) | O_NONBLOCK);
+        }
+#ifdef __linux__
+        m_pollFd = epoll_create1(EPOLL_CLOEXEC);
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.fd = m_wakeFds[0];
+        epoll_ctl(m_pollFd, EPOLL_CTL_ADD, m_wakeFds[0], &event);
+#endif
+    }
+
+    ~SocketPoller()
+    {
+#ifdef __linux__
+        if (m_pollFd >= 0)
+        {
+            close(m_pollFd);
+        }
+#endif
+        for (int fd : m_wakeFds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+    }
+
+    bool IsValid() const
+    {
+#ifdef __linux__
+        return m_pollFd >= 0 && m_wakeFds[0] >= 0;
+#else
+        return m_wakeFds[0] >= 0;
+#endif
+    }
+
+    void Watch(curl_socket_t socket, bool readable, bool writable)
+    {
+#ifdef __linux__
+        epoll_event event;
+        event.events = 0;
+        event.events |= readable ? static_cast<uint32_t>(EPOLLIN) : 0u;
+        event.events |= writable ? static_cast<uint32_t>(EPOLLOUT) : 0u;
+        event.data.fd = socket;
+        if (epoll_ctl(m_pollFd, EPOLL_CTL_MOD, socket, &event) != 0 && errno == ENOENT)
+        {
+            epoll_ctl(m_pollFd, EPOLL_CTL_ADD, socket, &event);
+        }
+#else
+        m_sockets[socket] = static_cast<short>((readable ? POLLIN : 0) | (writable ? POLLOUT : 0));
+#endif
+    }
+
+    void Unwatch(curl_socket_t socket)
+    {
+#ifdef __linux__
+        epoll_event event;
+        epoll_ctl(m_pollFd, EPOLL_CTL_DEL, socket, &event);
+#else
+        m_sockets.erase(socket);
+#endif
+    }
+
+    void Wake()
+    {
+        char signal = 1;
+        ssize_t written = write(m_wakeFds[1], &signal, 1);
+        AWS_UNREFERENCED_PARAM(written); // a full pipe already guarantees a pending wake up.
+    }
+
+    /**
+     * Waits up to timeoutMs for socket activity and fills readySockets with (socket, CURL_CSELECT_* mask) pairs.
+     */
+    void Wait(long timeoutMs, Aws::Vector<std::pair<curl_socket_t, int>>& readySockets)
+    {
+        readySockets.clear();
+#ifdef __linux__
+        epoll_event events[MAX_EVENTS_PER_WAIT];
+        int count = epoll_wait(m_pollFd, events, MAX_EVENTS_PER_WAIT, static_cast<int>(timeoutMs));
+        for (int i = 0; i < count; ++i)
+        {
+            if (events[i].data.fd == m_wakeFds[0])
+            {
+                DrainWakeups();
+                continue;
+            }
+            int mask = 0;
+            mask |= (events[i].events & EPOLLIN) ? CURL_CSELECT_IN : 0;
+            mask |= (events[i].events & EPOLLOUT) ? CURL_CSELECT_OUT : 0;
+            mask |= (events[i].events & (EPOLLERR | EPOLLHUP)) ? CURL_CSELECT_ERR : 0;
+            curl_socket_t socket = events[i].data.fd;
+            readySockets.emplace_back(socket, mask);
+        }
+#else
+        m_pollFds.clear();
+        pollfd wakeFd = { m_wakeFds[0], POLLIN, 0 };
+        m_pollFds.push_back(wakeFd);
+        for (const auto& socket : m_sockets)
+        {
+            pollfd socketFd = { socket.first, socket.second, 0 };
+            m_pollFds.push_back(socketFd);
+        }
+        int count = poll(m_pollFds.data(), static_cast<nfds_t>(m_pollFds.size()), static_cast<int>(timeoutMs));
+        for (size_t i = 0; count > 0 && i < m_pollFds.size(); ++i)
+        {
+            if (m_pollFds[i].revents == 0)
+            {
+                continue;
+            }
+            --count;
+            if (i == 0)
+            {
+                DrainWakeups();
+                continue;
+            }
+            int mask = 0;
+            mask |= (m_pollFds[i].revents & POLLIN) ? CURL_CSELECT_IN : 0;
+            mask |= (m_pollFds[i].revents & POLLOUT) ? CURL_CSELECT_OUT : 0;
+            mask |= (m_pollFds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) ? CURL_CSELECT_ERR : 0;
+            readySockets.emplace_back(m_pollFds[i].fd, mask);
+        }
+#endif
+    }
+
+private:
+    void DrainWakeups()
+    {
+        char buffer[64];
+        while (read(m_wakeFds[0], buffer, sizeof(buffer)) > 0);
+    }
+
+    int m_pollFd;
+    int m_wakeFds[2];
+#ifndef __linux__
+    Aws::Map<curl_socket_t, short> m_sockets;
+    Aws::Vector<pollfd> m_pollFds;
+#endif
+};
+
+//the base client's own handle pool is never used here, so it must neither open nor refresh connections of its own.
+ClientConfiguration BaseClientConfiguration(const ClientConfiguration& clientConfig)
+{
+    ClientConfiguration baseConfig(clientConfig);
+    baseConfig.connectionPoolWarmUpSize = 0;
+    baseConfig.idleConnectionRefreshIntervalMs = 0;
+    return baseConfig;
+}
+
+} // namespace
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+ * Everything a single in-flight request needs while it lives on an event loop.
+ */
+struct CurlMultiHttpClient::Transfer
+{
+    Transfer(const CurlMultiHttpClient* client, const std::shared_ptr<HttpRequest>& req, const AsyncResponseReceivedHandler& handler,
+             Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) :
+        request(req),
+        response(Aws::MakeShared<StandardHttpResponse>(CURL_MULTI_HTTP_CLIENT_TAG, req)),
+        onResponseReceived(handler),
+        writeContext(client, req.get(), response.get(), readLimiter),
+        readContext(client, req.get(), writeLimiter),
+        handle(nullptr),
+        headers(nullptr)
+    {}
+
+    std::shared_ptr<HttpRequest> request;
+    std::shared_ptr<StandardHttpResponse> response;
+    AsyncResponseReceivedHandler onResponseReceived;
+    CurlWriteCallbackContext writeContext;
+    CurlReadCallbackContext readContext;
+    CURL* handle;
+    struct curl_slist* headers;
+    DateTime startTransmissionTime;
+};
+
+/**
+ * One curl multi handle and the thread that drives it. Transfers are handed over through a mutex protected queue,
+ * everything else is only ever touched from the loop thread.
+ */
+class CurlMultiHttpClient::EventLoop
+{
+public:
+    EventLoop(const CurlMultiHttpClient* client, const ClientConfiguration& clientConfig, long maxConnections) :
+        m_client(client),
+        m_handleContainer((std::numeric_limits<unsigned>::max)(), clientConfig.httpRequestTimeoutMs, clientConfig.connectTimeoutMs,
+                          clientConfig.enableTcpKeepAlive, clientConfig.tcpKeepAliveIntervalMs, clientConfig.requestTimeoutMs, clientConfig.lowSpeedLimit,
+                          clientConfig.maxIdleConnectionTimeMs),
+        m_multiHandle(curl_multi_init()),
+        m_hasTimeout(false),
+        m_running(true)
+    {
+        curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETFUNCTION, &EventLoop::OnSocket);
+        curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETDATA, this);
+        curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERFUNCTION, &EventLoop::OnTimer);
+        curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERDATA, this);
+        curl_multi_setopt(m_multiHandle, CURLMOPT_MAX_TOTAL_CONNECTIONS, maxConnections);
+        curl_multi_setopt(m_multiHandle, CURLMOPT_MAXCONNECTS, maxConnections);
+#ifdef CURLPIPE_MULTIPLEX
+        curl_multi_setopt(m_multiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+        m_thread = std::thread(&EventLoop::Run, this);
+    }
+
+    ~EventLoop()
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_pendingLock);
+            m_running = false;
+        }
+        m_poller.Wake();
+        m_thread.join();
+        curl_multi_cleanup(m_multiHandle);
+    }
+
+    void Submit(Transfer* transfer)
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_pendingLock);
+            if (m_running)
+            {
+                m_pending.push_back(transfer);
+                transfer = nullptr;
+            }
+        }
+
+        if (transfer)
+        {
+            AWS_LOGSTREAM_WARN(CURL_MULTI_HTTP_CLIENT_TAG, "Event loop is shutting down, failing request to " << transfer->request->GetURIString());
+            Complete(transfer, CURLE_ABORTED_BY_CALLBACK);
+            return;
+        }
+        m_poller.Wake();
+    }
+
+    Aws::Map<Aws::String, CurlHostConnectionStats> GetHostConnectionStats() const
+    {
+        return m_handleContainer.GetHostConnectionStats();
+    }
+
+private:
+    static int OnSocket(CURL* easy, curl_socket_t socket, int what, void* userp, void* socketp)
+    {
+        AWS_UNREFERENCED_PARAM(easy);
+        AWS_UNREFERENCED_PARAM(socketp);
+        auto loop = static_cast<EventLoop*>(userp);
+        if (what == CURL_POLL_REMOVE)
+        {
+            loop->m_poller.Unwatch(socket);
+        }
+        else
+        {
+            loop->m_poller.Watch(socket, (what & CURL_POLL_IN) != 0, (what & CURL_POLL_OUT) != 0);
+        }
+        return 0;
+    }
+
+    static int OnTimer(CURLM* multi, long timeoutMs, void* userp)
+    {
+        AWS_UNREFERENCED_PARAM(multi);
+        auto loop = static_cast<EventLoop*>(userp);
+        loop->m_hasTimeout = timeoutMs >= 0;
+        loop->m_timeoutDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs < 0 ? 0 : timeoutMs);
+        return 0;
+    }
+
+    void Run()
+    {
+        if (!m_multiHandle || !m_poller.IsValid())
+        {
+            AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "Failed to initialize curl multi event loop.");
+        }
+
+        Aws::Vector<std::pair<curl_socket_t, int>> readySockets;
+        while (StartPendingTransfers())
+        {
+            long waitMs = MAX_EVENT_LOOP_WAIT_MS;
+            if (m_hasTimeout)
+            {
+                auto untilDeadline = std::chrono::duration_cast<std::chrono::milliseconds>(m_timeoutDeadline - std::chrono::steady_clock::now()).count();
+                waitMs = (std::max)(0L, (std::min)(waitMs, static_cast<long>(untilDeadline)));
+            }
+
+            m_poller.Wait(waitMs, readySockets);
+
+            int runningHandles = 0;
+            for (const auto& readySocket : readySockets)
+            {
+                curl_multi_socket_action(m_multiHandle, readySocket.first, readySocket.second, &runningHandles);
+            }
+
+            if (m_hasTimeout && std::chrono::steady_clock::now() >= m_timeoutDeadline)
+            {
+                m_hasTimeout = false;
+                curl_multi_socket_action(m_multiHandle, CURL_SOCKET_TIMEOUT, 0, &runningHandles);
+            }
+
+            CompleteFinishedTransfers();
+        }
+
+        // Shutting down: fail whatever is still in flight so no caller waits forever.
+        for (Transfer* transfer : m_active)
+        {
+            curl_multi_remove_handle(m_multiHandle, transfer->handle);
+            Complete(transfer, CURLE_ABORTED_BY_CALLBACK);
+        }
+        m_active.clear();
+    }
+
+    // Moves queued transfers onto the multi handle. Returns false once the loop has been asked to stop.
+    bool StartPendingTransfers()
+    {
+        Aws::Vector<Transfer*> pending;
+        bool running;
+        {
+            std::lock_guard<std::mutex> locker(m_pendingLock);
+            pending.swap(m_pending);
+            running = m_running;
+        }
+
+        for (Transfer* transfer : pending)
+        {
+            if (!running)
+            {
+                Complete(transfer, CURLE_ABORTED_BY_CALLBACK);
+                continue;
+            }
+
+            transfer->handle = m_handleContainer.AcquireCurlHandle();
+            if (!transfer->handle)
+            {
+                AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "Could not obtain a connection handle, the request was not made.");
+                transfer->response->SetResponseCode(HttpResponseCode::REQUEST_NOT_MADE);
+                Complete(transfer, CURLE_FAILED_INIT);
+                continue;
+            }
+            AWS_LOGSTREAM_DEBUG(CURL_MULTI_HTTP_CLIENT_TAG, "Obtained connection handle " << transfer->handle);
+            transfer->headers = m_client->PrepareCurlHandle(transfer->handle, *transfer->request, transfer->writeContext, transfer->readContext);
+            curl_easy_setopt(transfer->handle, CURLOPT_PRIVATE, transfer);
+            transfer->startTransmissionTime = DateTime::Now();
+
+            CURLMcode addResult = curl_multi_add_handle(m_multiHandle, transfer->handle);
+            if (addResult != CURLM_OK)
+            {
+                AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "Curl multi returned error code " << addResult
+                        << " - " << curl_multi_strerror(addResult));
+                Complete(transfer, CURLE_FAILED_INIT);
+                continue;
+            }
+            m_active.push_back(transfer);
+        }
+
+        return running;
+    }
+
+    void CompleteFinishedTransfers()
+    {
+        int messagesLeft = 0;
+        while (CURLMsg* message = curl_multi_info_read(m_multiHandle, &messagesLeft))
+        {
+            if (message->msg != CURLMSG_DONE)
+            {
+                continue;
+            }
+
+            Transfer* transfer = nullptr;
+            curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, reinterpret_cast<char**>(&transfer));
+            CURLcode result = message->data.result;
+            curl_multi_remove_handle(m_multiHandle, message->easy_handle);
+            m_active.erase(std::remove(m_active.begin(), m_active.end(), transfer), m_active.end());
+            Complete(transfer, result);
+        }
+    }
+
+    void Complete(Transfer* transfer, CURLcode result)
+    {
+        if (transfer->handle)
+        {
+            m_client->OnTransferComplete(transfer->handle, result, *transfer->request, transfer->response, transfer->writeContext);
+            m_handleContainer.ReleaseCurlHandle(transfer->handle);
+            transfer->request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency),
+                    (DateTime::Now() - transfer->startTransmissionTime).count());
+        }
+        else if (result == CURLE_ABORTED_BY_CALLBACK)
+        {
+            //the loop stopped before the transfer started.
+            transfer->response = nullptr;
+        }
+
+        if (transfer->headers)
+        {
+            curl_slist_free_all(transfer->headers);
+        }
+
+        if (transfer->response)
+        {
+            transfer->response->GetResponseBody().flush();
+        }
+
+        if (transfer->onResponseReceived)
+        {
+            transfer->onResponseReceived(transfer->request, transfer->response);
+        }
+        Aws::Delete(transfer);
+    }
+
+    const CurlMultiHttpClient* m_client;
+    CurlHandleContainer m_handleContainer;
+    CURLM* m_multiHandle;
+    SocketPoller m_poller;
+    bool m_hasTimeout;
+    std::chrono::steady_clock::time_point m_timeoutDeadline;
+    Aws::Vector<Transfer*> m_active;
+
+    std::mutex m_pendingLock;
+    Aws::Vector<Transfer*> m_pending;
+    bool m_running;
+    std::thread m_thread;
+};
+
+} // namespace Http
+} // namespace Aws
+
+CurlMultiHttpClient::CurlMultiHttpClient(const ClientConfiguration& clientConfig) :
+    Base(BaseClientConfiguration(clientConfig)),
+    m_nextEventLoop(0)
+{
+    unsigned eventLoopCount = clientConfig.eventLoopThreads;
+    if (eventLoopCount == 0)
+    {
+        eventLoopCount = (std::max)(1u, std::thread::hardware_concurrency());
+    }
+    long connectionsPerLoop = (std::max)(1L, static_cast<long>((clientConfig.maxConnections + eventLoopCount - 1) / eventLoopCount));
+
+    AWS_LOGSTREAM_INFO(CURL_MULTI_HTTP_CLIENT_TAG, "Starting " << eventLoopCount << " curl multi event loop(s) with up to "
+            << connectionsPerLoop << " connections each.");
+    for (unsigned i = 0; i < eventLoopCount; ++i)
+    {
+        m_eventLoops.push_back(Aws::New<EventLoop>(CURL_MULTI_HTTP_CLIENT_TAG, this, clientConfig, connectionsPerLoop));
+    }
+
+    //the warm up requests are spread round robin, each loop keeps the connections it opened in its multi handle.
+    size_t warmUpConnections = (std::min)(clientConfig.connectionPoolWarmUpSize, clientConfig.maxConnections);
+    if (warmUpConnections > 0 && !clientConfig.endpointOverride.empty())
+    {
+        WarmUp(EndpointWithScheme(clientConfig), warmUpConnections);
+    }
+}
+
+Aws::Map<Aws::String, CurlHostConnectionStats> CurlMultiHttpClient::GetHostConnectionStats() const
+{
+    Aws::Map<Aws::String, CurlHostConnectionStats> hostStats;
+    for (const EventLoop* eventLoop : m_eventLoops)
+    {
+        for (const auto& loopStats : eventLoop->GetHostConnectionStats())
+        {
+            CurlHostConnectionStats& stats = hostStats[loopStats.first];
+            stats.requestCount += loopStats.second.requestCount;
+            stats.newConnectionCount += loopStats.second.newConnectionCount;
+            stats.reusedConnectionCount += loopStats.second.reusedConnectionCount;
+        }
+    }
+    return hostStats;
+}
+
+CurlMultiHttpClient::~CurlMultiHttpClient()
+{
+    for (EventLoop* eventLoop : m_eventLoops)
+    {
+        Aws::Delete(eventLoop);
+    }
+}
+
+void CurlMultiHttpClient::MakeAsyncRequest(const std::shared_ptr<HttpRequest>& request, const AsyncResponseReceivedHandler& onResponseReceived,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request->GetSize());
+    }
+
+    auto transfer = Aws::New<Transfer>(CURL_MULTI_HTTP_CLIENT_TAG, this, request, onResponseReceived, readLimiter, writeLimiter);
+    m_eventLoops[m_nextEventLoop++ % m_eventLoops.size()]->Submit(transfer);
+}
+
+std::shared_ptr<HttpResponse> CurlMultiHttpClient::MakeRequest(const std::shared_ptr<HttpRequest>& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    std::mutex completionLock;
+    std::condition_variable completionSignal;
+    bool completed = false;
+    std::shared_ptr<HttpResponse> result;
+
+    MakeAsyncRequest(request, [&](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+    {
+        std::lock_guard<std::mutex> locker(completionLock);
+        result = response;
+        completed = true;
+        completionSignal.notify_one();
+    }, readLimiter, writeLimiter);
+
+    std::unique_lock<std::mutex> locker(completionLock);
+    completionSignal.wait(locker, [&](){ return completed; });
+    return result;
+}
+
+std::shared_ptr<HttpResponse> CurlMultiHttpClient::MakeRequest(HttpRequest& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    // The caller keeps ownership of request and we block until the transfer is done, so a non-owning shared_ptr is safe here.
+    std::shared_ptr<HttpRequest> unownedRequest(&request, [](HttpRequest*){});
+    return MakeRequest(unownedRequest, readLimiter, writeLimiter);
+}
+
+#endif // !defined(_WIN32)
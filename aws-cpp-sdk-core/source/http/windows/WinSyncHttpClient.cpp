@@ -217,10 +217,23 @@ void WinSyncHttpClient::BuildSuccessResponse(const Aws::Http::HttpRequest& reque
         read = 0;    
         
         bool success = ContinueRequest(request);
+        ResponseBodySink* bodySink = BeginResponseBody(request, *response);
 
         while (DoReadData(hHttpRequest, body, bodySize, read) && read > 0 && success)
         {
-            response->GetResponseBody().write(body, read);
+            if (bodySink)
+            {
+                if (!bodySink->OnBodyData(body, static_cast<size_t>(read)))
+                {
+                    AWS_LOGSTREAM_ERROR(GetLogTag(), "Response body sink rejected " << read << " bytes, aborting the transfer.");
+                    success = false;
+                    break;
+                }
+            }
+            else
+            {
+                response->GetResponseBody().write(body, read);
+            }
             if (read > 0)
             {
                 numBytesResponseReceived += read;
@@ -24,11 +24,14 @@
 #include <unistd.h>
 #include <pwd.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <dirent.h>
 #include <errno.h>
 #include <climits>
 
 #include <cassert>
+#include <limits>
 
 namespace Aws
 {
@@ -288,6 +291,66 @@ Aws::String GetExecutableDirectory()
     return "./";
 }
 
+MappedFileRegion::MappedFileRegion(const Aws::String& path, uint64_t offset, size_t length) :
+    m_mapping(nullptr), m_mappingLength(0), m_data(nullptr), m_length(0)
+{
+    if(length == 0)
+    {
+        return;
+    }
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Could not open file " << path << " for mapping with error code " << errno);
+        return;
+    }
+
+    //touching a mapped page past the end of the file raises SIGBUS, so refuse regions the file doesn't cover.
+    struct stat fileInfo;
+    if(fstat(fd, &fileInfo) || static_cast<uint64_t>(fileInfo.st_size) < offset + length)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "File " << path << " is too short to map " << length << " bytes at offset " << offset);
+        close(fd);
+        return;
+    }
+
+    uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t mappingOffset = offset - offset % pageSize;
+    size_t mappingLength = static_cast<size_t>(offset - mappingOffset) + length;
+    if(mappingOffset > static_cast<uint64_t>((std::numeric_limits<off_t>::max)()))
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Offset " << offset << " of file " << path << " is out of range for mapping");
+        close(fd);
+        return;
+    }
+
+    void* mapping = mmap(nullptr, mappingLength, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(mappingOffset));
+    close(fd);
+
+    if(mapping == MAP_FAILED)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Could not map " << length << " bytes of file " << path << " at offset " << offset << " with error code " << errno);
+        return;
+    }
+
+    //regions are usually read once, front to back.
+    madvise(mapping, mappingLength, MADV_SEQUENTIAL);
+
+    m_mapping = mapping;
+    m_mappingLength = mappingLength;
+    m_data = static_cast<const unsigned char*>(mapping) + (offset - mappingOffset);
+    m_length = length;
+}
+
+MappedFileRegion::~MappedFileRegion()
+{
+    if(m_mapping)
+    {
+        munmap(m_mapping, m_mappingLength);
+    }
+}
+
 Aws::UniquePtr<Directory> OpenDirectory(const Aws::String& path, const Aws::String& relativePath)
 {
     return Aws::MakeUnique<PosixDirectory>(FILE_SYSTEM_UTILS_LOG_TAG, path, relativePath);
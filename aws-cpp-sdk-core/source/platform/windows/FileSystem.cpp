@@ -337,6 +337,66 @@ Aws::String CreateTempFilePath()
     return s_tempName;
 }
 
+MappedFileRegion::MappedFileRegion(const Aws::String& path, uint64_t offset, size_t length) :
+    m_mapping(nullptr), m_mappingLength(0), m_data(nullptr), m_length(0)
+{
+    if (length == 0)
+    {
+        return;
+    }
+
+    HANDLE file = CreateFileW(ToLongPath(StringUtils::ToWString(path.c_str())).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Could not open file " << path << " for mapping with error code " << GetLastError());
+        return;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || static_cast<uint64_t>(fileSize.QuadPart) < offset + length)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "File " << path << " is too short to map " << length << " bytes at offset " << offset);
+        CloseHandle(file);
+        return;
+    }
+
+    //the view keeps the mapping and the file open, so both handles can be closed right away.
+    HANDLE fileMapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!fileMapping)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Could not create a mapping of file " << path << " with error code " << GetLastError());
+        return;
+    }
+
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    uint64_t granularity = static_cast<uint64_t>(systemInfo.dwAllocationGranularity);
+    uint64_t mappingOffset = offset - offset % granularity;
+    size_t mappingLength = static_cast<size_t>(offset - mappingOffset) + length;
+    void* view = MapViewOfFile(fileMapping, FILE_MAP_READ, static_cast<DWORD>(mappingOffset >> 32), static_cast<DWORD>(mappingOffset & 0xFFFFFFFF), mappingLength);
+    CloseHandle(fileMapping);
+
+    if (!view)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Could not map " << length << " bytes of file " << path << " at offset " << offset << " with error code " << GetLastError());
+        return;
+    }
+
+    m_mapping = view;
+    m_mappingLength = mappingLength;
+    m_data = static_cast<const unsigned char*>(view) + (offset - mappingOffset);
+    m_length = length;
+}
+
+MappedFileRegion::~MappedFileRegion()
+{
+    if (m_mapping)
+    {
+        UnmapViewOfFile(m_mapping);
+    }
+}
+
 Aws::UniquePtr<Directory> OpenDirectory(const Aws::String& path, const Aws::String& relativePath)
 {
     return Aws::MakeUnique<User32Directory>(FILE_SYSTEM_UTILS_LOG_TAG, path, relativePath);
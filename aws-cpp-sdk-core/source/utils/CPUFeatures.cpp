@@ -0,0 +1,90 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/CPUFeatures.h>
+
+#if defined(AWS_X86_SIMD) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Aws
+{
+namespace Utils
+{
+namespace CPUFeatures
+{
+
+#if defined(AWS_X86_SIMD) && defined(_MSC_VER)
+    static bool DetectSSSE3()
+    {
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 9)) != 0;
+    }
+
+    static bool DetectAVX2()
+    {
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+
+        //the OS has to save the ymm registers on context switches.
+        __cpuid(info, 1);
+        bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+        __cpuidex(info, 7, 0);
+        return osSavesYmm && (info[1] & (1 << 5)) != 0;
+    }
+#elif defined(AWS_X86_SIMD)
+    static bool DetectSSSE3()
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3") != 0;
+    }
+
+    static bool DetectAVX2()
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }
+#else
+    static bool DetectSSSE3()
+    {
+        return false;
+    }
+
+    static bool DetectAVX2()
+    {
+        return false;
+    }
+#endif
+
+    bool HasSSSE3()
+    {
+        static const bool hasSSSE3 = DetectSSSE3();
+        return hasSSSE3;
+    }
+
+    bool HasAVX2()
+    {
+        static const bool hasAVX2 = DetectAVX2();
+        return hasAVX2;
+    }
+
+} // namespace CPUFeatures
+} // namespace Utils
+} // namespace Aws
@@ -15,6 +15,7 @@
 
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Threading;
@@ -39,5 +40,7 @@ void EnumParseOverflowContainer::StoreOverflow(int hashCode, const Aws::String&
 {
     WriterLockGuard guard(m_overflowLock);
     AWS_LOGSTREAM_WARN(LOG_TAG, "Encountered enum member " << value << " which is not modeled in your clients. You should update your clients when you get a chance.");
+    //results are decoded inside an ArenaScope, and the stored value lives as long as the process.
+    Aws::Utils::Memory::SuspendArenaScope suspendArenaScope;
     m_overflowMap[hashCode] = value;
 }
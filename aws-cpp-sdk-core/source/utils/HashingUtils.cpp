@@ -19,13 +19,18 @@
 #include <aws/core/utils/base64/Base64.h>
 #include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
+#include <aws/core/utils/crypto/Sha256TreeHash.h>
 #include <aws/core/utils/crypto/MD5.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
-#include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/CPUFeatures.h>
 
 #include <iomanip>
 
+#ifdef AWS_X86_SIMD
+#include <immintrin.h>
+#endif
+
 using namespace Aws::Utils;
 using namespace Aws::Utils::Base64;
 using namespace Aws::Utils::Crypto;
@@ -33,9 +38,6 @@ using namespace Aws::Utils::Crypto;
 // internal buffers are fixed-size arrays, so this is harmless memory-management wise
 static Aws::Utils::Base64::Base64 s_base64;
 
-// Aws Glacier Tree Hash calculates hash value for each 1MB data
-const static size_t TREE_HASH_ONE_MB = 1024 * 1024;
-
 Aws::String HashingUtils::Base64Encode(const ByteBuffer& message)
 {
     return s_base64.Encode(message);
@@ -46,6 +48,16 @@ ByteBuffer HashingUtils::Base64Decode(const Aws::String& encodedMessage)
     return s_base64.Decode(encodedMessage);
 }
 
+size_t HashingUtils::Base64Encode(const unsigned char* data, size_t length, char* output)
+{
+    return s_base64.Encode(data, length, output);
+}
+
+size_t HashingUtils::Base64Decode(const char* encoded, size_t length, unsigned char* output)
+{
+    return s_base64.Decode(encoded, length, output);
+}
+
 ByteBuffer HashingUtils::CalculateSHA256HMAC(const ByteBuffer& toSign, const ByteBuffer& secret)
 {
     Sha256HMAC hash;
@@ -64,101 +76,156 @@ ByteBuffer HashingUtils::CalculateSHA256(Aws::IOStream& stream)
     return hash.Calculate(stream).GetResult();
 }
 
-/**
- * This function is only used by HashingUtils::CalculateSHA256TreeHash() in this cpp file
- * It's a helper function be used to compute the TreeHash defined at:
- * http://docs.aws.amazon.com/amazonglacier/latest/dev/checksum-calculations.html
- */
-static ByteBuffer TreeHashFinalCompute(Aws::List<ByteBuffer>& input)
+ByteBuffer HashingUtils::CalculateSHA256TreeHash(const Aws::String& str)
 {
-    Sha256 hash;
-    assert(input.size() != 0);
-
-    // O(n) time complexity of merging (n + n/2 + n/4 + n/8 +...+ 1)
-    while (input.size() > 1)
-    {
-        auto iter = input.begin();
-        // if only one element left, just left it there
-        while (std::next(iter) != input.end())
-        {
-            // if >= two elements
-            Aws::String str(reinterpret_cast<char*>(iter->GetUnderlyingData()), iter->GetLength());
-            // list erase returns iterator of next element next to the erased element or end() if erased the last one
-            // list insert inserts element before pos, here we erase two elements, and insert a new element
-            iter = input.erase(iter);
-            str.append(reinterpret_cast<char*>(iter->GetUnderlyingData()), iter->GetLength());
-            iter = input.erase(iter);
-            input.insert(iter, hash.Calculate(str).GetResult());
+    Sha256TreeHash hash;
+    return hash.Calculate(str).GetResult();
+}
 
-            if (iter == input.end()) break;
-        } // while process to the last element
-    } // while the list has only one element left
+ByteBuffer HashingUtils::CalculateSHA256TreeHash(Aws::IOStream& stream)
+{
+    Sha256TreeHash hash;
+    return hash.Calculate(stream).GetResult();
+}
 
-    return *(input.begin());
+ByteBuffer HashingUtils::CalculateSHA256TreeHash(Aws::IOStream& stream, Aws::Utils::Threading::Executor* executor)
+{
+    Sha256TreeHash hash(executor);
+    return hash.Calculate(stream).GetResult();
 }
 
-ByteBuffer HashingUtils::CalculateSHA256TreeHash(const Aws::String& str)
+#ifdef AWS_X86_SIMD
+
+//16 bytes to their 32 hex characters; the loops return how much input they consumed and leave the rest to the scalar code.
+static AWS_TARGET_SSSE3 size_t HexEncodeSSSE3(const unsigned char* data, size_t length, char* output)
 {
-    Sha256 hash;
-    if (str.size() == 0)
+    const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+    size_t consumed = 0;
+    for (; consumed + 16 <= length; consumed += 16, output += 32)
     {
-        return hash.Calculate(str).GetResult();
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed));
+        __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(in, 4), nibbleMask));
+        __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(in, nibbleMask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16), _mm_unpackhi_epi8(high, low));
     }
+    return consumed;
+}
 
-    Aws::List<ByteBuffer> input;
-    size_t pos = 0;
-    while (pos < str.size())
+static AWS_TARGET_AVX2 size_t HexEncodeAVX2(const unsigned char* data, size_t length, char* output)
+{
+    const __m256i digits = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+    size_t consumed = 0;
+    for (; consumed + 32 <= length; consumed += 32, output += 64)
     {
-        input.push_back(hash.Calculate(Aws::String(str, pos, TREE_HASH_ONE_MB)).GetResult());
-        pos += TREE_HASH_ONE_MB;
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + consumed));
+        __m256i high = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibbleMask));
+        __m256i low = _mm256_shuffle_epi8(digits, _mm256_and_si256(in, nibbleMask));
+        //unpacking works within 128 bit lanes, so the halves are put back in order afterwards.
+        __m256i first = _mm256_unpacklo_epi8(high, low);
+        __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 32), _mm256_permute2x128_si256(first, second, 0x31));
     }
-
-    return TreeHashFinalCompute(input);
+    return consumed;
 }
 
-ByteBuffer HashingUtils::CalculateSHA256TreeHash(Aws::IOStream& stream)
+//the values of 16 hex characters, or false when any of them is not a hex digit.
+static AWS_TARGET_SSSE3 inline bool HexValuesSSSE3(__m128i chars, __m128i& values)
 {
-    Sha256 hash;
-    Aws::List<ByteBuffer> input;
-    auto currentPos = stream.tellg();
-    if (currentPos == std::ios::pos_type(-1))
+    __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chars));
+    __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+    if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xFFFF)
     {
-        currentPos = 0;
-        stream.clear();
+        return false;
     }
-    stream.seekg(0, stream.beg);
-    Array<char> streamBuffer(TREE_HASH_ONE_MB);
-    while (stream.good())
+    values = _mm_add_epi8(_mm_and_si128(chars, _mm_set1_epi8(0x0f)), _mm_and_si128(letter, _mm_set1_epi8(9)));
+    return true;
+}
+
+static AWS_TARGET_SSSE3 size_t HexDecodeSSSE3(const char* encoded, size_t length, unsigned char* output)
+{
+    size_t consumed = 0;
+    for (; consumed + 32 <= length; consumed += 32, output += 16)
     {
-        stream.read(streamBuffer.GetUnderlyingData(), TREE_HASH_ONE_MB);
-        auto bytesRead = stream.gcount();
-        if (bytesRead > 0)
+        __m128i first, second;
+        if (!HexValuesSSSE3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + consumed)), first) ||
+            !HexValuesSSSE3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded + consumed + 16)), second))
         {
-            input.push_back(hash.Calculate(Aws::String(reinterpret_cast<char*>(streamBuffer.GetUnderlyingData()), static_cast<size_t>(bytesRead))).GetResult());
+            break;
         }
+        //high nibble * 16 + low nibble for every pair.
+        first = _mm_maddubs_epi16(first, _mm_set1_epi16(0x0110));
+        second = _mm_maddubs_epi16(second, _mm_set1_epi16(0x0110));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(first, second));
     }
-    stream.clear();
-    stream.seekg(currentPos, stream.beg);
+    return consumed;
+}
 
-    if (input.size() == 0)
+static AWS_TARGET_AVX2 inline bool HexValuesAVX2(__m256i chars, __m256i& values)
+{
+    __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+    __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars));
+    __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+    if (_mm256_movemask_epi8(_mm256_or_si256(digit, letter)) != -1)
     {
-        return hash.Calculate("").GetResult();
+        return false;
     }
-    return TreeHashFinalCompute(input);
+    values = _mm256_add_epi8(_mm256_and_si256(chars, _mm256_set1_epi8(0x0f)), _mm256_and_si256(letter, _mm256_set1_epi8(9)));
+    return true;
 }
 
+static AWS_TARGET_AVX2 size_t HexDecodeAVX2(const char* encoded, size_t length, unsigned char* output)
+{
+    size_t consumed = 0;
+    for (; consumed + 64 <= length; consumed += 64, output += 32)
+    {
+        __m256i first, second;
+        if (!HexValuesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + consumed)), first) ||
+            !HexValuesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + consumed + 32)), second))
+        {
+            break;
+        }
+        first = _mm256_maddubs_epi16(first, _mm256_set1_epi16(0x0110));
+        second = _mm256_maddubs_epi16(second, _mm256_set1_epi16(0x0110));
+        //packing works within 128 bit lanes; put the four quarters back in order.
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xD8));
+    }
+    return consumed;
+}
+
+#endif // AWS_X86_SIMD
+
 Aws::String HashingUtils::HexEncode(const ByteBuffer& message)
 {
-    Aws::String encoded;
-    encoded.reserve(2 * message.GetLength());
+    Aws::String encoded(2 * message.GetLength(), '\0');
+    HexEncode(message.GetUnderlyingData(), message.GetLength(), &encoded[0]);
+    return encoded;
+}
 
-    for (unsigned i = 0; i < message.GetLength(); ++i)
+void HashingUtils::HexEncode(const unsigned char* data, size_t length, char* output)
+{
+    size_t consumed = 0;
+#ifdef AWS_X86_SIMD
+    if (CPUFeatures::HasAVX2())
     {
-        encoded.push_back("0123456789abcdef"[message[i] >> 4]);
-        encoded.push_back("0123456789abcdef"[message[i] & 0x0f]);
+        consumed = HexEncodeAVX2(data, length, output);
     }
+    if (CPUFeatures::HasSSSE3())
+    {
+        consumed += HexEncodeSSSE3(data + consumed, length - consumed, output + 2 * consumed);
+    }
+#endif
 
-    return encoded;
+    for (size_t i = consumed; i < length; ++i)
+    {
+        output[2 * i] = "0123456789abcdef"[data[i] >> 4];
+        output[2 * i + 1] = "0123456789abcdef"[data[i] & 0x0f];
+    }
 }
 
 ByteBuffer HashingUtils::HexDecode(const Aws::String& str)
@@ -182,17 +249,34 @@ ByteBuffer HashingUtils::HexDecode(const Aws::String& str)
     }
 
     ByteBuffer hexBuffer(strLength / 2);
-    size_t bufferIndex = 0;
+    HexDecode(str.c_str() + readIndex, strLength, hexBuffer.GetUnderlyingData());
+    return hexBuffer;
+}
 
-    for (size_t i = readIndex; i < str.length(); i += 2)
+void HashingUtils::HexDecode(const char* encoded, size_t length, unsigned char* output)
+{
+    size_t consumed = 0;
+#ifdef AWS_X86_SIMD
+    if (CPUFeatures::HasAVX2())
     {
-        if(!StringUtils::IsAlnum(str[i]) || !StringUtils::IsAlnum(str[i + 1]))
+        consumed = HexDecodeAVX2(encoded, length, output);
+    }
+    if (CPUFeatures::HasSSSE3())
+    {
+        consumed += HexDecodeSSSE3(encoded + consumed, length - consumed, output + consumed / 2);
+    }
+#endif
+
+    size_t bufferIndex = consumed / 2;
+    for (size_t i = consumed; i + 1 < length; i += 2)
+    {
+        if(!StringUtils::IsAlnum(encoded[i]) || !StringUtils::IsAlnum(encoded[i + 1]))
         {
             //contains non-hex characters
             assert(0);
         }
 
-        char firstChar = str[i];
+        char firstChar = encoded[i];
         uint8_t distance = firstChar - '0';
 
         if(isalpha(firstChar))
@@ -203,7 +287,7 @@ ByteBuffer HashingUtils::HexDecode(const Aws::String& str)
 
         unsigned char val = distance * 16;
 
-        char secondChar = str[i + 1];
+        char secondChar = encoded[i + 1];
         distance = secondChar - '0';
 
         if(isalpha(secondChar))
@@ -213,10 +297,8 @@ ByteBuffer HashingUtils::HexDecode(const Aws::String& str)
         }
 
         val += distance;
-        hexBuffer[bufferIndex++] = val;
+        output[bufferIndex++] = val;
     }
-
-    return hexBuffer;
 }
 
 ByteBuffer HashingUtils::CalculateMD5(const Aws::String& str)
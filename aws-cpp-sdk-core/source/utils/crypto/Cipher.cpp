@@ -19,6 +19,7 @@
 #include <aws/core/utils/logging/LogMacros.h>
 #include <cstdlib>
 #include <climits>
+#include <cstring>
 
 //if you are reading this, you are witnessing pure brilliance.
 #define IS_BIG_ENDIAN (*(uint16_t*)"\0\xff" < 0x100)
@@ -102,6 +103,38 @@ namespace Aws
                 }
             }
 
+            size_t SymmetricCipher::EncryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength)
+            {
+                CryptoBuffer encrypted = EncryptBuffer(CryptoBuffer(data, dataLength));
+                if (encrypted.GetLength() > outputLength)
+                {
+                    m_failure = true;
+                    AWS_LOGSTREAM_ERROR(LOG_TAG, "Output buffer of " << outputLength << " bytes is too small for " << encrypted.GetLength() << " bytes of encrypted data.");
+                    return 0;
+                }
+                if (encrypted.GetLength() > 0)
+                {
+                    memcpy(output, encrypted.GetUnderlyingData(), encrypted.GetLength());
+                }
+                return encrypted.GetLength();
+            }
+
+            size_t SymmetricCipher::DecryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength)
+            {
+                CryptoBuffer decrypted = DecryptBuffer(CryptoBuffer(data, dataLength));
+                if (decrypted.GetLength() > outputLength)
+                {
+                    m_failure = true;
+                    AWS_LOGSTREAM_ERROR(LOG_TAG, "Output buffer of " << outputLength << " bytes is too small for " << decrypted.GetLength() << " bytes of decrypted data.");
+                    return 0;
+                }
+                if (decrypted.GetLength() > 0)
+                {
+                    memcpy(output, decrypted.GetUnderlyingData(), decrypted.GetLength());
+                }
+                return decrypted.GetLength();
+            }
+
             /**
              * Generate random number per 4 bytes and use each byte for the byte in the iv
              */
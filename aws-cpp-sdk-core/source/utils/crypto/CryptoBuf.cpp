@@ -14,6 +14,7 @@
   */
 
 #include <aws/core/utils/crypto/CryptoBuf.h>
+#include <cstring>
 
 namespace Aws
 {
@@ -21,13 +22,16 @@ namespace Aws
     {
         namespace Crypto
         {
+            //the most a cipher adds to its input in one update or finalize call.
+            static const size_t MAX_CIPHER_BLOCK_SIZE = 16;
+
             SymmetricCryptoBufSrc::SymmetricCryptoBufSrc(Aws::IStream& stream, SymmetricCipher& cipher, CipherMode cipherMode, size_t bufferSize)
                     :
-                    m_isBuf(PUT_BACK_SIZE), m_cipher(cipher), m_stream(stream), m_cipherMode(cipherMode), m_isFinalized(false),
-                    m_bufferSize(bufferSize), m_putBack(PUT_BACK_SIZE)
+                    m_isBuf(PUT_BACK_SIZE + bufferSize + MAX_CIPHER_BLOCK_SIZE), m_srcBuf(bufferSize), m_cipher(cipher), m_stream(stream),
+                    m_cipherMode(cipherMode), m_isFinalized(false), m_bufferSize(bufferSize), m_putBack(PUT_BACK_SIZE)
             {
-                char* end = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_isBuf.GetLength());
-                setg(end, end, end);
+                char* start = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_putBack);
+                setg(start, start, start);
             }
 
             SymmetricCryptoBufSrc::pos_type SymmetricCryptoBufSrc::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
@@ -60,65 +64,26 @@ namespace Aws
                         index = 0;
                     }
 
-                    CryptoBuffer cryptoBuffer;
+                    size_t filled = 0;
                     while (m_cipher && index < seekTo && !m_isFinalized)
                     {
-                        size_t max_read = std::min<size_t>(static_cast<size_t>(seekTo - index), m_bufferSize);
-
-                        Aws::Utils::Array<char> buf(max_read);
-                        size_t readSize(0);
-                        if(m_stream)
-                        {
-                            m_stream.read(buf.GetUnderlyingData(), max_read);
-                            readSize = static_cast<size_t>(m_stream.gcount());
-                        }
-
-                        if (readSize > 0)
-                        {
-                            if (m_cipherMode == CipherMode::Encrypt)
-                            {
-                                cryptoBuffer = m_cipher.EncryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                            }
-                            else
-                            {
-                                cryptoBuffer = m_cipher.DecryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                            }
-                        }
-                        else
-                        {
-                            if (m_cipherMode == CipherMode::Encrypt)
-                            {
-                                cryptoBuffer = m_cipher.FinalizeEncryption();
-                            }
-                            else
-                            {
-                                cryptoBuffer = m_cipher.FinalizeDecryption();
-                            }
-
-                            m_isFinalized = true;
-                        }
-
-                        index += cryptoBuffer.GetLength();
+                        filled = FillBuffer(std::min<size_t>(static_cast<size_t>(seekTo - index), m_bufferSize));
+                        index += filled;
                     }
 
-                    if (cryptoBuffer.GetLength() && m_cipher)
+                    char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
+                    if (filled && m_cipher)
                     {
-                        CryptoBuffer putBackArea(m_putBack);
-                                                
-                        m_isBuf = CryptoBuffer({&putBackArea, &cryptoBuffer});
                         //in the very unlikely case that the cipher had less output than the source stream.
                         assert(seekTo <= index);
-                        size_t newBufferPos = index > seekTo ? cryptoBuffer.GetLength() - (index - seekTo) : cryptoBuffer.GetLength();
-                        char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
-                        setg(baseBufPtr, baseBufPtr + m_putBack + newBufferPos, baseBufPtr + m_isBuf.GetLength());
+                        size_t newBufferPos = index > seekTo ? filled - (index - seekTo) : filled;
+                        setg(baseBufPtr, baseBufPtr + m_putBack + newBufferPos, baseBufPtr + m_putBack + filled);
 
                         return pos_type(seekTo);
                     }
                     else if (seekTo == 0)
                     {
-                        m_isBuf = CryptoBuffer(m_putBack);
-                        char* end = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_isBuf.GetLength());
-                        setg(end, end, end);
+                        setg(baseBufPtr + m_putBack, baseBufPtr + m_putBack, baseBufPtr + m_putBack);
                         return pos_type(seekTo);
                     }
                 }
@@ -144,56 +109,24 @@ namespace Aws
                 }
 
                 char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
-                CryptoBuffer putBackArea(m_putBack);
 
                 //eback is properly set after the first fill. So this guarantees we are on the second or later fill.
                 if (eback() == baseBufPtr)
                 {
                     //just fill in the last bit of the previous buffer into the put back area so that it has some data in it
-                    memcpy(putBackArea.GetUnderlyingData(), egptr() - m_putBack, m_putBack);
+                    memmove(baseBufPtr, egptr() - m_putBack, m_putBack);
                 }
 
-                CryptoBuffer newDataBuf;
-
-                while(!newDataBuf.GetLength() && !m_isFinalized)
+                size_t filled = 0;
+                while(m_cipher && !filled && !m_isFinalized)
                 {
-                    Aws::Utils::Array<char> buf(m_bufferSize);
-                    m_stream.read(buf.GetUnderlyingData(), m_bufferSize);
-                    size_t readSize = static_cast<size_t>(m_stream.gcount());
-
-                    if (readSize > 0)
-                    {
-                        if (m_cipherMode == CipherMode::Encrypt)
-                        {
-                            newDataBuf = m_cipher.EncryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                        }
-                        else
-                        {
-                            newDataBuf = m_cipher.DecryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                        }
-                    }
-                    else
-                    {
-                        if (m_cipherMode == CipherMode::Encrypt)
-                        {
-                            newDataBuf = m_cipher.FinalizeEncryption();
-                        }
-                        else
-                        {
-                            newDataBuf = m_cipher.FinalizeDecryption();
-                        }
-
-                        m_isFinalized = true;
-                    }
+                    filled = FillBuffer(m_bufferSize);
                 }
 
-
-                if(newDataBuf.GetLength() > 0)
+                if(filled > 0 && m_cipher)
                 {
-                    m_isBuf = CryptoBuffer({&putBackArea, &newDataBuf});
-
                     baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
-                    setg(baseBufPtr, baseBufPtr + m_putBack, baseBufPtr + m_isBuf.GetLength());
+                    setg(baseBufPtr, baseBufPtr + m_putBack, baseBufPtr + m_putBack + filled);
 
                     return traits_type::to_int_type(*gptr());
                 }
@@ -201,6 +134,43 @@ namespace Aws
                 return traits_type::eof();
             }
 
+            size_t SymmetricCryptoBufSrc::FillBuffer(size_t readLength)
+            {
+                size_t readSize(0);
+                if (m_stream)
+                {
+                    m_stream.read(reinterpret_cast<char*>(m_srcBuf.GetUnderlyingData()), readLength);
+                    readSize = static_cast<size_t>(m_stream.gcount());
+                }
+
+                unsigned char* output = m_isBuf.GetUnderlyingData() + m_putBack;
+                size_t outputLength = m_isBuf.GetLength() - m_putBack;
+                if (readSize > 0)
+                {
+                    if (m_cipherMode == CipherMode::Encrypt)
+                    {
+                        return m_cipher.EncryptToBuffer(m_srcBuf.GetUnderlyingData(), readSize, output, outputLength);
+                    }
+                    return m_cipher.DecryptToBuffer(m_srcBuf.GetUnderlyingData(), readSize, output, outputLength);
+                }
+
+                m_isFinalized = true;
+                CryptoBuffer finalBuffer = m_cipherMode == CipherMode::Encrypt ? m_cipher.FinalizeEncryption() : m_cipher.FinalizeDecryption();
+                if (finalBuffer.GetLength() > outputLength)
+                {
+                    //only ciphers that work on the whole input at once (key wrap) give more than a block here.
+                    CryptoBuffer largerBuffer(m_putBack + finalBuffer.GetLength());
+                    memcpy(largerBuffer.GetUnderlyingData(), m_isBuf.GetUnderlyingData(), m_putBack);
+                    m_isBuf = std::move(largerBuffer);
+                    output = m_isBuf.GetUnderlyingData() + m_putBack;
+                }
+                if (finalBuffer.GetLength() > 0)
+                {
+                    memcpy(output, finalBuffer.GetUnderlyingData(), finalBuffer.GetLength());
+                }
+                return finalBuffer.GetLength();
+            }
+
             SymmetricCryptoBufSrc::off_type SymmetricCryptoBufSrc::ComputeAbsSeekPosition(off_type pos, std::ios_base::seekdir dir,  std::fpos<FPOS_TYPE> curPos)
             {
                 switch(dir)
@@ -238,7 +208,8 @@ namespace Aws
 
             SymmetricCryptoBufSink::SymmetricCryptoBufSink(Aws::OStream& stream, SymmetricCipher& cipher, CipherMode cipherMode, size_t bufferSize, int16_t blockOffset)
                     :
-                    m_osBuf(bufferSize), m_cipher(cipher), m_stream(stream), m_cipherMode(cipherMode), m_isFinalized(false), m_blockOffset(blockOffset)
+                    m_osBuf(bufferSize), m_cipherBuf(bufferSize + MAX_CIPHER_BLOCK_SIZE), m_cipher(cipher), m_stream(stream), m_cipherMode(cipherMode),
+                    m_isFinalized(false), m_blockOffset(blockOffset)
             {
                 assert(m_blockOffset < 16 && m_blockOffset >= 0);
                 char* outputBase = reinterpret_cast<char*>(m_osBuf.GetUnderlyingData());
@@ -262,23 +233,25 @@ namespace Aws
             {
                 if(!m_isFinalized)
                 {
-                    CryptoBuffer cryptoBuf;
+                    size_t cipherLength = 0;
                     if (pptr() > pbase())
                     {
+                        const unsigned char* data = reinterpret_cast<unsigned char*>(pbase());
+                        size_t dataLength = static_cast<size_t>(pptr() - pbase());
                         if (m_cipherMode == CipherMode::Encrypt)
                         {
-                            cryptoBuf = m_cipher.EncryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(pbase()), pptr() - pbase()));
+                            cipherLength = m_cipher.EncryptToBuffer(data, dataLength, m_cipherBuf.GetUnderlyingData(), m_cipherBuf.GetLength());
                         }
                         else
                         {
-                            cryptoBuf = m_cipher.DecryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(pbase()), pptr() - pbase()));
+                            cipherLength = m_cipher.DecryptToBuffer(data, dataLength, m_cipherBuf.GetUnderlyingData(), m_cipherBuf.GetLength());
                         }
 
                         pbump(-(static_cast<int>(pptr() - pbase())));
                     }
+                    CryptoBuffer finalBuffer;
                     if(finalize)
                     {
-                        CryptoBuffer finalBuffer;
                         if (m_cipherMode == CipherMode::Encrypt)
                         {
                             finalBuffer = m_cipher.FinalizeEncryption();
@@ -287,27 +260,20 @@ namespace Aws
                         {
                             finalBuffer = m_cipher.FinalizeDecryption();
                         }
-                        if(cryptoBuf.GetLength())
-                        {
-                            cryptoBuf = CryptoBuffer({&cryptoBuf, &finalBuffer});
-                        }
-                        else
-                        {
-                            cryptoBuf = std::move(finalBuffer);
-                        }
 
                         m_isFinalized = true;
                     }
 
                     if (m_cipher)
                     {
-                        if(cryptoBuf.GetLength())
+                        if(cipherLength || finalBuffer.GetLength())
                         {
                             //allow mid block decryption. We have to decrypt it, but we don't have to write it to the stream.
                             //the assumption here is that tellp() will always be 0 or >= 16 bytes. The block offset should only 
                             //be the offset of the first block read.
-                            auto blockOffset = m_stream.tellp() > m_blockOffset ? 0 : m_blockOffset;
-                            m_stream.write(reinterpret_cast<char*>(cryptoBuf.GetUnderlyingData() + blockOffset), cryptoBuf.GetLength() - blockOffset);
+                            size_t blockOffset = m_stream.tellp() > m_blockOffset ? 0 : static_cast<size_t>(m_blockOffset);
+                            blockOffset -= WriteToStream(m_cipherBuf.GetUnderlyingData(), cipherLength, blockOffset);
+                            WriteToStream(finalBuffer.GetUnderlyingData(), finalBuffer.GetLength(), blockOffset);
                         }
                         return true;
                     }
@@ -316,6 +282,16 @@ namespace Aws
                 return false;
             }
 
+            size_t SymmetricCryptoBufSink::WriteToStream(const unsigned char* data, size_t length, size_t skip)
+            {
+                size_t skipped = (std::min)(skip, length);
+                if (length > skipped)
+                {
+                    m_stream.write(reinterpret_cast<const char*>(data + skipped), length - skipped);
+                }
+                return skipped;
+            }
+
             SymmetricCryptoBufSink::int_type SymmetricCryptoBufSink::overflow(int_type ch)
             {
                 if(m_cipher && m_stream)
@@ -0,0 +1,249 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/Sha256TreeHash.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char TREE_HASH_TAG[] = "Sha256TreeHash";
+
+const size_t Sha256TreeHash::LEAF_SIZE;
+
+Sha256TreeHash::Sha256TreeHash() :
+    Sha256TreeHash(nullptr, 1)
+{
+}
+
+Sha256TreeHash::Sha256TreeHash(Aws::Utils::Threading::Executor* executor, size_t maxLeavesInFlight) :
+    m_executor(executor),
+    m_maxLeavesInFlight((std::max)(maxLeavesInFlight, static_cast<size_t>(1))),
+    m_leafLength(0),
+    m_leavesInFlight(0),
+    m_failed(false)
+{
+}
+
+Sha256TreeHash::~Sha256TreeHash()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_leafFinished.wait(lock, [this]() { return m_leavesInFlight == 0; });
+}
+
+HashResult Sha256TreeHash::Calculate(const Aws::String& str)
+{
+    Update(reinterpret_cast<const unsigned char*>(str.c_str()), str.size());
+    return GetHash();
+}
+
+HashResult Sha256TreeHash::Calculate(Aws::IStream& stream)
+{
+    auto currentPos = stream.tellg();
+    if (currentPos == std::ios::pos_type(-1))
+    {
+        currentPos = 0;
+        stream.clear();
+    }
+    stream.seekg(0, stream.beg);
+
+    //with an executor the stream is read straight into the leaf buffers that get hashed.
+    ByteBuffer streamBuffer(m_executor ? 0 : LEAF_SIZE);
+    while (stream.good())
+    {
+        if (m_executor)
+        {
+            AcquireLeafBuffer();
+            stream.read(reinterpret_cast<char*>(m_leafBuffer.GetUnderlyingData() + m_leafLength), LEAF_SIZE - m_leafLength);
+            m_leafLength += static_cast<size_t>(stream.gcount());
+            if (m_leafLength == LEAF_SIZE)
+            {
+                SubmitLeaf();
+            }
+        }
+        else
+        {
+            stream.read(reinterpret_cast<char*>(streamBuffer.GetUnderlyingData()), LEAF_SIZE);
+            Update(streamBuffer.GetUnderlyingData(), static_cast<size_t>(stream.gcount()));
+        }
+    }
+    stream.clear();
+    stream.seekg(currentPos, stream.beg);
+
+    return GetHash();
+}
+
+void Sha256TreeHash::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    while (bufferSize > 0)
+    {
+        size_t length = (std::min)(LEAF_SIZE - m_leafLength, bufferSize);
+        if (m_executor)
+        {
+            AcquireLeafBuffer();
+            memcpy(m_leafBuffer.GetUnderlyingData() + m_leafLength, buffer, length);
+        }
+        else
+        {
+            m_leafHash.Update(buffer, length);
+        }
+
+        m_leafLength += length;
+        buffer += length;
+        bufferSize -= length;
+        if (m_leafLength == LEAF_SIZE)
+        {
+            SubmitLeaf();
+        }
+    }
+}
+
+HashResult Sha256TreeHash::GetHash()
+{
+    //the empty input hashes to the SHA256 of nothing.
+    if (m_leafLength > 0 || m_leafHashes.empty())
+    {
+        SubmitLeaf();
+    }
+
+    Aws::Vector<ByteBuffer> level;
+    bool failed = false;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_leafFinished.wait(lock, [this]() { return m_leavesInFlight == 0; });
+        level.swap(m_leafHashes);
+        failed = m_failed;
+        m_failed = false;
+    }
+    if (failed)
+    {
+        return HashResult(false);
+    }
+
+    //hash pairs level by level; an odd digest out moves up as is.
+    Sha256 combiner;
+    while (level.size() > 1)
+    {
+        Aws::Vector<ByteBuffer> nextLevel;
+        nextLevel.reserve((level.size() + 1) / 2);
+        for (size_t i = 0; i < level.size(); i += 2)
+        {
+            if (i + 1 == level.size())
+            {
+                nextLevel.push_back(std::move(level[i]));
+                break;
+            }
+
+            combiner.Update(level[i].GetUnderlyingData(), level[i].GetLength());
+            combiner.Update(level[i + 1].GetUnderlyingData(), level[i + 1].GetLength());
+            auto digest = combiner.GetHash();
+            if (!digest.IsSuccess())
+            {
+                return HashResult(false);
+            }
+            nextLevel.push_back(digest.GetResult());
+        }
+        level.swap(nextLevel);
+    }
+
+    return HashResult(level.front());
+}
+
+void Sha256TreeHash::AcquireLeafBuffer()
+{
+    if (m_leafBuffer.GetLength() > 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(m_mutex);
+    if (m_freeBuffers.empty())
+    {
+        m_leafBuffer = ByteBuffer(LEAF_SIZE);
+    }
+    else
+    {
+        m_leafBuffer = std::move(m_freeBuffers.back());
+        m_freeBuffers.pop_back();
+    }
+}
+
+void Sha256TreeHash::SubmitLeaf()
+{
+    size_t length = m_leafLength;
+    m_leafLength = 0;
+
+    if (!m_executor)
+    {
+        auto leafHash = m_leafHash.GetHash();
+        if (leafHash.IsSuccess())
+        {
+            m_leafHashes.push_back(leafHash.GetResult());
+        }
+        else
+        {
+            m_leafHashes.emplace_back();
+            m_failed = true;
+        }
+        return;
+    }
+
+    size_t index = 0;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_leafFinished.wait(lock, [this]() { return m_leavesInFlight < m_maxLeavesInFlight; });
+        ++m_leavesInFlight;
+        index = m_leafHashes.size();
+        m_leafHashes.emplace_back();
+    }
+
+    auto buffer = Aws::MakeShared<ByteBuffer>(TREE_HASH_TAG, std::move(m_leafBuffer));
+    auto hashLeaf = [this, index, length, buffer]()
+    {
+        Sha256 leafHash;
+        if (length > 0)
+        {
+            leafHash.Update(buffer->GetUnderlyingData(), length);
+        }
+        FinishLeaf(index, leafHash.GetHash(), std::move(*buffer));
+    };
+    if (!m_executor->Submit(hashLeaf))
+    {
+        hashLeaf();
+    }
+}
+
+void Sha256TreeHash::FinishLeaf(size_t index, HashResult&& leafHash, ByteBuffer&& buffer)
+{
+    std::lock_guard<std::mutex> locker(m_mutex);
+    if (leafHash.IsSuccess())
+    {
+        m_leafHashes[index] = std::move(leafHash.GetResult());
+    }
+    else
+    {
+        m_failed = true;
+    }
+    if (buffer.GetLength() > 0)
+    {
+        m_freeBuffers.push_back(std::move(buffer));
+    }
+    --m_leavesInFlight;
+    m_leafFinished.notify_all();
+}
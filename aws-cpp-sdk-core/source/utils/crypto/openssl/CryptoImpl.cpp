@@ -251,6 +251,41 @@ namespace Aws
                 return HashResult(std::move(hash));
             }
 
+            Sha256OpenSSLImpl::~Sha256OpenSSLImpl()
+            {
+                if (m_runningCtx)
+                {
+                    EVP_MD_CTX_destroy(m_runningCtx);
+                }
+            }
+
+            EVP_MD_CTX* Sha256OpenSSLImpl::GetRunningContext()
+            {
+                if (!m_runningCtx)
+                {
+                    m_runningCtx = EVP_MD_CTX_create();
+                    assert(m_runningCtx != nullptr);
+                    EVP_DigestInit_ex(m_runningCtx, EVP_sha256(), nullptr);
+                }
+                return m_runningCtx;
+            }
+
+            void Sha256OpenSSLImpl::Update(const unsigned char* buffer, size_t bufferSize)
+            {
+                EVP_DigestUpdate(GetRunningContext(), buffer, bufferSize);
+            }
+
+            HashResult Sha256OpenSSLImpl::GetHash()
+            {
+                auto ctx = GetRunningContext();
+                ByteBuffer hash(EVP_MD_size(EVP_sha256()));
+                EVP_DigestFinal_ex(ctx, hash.GetUnderlyingData(), nullptr);
+                //ready the context for the next running digest.
+                EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
+
+                return HashResult(std::move(hash));
+            }
+
             class HMACRAIIGuard {
             public:
                 HMACRAIIGuard() {
@@ -480,6 +515,59 @@ namespace Aws
                 return CryptoBuffer(finalBlock.GetUnderlyingData(), static_cast<size_t>(writtenSize));
             }
 
+            size_t OpenSSLCipher::EncryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength)
+            {
+                if (m_failure)
+                {
+                    AWS_LOGSTREAM_FATAL(OPENSSL_LOG_TAG, "Cipher not properly initialized for encryption. Aborting");
+                    return 0;
+                }
+
+                //EVP_EncryptUpdate can write up to a block less one more than it is given.
+                if (outputLength < dataLength + GetBlockSizeBytes() - 1)
+                {
+                    m_failure = true;
+                    AWS_LOGSTREAM_ERROR(OPENSSL_LOG_TAG, "Output buffer of " << outputLength << " bytes is too small to encrypt " << dataLength << " bytes.");
+                    return 0;
+                }
+
+                int lengthWritten = 0;
+                if (!EVP_EncryptUpdate(m_encryptor_ctx, output, &lengthWritten, data, static_cast<int>(dataLength)))
+                {
+                    m_failure = true;
+                    LogErrors();
+                    return 0;
+                }
+
+                return static_cast<size_t>(lengthWritten);
+            }
+
+            size_t OpenSSLCipher::DecryptToBuffer(const unsigned char* data, size_t dataLength, unsigned char* output, size_t outputLength)
+            {
+                if (m_failure)
+                {
+                    AWS_LOGSTREAM_FATAL(OPENSSL_LOG_TAG, "Cipher not properly initialized for decryption. Aborting");
+                    return 0;
+                }
+
+                if (outputLength < dataLength + GetBlockSizeBytes() - 1)
+                {
+                    m_failure = true;
+                    AWS_LOGSTREAM_ERROR(OPENSSL_LOG_TAG, "Output buffer of " << outputLength << " bytes is too small to decrypt " << dataLength << " bytes.");
+                    return 0;
+                }
+
+                int lengthWritten = 0;
+                if (!EVP_DecryptUpdate(m_decryptor_ctx, output, &lengthWritten, data, static_cast<int>(dataLength)))
+                {
+                    m_failure = true;
+                    LogErrors();
+                    return 0;
+                }
+
+                return static_cast<size_t>(lengthWritten);
+            }
+
             void OpenSSLCipher::Reset()
             {
                 Cleanup();
@@ -0,0 +1,599 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <climits>
+#include <cstdlib>
+
+using namespace Aws::Utils::Json;
+
+static const char JSON_READER_LOG_TAG[] = "JsonReader";
+//long enough for any number a double or a 64 bit integer can hold, written out in full.
+static const size_t MAX_NUMBER_LENGTH = 400;
+
+static inline bool IsNumberChar(char c)
+{
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+static inline bool IsWhitespace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static void AppendUtf8(Aws::String& value, uint32_t codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        value.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        value.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        value.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        value.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        value.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+JsonReader::JsonReader(Aws::IStream& stream) :
+    m_stream(stream),
+    m_position(0),
+    m_end(0),
+    m_bufferOffset(0),
+    m_atContainerStart(false)
+{
+}
+
+bool JsonReader::Refill()
+{
+    if (!m_errorMessage.empty() || !m_stream)
+    {
+        return false;
+    }
+
+    m_bufferOffset += m_end;
+    m_stream.read(m_buffer, BUFFER_SIZE);
+    m_end = static_cast<size_t>(m_stream.gcount());
+    m_position = 0;
+    return m_end > 0;
+}
+
+int JsonReader::Peek()
+{
+    if (!m_errorMessage.empty())
+    {
+        return -1;
+    }
+
+    for (;;)
+    {
+        while (m_position < m_end)
+        {
+            char c = m_buffer[m_position];
+            if (!IsWhitespace(c))
+            {
+                return static_cast<unsigned char>(c);
+            }
+            ++m_position;
+        }
+
+        if (!Refill())
+        {
+            return -1;
+        }
+    }
+}
+
+int JsonReader::NextRawChar()
+{
+    if (m_position == m_end && !Refill())
+    {
+        return -1;
+    }
+
+    return static_cast<unsigned char>(m_buffer[m_position++]);
+}
+
+void JsonReader::Fail(const char* reason)
+{
+    if (!m_errorMessage.empty())
+    {
+        return;
+    }
+
+    Aws::StringStream ss;
+    ss << "Failed to parse JSON at offset " << m_bufferOffset + m_position << ": " << reason;
+    m_errorMessage = ss.str();
+    AWS_LOGSTREAM_ERROR(JSON_READER_LOG_TAG, m_errorMessage);
+}
+
+bool JsonReader::ReadLiteral(const char* literal)
+{
+    for (; *literal; ++literal)
+    {
+        if (NextRawChar() != static_cast<unsigned char>(*literal))
+        {
+            Fail("invalid literal");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool JsonReader::BeginObject()
+{
+    int c = Peek();
+    if (c == '{')
+    {
+        ++m_position;
+        m_atContainerStart = true;
+        return true;
+    }
+
+    if (c != -1)
+    {
+        SkipValue();
+    }
+    return false;
+}
+
+bool JsonReader::NextMember(Aws::String& name)
+{
+    for (;;)
+    {
+        int c = Peek();
+        if (c == '}')
+        {
+            ++m_position;
+            m_atContainerStart = false;
+            return false;
+        }
+
+        if (m_atContainerStart)
+        {
+            m_atContainerStart = false;
+        }
+        else if (c == ',')
+        {
+            ++m_position;
+            c = Peek();
+        }
+        else
+        {
+            Fail("expected ',' or '}'");
+            return false;
+        }
+
+        if (c != '"')
+        {
+            Fail("expected a member name");
+            return false;
+        }
+
+        ++m_position;
+        if (!ParseString(name))
+        {
+            return false;
+        }
+
+        if (Peek() != ':')
+        {
+            Fail("expected ':'");
+            return false;
+        }
+        ++m_position;
+
+        if (Peek() != 'n')
+        {
+            return true;
+        }
+
+        if (!ReadLiteral("null"))
+        {
+            return false;
+        }
+    }
+}
+
+bool JsonReader::BeginArray()
+{
+    int c = Peek();
+    if (c == '[')
+    {
+        ++m_position;
+        m_atContainerStart = true;
+        return true;
+    }
+
+    if (c != -1)
+    {
+        SkipValue();
+    }
+    return false;
+}
+
+bool JsonReader::NextElement()
+{
+    int c = Peek();
+    if (c == ']')
+    {
+        ++m_position;
+        m_atContainerStart = false;
+        return false;
+    }
+
+    if (m_atContainerStart)
+    {
+        m_atContainerStart = false;
+    }
+    else if (c == ',')
+    {
+        ++m_position;
+    }
+    else
+    {
+        Fail("expected ',' or ']'");
+        return false;
+    }
+
+    return true;
+}
+
+bool JsonReader::ParseHex4(uint32_t& codePoint)
+{
+    codePoint = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        int c = NextRawChar();
+        codePoint <<= 4;
+        if (c >= '0' && c <= '9')
+        {
+            codePoint |= static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            codePoint |= static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            codePoint |= static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            Fail("invalid unicode escape");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//expects the opening quote to be consumed already.
+bool JsonReader::ParseString(Aws::String& value)
+{
+    value.clear();
+    for (;;)
+    {
+        size_t runStart = m_position;
+        while (m_position < m_end && m_buffer[m_position] != '"' && m_buffer[m_position] != '\\')
+        {
+            ++m_position;
+        }
+        value.append(m_buffer + runStart, m_position - runStart);
+
+        if (m_position == m_end)
+        {
+            if (!Refill())
+            {
+                Fail("unterminated string");
+                return false;
+            }
+            continue;
+        }
+
+        if (m_buffer[m_position++] == '"')
+        {
+            return true;
+        }
+
+        int escaped = NextRawChar();
+        switch (escaped)
+        {
+            case '"':
+            case '\\':
+            case '/':
+                value.push_back(static_cast<char>(escaped));
+                break;
+            case 'b':
+                value.push_back('\b');
+                break;
+            case 'f':
+                value.push_back('\f');
+                break;
+            case 'n':
+                value.push_back('\n');
+                break;
+            case 'r':
+                value.push_back('\r');
+                break;
+            case 't':
+                value.push_back('\t');
+                break;
+            case 'u':
+            {
+                uint32_t codePoint = 0;
+                if (!ParseHex4(codePoint))
+                {
+                    return false;
+                }
+
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                {
+                    //characters outside the basic multilingual plane come as a surrogate pair of escapes.
+                    uint32_t lowSurrogate = 0;
+                    if (NextRawChar() != '\\' || NextRawChar() != 'u' || !ParseHex4(lowSurrogate) || lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+                    {
+                        Fail("invalid surrogate pair");
+                        return false;
+                    }
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                }
+                else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+                {
+                    Fail("invalid surrogate pair");
+                    return false;
+                }
+
+                AppendUtf8(value, codePoint);
+                break;
+            }
+            default:
+                Fail("invalid escape sequence");
+                return false;
+        }
+    }
+}
+
+bool JsonReader::SkipString()
+{
+    for (;;)
+    {
+        while (m_position < m_end && m_buffer[m_position] != '"' && m_buffer[m_position] != '\\')
+        {
+            ++m_position;
+        }
+
+        if (m_position == m_end)
+        {
+            if (!Refill())
+            {
+                Fail("unterminated string");
+                return false;
+            }
+            continue;
+        }
+
+        if (m_buffer[m_position++] == '"')
+        {
+            return true;
+        }
+
+        //the escaped character can't end the string; \u escapes are followed by plain hex digits.
+        if (NextRawChar() == -1)
+        {
+            Fail("unterminated string");
+            return false;
+        }
+    }
+}
+
+bool JsonReader::ParseNumber(char* text, size_t capacity)
+{
+    size_t length = 0;
+    for (;;)
+    {
+        if (m_position == m_end && !Refill())
+        {
+            break;
+        }
+
+        char c = m_buffer[m_position];
+        if (!IsNumberChar(c))
+        {
+            break;
+        }
+
+        if (length + 1 == capacity)
+        {
+            Fail("number too long");
+            return false;
+        }
+        text[length++] = c;
+        ++m_position;
+    }
+
+    text[length] = '\0';
+    if (length == 0)
+    {
+        Fail("expected a number");
+        return false;
+    }
+    return true;
+}
+
+Aws::String JsonReader::ReadString()
+{
+    Aws::String value;
+    if (Peek() == '"')
+    {
+        ++m_position;
+        ParseString(value);
+    }
+    else
+    {
+        SkipValue();
+    }
+    return value;
+}
+
+bool JsonReader::ReadBool()
+{
+    int c = Peek();
+    if (c == 't')
+    {
+        return ReadLiteral("true");
+    }
+
+    if (c == 'f')
+    {
+        ReadLiteral("false");
+    }
+    else
+    {
+        SkipValue();
+    }
+    return false;
+}
+
+double JsonReader::ReadDouble()
+{
+    int c = Peek();
+    if (c == '-' || (c >= '0' && c <= '9'))
+    {
+        char text[MAX_NUMBER_LENGTH];
+        if (ParseNumber(text, sizeof(text)))
+        {
+            return strtod(text, nullptr);
+        }
+        return 0.0;
+    }
+
+    SkipValue();
+    return 0.0;
+}
+
+long long JsonReader::ReadInt64()
+{
+    int c = Peek();
+    if (c == '-' || (c >= '0' && c <= '9'))
+    {
+        char text[MAX_NUMBER_LENGTH];
+        if (!ParseNumber(text, sizeof(text)))
+        {
+            return 0;
+        }
+
+        for (const char* digit = text; *digit; ++digit)
+        {
+            if (*digit == '.' || *digit == 'e' || *digit == 'E')
+            {
+                return static_cast<long long>(strtod(text, nullptr));
+            }
+        }
+        return strtoll(text, nullptr, 10);
+    }
+
+    SkipValue();
+    return 0;
+}
+
+int JsonReader::ReadInteger()
+{
+    long long value = ReadInt64();
+    if (value > INT_MAX)
+    {
+        return INT_MAX;
+    }
+    if (value < INT_MIN)
+    {
+        return INT_MIN;
+    }
+    return static_cast<int>(value);
+}
+
+void JsonReader::SkipValue()
+{
+    m_atContainerStart = false;
+    size_t depth = 0;
+    do
+    {
+        int c = Peek();
+        switch (c)
+        {
+            case '{':
+            case '[':
+                ++m_position;
+                ++depth;
+                break;
+            case '}':
+            case ']':
+                if (depth == 0)
+                {
+                    Fail("expected a value");
+                    return;
+                }
+                ++m_position;
+                --depth;
+                break;
+            case ',':
+            case ':':
+                if (depth == 0)
+                {
+                    Fail("expected a value");
+                    return;
+                }
+                ++m_position;
+                break;
+            case '"':
+                ++m_position;
+                SkipString();
+                break;
+            case 't':
+                ReadLiteral("true");
+                break;
+            case 'f':
+                ReadLiteral("false");
+                break;
+            case 'n':
+                ReadLiteral("null");
+                break;
+            case -1:
+                Fail("unexpected end of document");
+                return;
+            default:
+            {
+                char text[MAX_NUMBER_LENGTH];
+                ParseNumber(text, sizeof(text));
+                break;
+            }
+        }
+    } while (depth > 0 && m_errorMessage.empty());
+}
@@ -532,6 +532,25 @@ Aws::Map<Aws::String, JsonView> JsonView::GetAllObjects() const
     return valueMap;
 }
 
+JsonView JsonView::GetFirstMember() const
+{
+    if (!cJSON_IsObject(m_value))
+    {
+        return nullptr;
+    }
+    return m_value->child;
+}
+
+JsonView JsonView::GetNextMember() const
+{
+    return m_value ? m_value->next : nullptr;
+}
+
+const char* JsonView::GetMemberName() const
+{
+    return m_value ? m_value->string : nullptr;
+}
+
 bool JsonView::ValueExists(const Aws::String& key) const
 {
     if (!cJSON_IsObject(m_value))
@@ -0,0 +1,233 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/json/JsonWriter.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/base64/Base64.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+JsonWriter::JsonWriter(Aws::String& buffer) :
+    m_buffer(buffer),
+    m_needsSeparator(false)
+{
+}
+
+void JsonWriter::BeginValue()
+{
+    if (m_needsSeparator)
+    {
+        m_buffer.push_back(',');
+    }
+}
+
+void JsonWriter::StartObject()
+{
+    BeginValue();
+    m_buffer.push_back('{');
+    m_needsSeparator = false;
+}
+
+void JsonWriter::EndObject()
+{
+    m_buffer.push_back('}');
+    m_needsSeparator = true;
+}
+
+void JsonWriter::StartArray()
+{
+    BeginValue();
+    m_buffer.push_back('[');
+    m_needsSeparator = false;
+}
+
+void JsonWriter::EndArray()
+{
+    m_buffer.push_back(']');
+    m_needsSeparator = true;
+}
+
+void JsonWriter::WriteKey(const char* name)
+{
+    BeginValue();
+    AppendEscaped(name, strlen(name));
+    m_buffer.push_back(':');
+    m_needsSeparator = false;
+}
+
+void JsonWriter::WriteKey(const Aws::String& name)
+{
+    BeginValue();
+    AppendEscaped(name.c_str(), name.size());
+    m_buffer.push_back(':');
+    m_needsSeparator = false;
+}
+
+void JsonWriter::WriteString(const char* value)
+{
+    BeginValue();
+    AppendEscaped(value, strlen(value));
+    m_needsSeparator = true;
+}
+
+void JsonWriter::WriteString(const Aws::String& value)
+{
+    BeginValue();
+    AppendEscaped(value.c_str(), value.size());
+    m_needsSeparator = true;
+}
+
+void JsonWriter::WriteBool(bool value)
+{
+    BeginValue();
+    m_buffer.append(value ? "true" : "false");
+    m_needsSeparator = true;
+}
+
+void JsonWriter::WriteInteger(int value)
+{
+    WriteInt64(value);
+}
+
+void JsonWriter::WriteInt64(long long value)
+{
+    BeginValue();
+    //build the digits backwards; negate as unsigned so LLONG_MIN works too.
+    char digits[24];
+    char* end = digits + sizeof(digits);
+    char* start = end;
+    unsigned long long magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+    do
+    {
+        *--start = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+
+    if (value < 0)
+    {
+        *--start = '-';
+    }
+    m_buffer.append(start, end - start);
+    m_needsSeparator = true;
+}
+
+void JsonWriter::WriteDouble(double value)
+{
+    if (std::isnan(value) || std::isinf(value))
+    {
+        WriteNull();
+        return;
+    }
+
+    BeginValue();
+    //same as cJSON: 15 significant digits unless that doesn't round trip.
+    char number[32];
+    int length = snprintf(number, sizeof(number), "%1.15g", value);
+    if (strtod(number, nullptr) != value)
+    {
+        length = snprintf(number, sizeof(number), "%1.17g", value);
+    }
+
+    for (int i = 0; i < length; ++i)
+    {
+        //printf uses the locale's decimal point.
+        m_buffer.push_back(number[i] == ',' ? '.' : number[i]);
+    }
+    m_needsSeparator = true;
+}
+
+void JsonWriter::WriteNull()
+{
+    BeginValue();
+    m_buffer.append("null");
+    m_needsSeparator = true;
+}
+
+void JsonWriter::WriteBase64(const ByteBuffer& value)
+{
+    BeginValue();
+    m_buffer.push_back('"');
+    //encoded straight into the document instead of through a temporary string.
+    size_t position = m_buffer.size();
+    m_buffer.resize(position + Base64::Base64::CalculateBase64EncodedLength(value.GetLength()));
+    HashingUtils::Base64Encode(value.GetUnderlyingData(), value.GetLength(), &m_buffer[position]);
+    m_buffer.push_back('"');
+    m_needsSeparator = true;
+}
+
+void JsonWriter::WriteRaw(const Aws::String& json)
+{
+    BeginValue();
+    m_buffer.append(json);
+    m_needsSeparator = true;
+}
+
+void JsonWriter::AppendEscaped(const char* value, size_t length)
+{
+    m_buffer.push_back('"');
+    size_t runStart = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        unsigned char c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        //copy everything that needs no escaping in one go.
+        m_buffer.append(value + runStart, i - runStart);
+        runStart = i + 1;
+        m_buffer.push_back('\\');
+        switch (c)
+        {
+            case '"':
+                m_buffer.push_back('"');
+                break;
+            case '\\':
+                m_buffer.push_back('\\');
+                break;
+            case '\b':
+                m_buffer.push_back('b');
+                break;
+            case '\f':
+                m_buffer.push_back('f');
+                break;
+            case '\n':
+                m_buffer.push_back('n');
+                break;
+            case '\r':
+                m_buffer.push_back('r');
+                break;
+            case '\t':
+                m_buffer.push_back('t');
+                break;
+            default:
+                m_buffer.append("u00");
+                m_buffer.push_back(HEX_DIGITS[c >> 4]);
+                m_buffer.push_back(HEX_DIGITS[c & 0x0F]);
+                break;
+        }
+    }
+    m_buffer.append(value + runStart, length - runStart);
+    m_buffer.push_back('"');
+}
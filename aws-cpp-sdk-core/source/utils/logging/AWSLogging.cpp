@@ -32,8 +32,11 @@ namespace Utils
 {
 namespace Logging {
 
+std::atomic<LogLevel> CachedLogLevel(LogLevel::Off);
+
 void InitializeAWSLogging(const std::shared_ptr<LogSystemInterface> &logSystem) {
     AWSLogSystem = logSystem;
+    RefreshCachedLogLevel();
 }
 
 void ShutdownAWSLogging(void) {
@@ -44,16 +47,24 @@ LogSystemInterface *GetLogSystem() {
     return AWSLogSystem.get();
 }
 
+void RefreshCachedLogLevel()
+{
+    LogSystemInterface* logSystem = AWSLogSystem.get();
+    CachedLogLevel.store(logSystem ? logSystem->GetLogLevel() : LogLevel::Off, std::memory_order_relaxed);
+}
+
 void PushLogger(const std::shared_ptr<LogSystemInterface> &logSystem)
 {
     OldLogger = AWSLogSystem;
     AWSLogSystem = logSystem;
+    RefreshCachedLogLevel();
 }
 
 void PopLogger()
 {
     AWSLogSystem = OldLogger;
     OldLogger = nullptr;
+    RefreshCachedLogLevel();
 }
 
 } // namespace Logging
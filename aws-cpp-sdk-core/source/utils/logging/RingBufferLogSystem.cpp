@@ -0,0 +1,517 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/logging/RingBufferLogSystem.h>
+
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <stdio.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+
+static const char* AllocationTag = "RingBufferLogSystem";
+static const size_t RECORD_ALIGNMENT = 8;
+static const size_t MIN_RING_BUFFER_BYTES = 4 * 1024;
+static const size_t MAX_DEFAULT_RING_COUNT = 64;
+static const size_t MAX_TAG_LENGTH = 256;
+static const size_t BATCH_WRITE_BYTES = 64 * 1024;
+static const size_t MAX_CACHED_THREAD_IDS = 1024;
+static const std::chrono::milliseconds DRAIN_INTERVAL(50);
+
+struct RingBufferLogSystem::RecordHeader
+{
+    uint32_t recordBytes;
+    uint32_t messageLength;
+    uint16_t tagLength;
+    uint8_t level;
+    uint8_t isPadding;
+    int64_t timestampMs;
+    std::thread::id threadId;
+};
+
+/**
+ * Single producer, single consumer byte ring. head and tail only grow; the producer owns head, the drainer owns tail,
+ * and inUse hands the producer side to one logging thread at a time.
+ */
+struct RingBufferLogSystem::Ring
+{
+    Ring(size_t bytes) :
+        inUse(false), head(0), tail(0), buffer(Aws::NewArray<char>(bytes, AllocationTag)), capacity(bytes)
+    {
+    }
+
+    ~Ring()
+    {
+        Aws::DeleteArray(buffer);
+    }
+
+    std::atomic<bool> inUse;
+    char inUsePadding[64];
+    std::atomic<uint64_t> head;
+    char headPadding[64];
+    std::atomic<uint64_t> tail;
+    char tailPadding[64];
+    char* buffer;
+    size_t capacity;
+};
+
+static size_t AlignRecord(size_t bytes)
+{
+    return (bytes + RECORD_ALIGNMENT - 1) / RECORD_ALIGNMENT * RECORD_ALIGNMENT;
+}
+
+static std::shared_ptr<Aws::OFStream> MakeLogFile(const Aws::String& filenamePrefix)
+{
+    Aws::String newFileName = filenamePrefix + DateTime::CalculateGmtTimestampAsString("%Y-%m-%d-%H") + ".log";
+    return Aws::MakeShared<Aws::OFStream>(AllocationTag, newFileName.c_str(), Aws::OFStream::out | Aws::OFStream::app);
+}
+
+static const char* GetLevelPrefix(uint8_t level, size_t& length)
+{
+    const char* prefix = nullptr;
+    switch(static_cast<LogLevel>(level))
+    {
+        case LogLevel::Error:
+            prefix = "[ERROR] ";
+            break;
+
+        case LogLevel::Fatal:
+            prefix = "[FATAL] ";
+            break;
+
+        case LogLevel::Warn:
+            prefix = "[WARN] ";
+            break;
+
+        case LogLevel::Info:
+            prefix = "[INFO] ";
+            break;
+
+        case LogLevel::Debug:
+            prefix = "[DEBUG] ";
+            break;
+
+        case LogLevel::Trace:
+            prefix = "[TRACE] ";
+            break;
+
+        default:
+            prefix = "[UNKOWN] ";
+            break;
+    }
+    length = strlen(prefix);
+    return prefix;
+}
+
+RingBufferLogSystem::RingBufferLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, size_t ringCount, size_t ringBufferBytes) :
+    m_logLevel(logLevel),
+    m_droppedStatements(0),
+    m_drainerWaiting(false),
+    m_wakeRequested(false),
+    m_stopDraining(false),
+    m_flushRequested(0),
+    m_flushCompleted(0),
+    m_log(logFile),
+    m_rollLog(false),
+    m_lastRolledHour(0),
+    m_cachedSecond(-1),
+    m_cachedSecondLength(0)
+{
+    StartDrainer(ringCount, ringBufferBytes);
+}
+
+RingBufferLogSystem::RingBufferLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, size_t ringCount, size_t ringBufferBytes) :
+    m_logLevel(logLevel),
+    m_droppedStatements(0),
+    m_drainerWaiting(false),
+    m_wakeRequested(false),
+    m_stopDraining(false),
+    m_flushRequested(0),
+    m_flushCompleted(0),
+    m_log(MakeLogFile(filenamePrefix)),
+    m_filenamePrefix(filenamePrefix),
+    m_rollLog(true),
+    // localtime requires access to env. variables to get Timezone, which is not thread-safe
+    m_lastRolledHour(DateTime::Now().GetHour(false /*localtime*/)),
+    m_cachedSecond(-1),
+    m_cachedSecondLength(0)
+{
+    StartDrainer(ringCount, ringBufferBytes);
+}
+
+RingBufferLogSystem::~RingBufferLogSystem()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_drainLock);
+        m_stopDraining = true;
+    }
+    m_drainSignal.notify_one();
+    m_drainer.join();
+
+    for (auto ring : m_rings)
+    {
+        Aws::Delete(ring);
+    }
+}
+
+void RingBufferLogSystem::StartDrainer(size_t ringCount, size_t ringBufferBytes)
+{
+    if (ringCount == 0)
+    {
+        ringCount = (std::min)(MAX_DEFAULT_RING_COUNT, (std::max)(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(2)) * 2);
+    }
+    ringBufferBytes = AlignRecord((std::max)(ringBufferBytes, MIN_RING_BUFFER_BYTES));
+
+    m_rings.reserve(ringCount);
+    for (size_t i = 0; i < ringCount; ++i)
+    {
+        m_rings.push_back(Aws::New<Ring>(AllocationTag, ringBufferBytes));
+    }
+    m_batch.reserve(BATCH_WRITE_BYTES + ringBufferBytes);
+
+    m_drainer = std::thread(&RingBufferLogSystem::RunDrainer, this);
+}
+
+void RingBufferLogSystem::Log(LogLevel logLevel, const char* tag, const char* formatStr, ...)
+{
+    va_list args;
+    va_start(args, formatStr);
+    Append(logLevel, tag, nullptr, 0, formatStr, &args);
+    va_end(args);
+}
+
+void RingBufferLogSystem::LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream& messageStream)
+{
+    //str() is the only way to read a string stream, this copy is the one allocation on this path.
+    Aws::String message = messageStream.str();
+    Append(logLevel, tag, message.data(), message.size(), nullptr, nullptr);
+}
+
+RingBufferLogSystem::Ring& RingBufferLogSystem::AcquireRing()
+{
+    //pthread ids are aligned addresses, mix the bits before reducing so threads spread over all rings.
+    uint64_t hash = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) * 0x9E3779B97F4A7C15ULL;
+    Ring& ring = *m_rings[static_cast<size_t>(hash >> 32) % m_rings.size()];
+
+    //a thread always writes to the same ring, that is what keeps its statements in order.
+    //threads sharing the ring only hold it for a copy, so spin rather than sleep.
+    bool expected = false;
+    while (ring.inUse.load(std::memory_order_relaxed) ||
+        !ring.inUse.compare_exchange_weak(expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        expected = false;
+        std::this_thread::yield();
+    }
+    return ring;
+}
+
+void RingBufferLogSystem::Append(LogLevel logLevel, const char* tag, const char* message, size_t messageLength, const char* formatStr, va_list* args)
+{
+    size_t tagLength = (std::min)(strlen(tag), MAX_TAG_LENGTH);
+    if (formatStr)
+    {
+        va_list tmp_args; //unfortunately you cannot consume a va_list twice
+        va_copy(tmp_args, *args); //so we have to copy it
+#ifdef WIN32
+        int requiredLength = _vscprintf(formatStr, tmp_args);
+#else
+        int requiredLength = vsnprintf(nullptr, 0, formatStr, tmp_args);
+#endif // WIN32
+        va_end(tmp_args);
+        messageLength = requiredLength > 0 ? static_cast<size_t>(requiredLength) : 0;
+    }
+
+    Ring& ring = AcquireRing();
+
+    //one byte more than the message for the terminator vsnprintf always writes.
+    size_t maxMessageLength = ring.capacity / 2 - sizeof(RecordHeader) - MAX_TAG_LENGTH - RECORD_ALIGNMENT;
+    messageLength = (std::min)(messageLength, maxMessageLength);
+    size_t recordBytes = AlignRecord(sizeof(RecordHeader) + tagLength + messageLength + 1);
+
+    uint64_t head = ring.head.load(std::memory_order_relaxed);
+    size_t offset = static_cast<size_t>(head % ring.capacity);
+    size_t contiguous = ring.capacity - offset;
+    size_t requiredBytes = recordBytes + (contiguous < recordBytes ? contiguous : 0);
+    //a full ring means the drainer is behind; waiting for it would stall the caller on the output, so drop the statement.
+    if (ring.capacity - static_cast<size_t>(head - ring.tail.load(std::memory_order_acquire)) < requiredBytes)
+    {
+        ring.inUse.store(false, std::memory_order_release);
+        m_droppedStatements.fetch_add(1, std::memory_order_relaxed);
+        WakeDrainer();
+        return;
+    }
+
+    //records never wrap; skip to the start of the ring and leave a padding record behind when there is room for a header.
+    if (contiguous < recordBytes)
+    {
+        if (contiguous >= sizeof(RecordHeader))
+        {
+            RecordHeader padding = RecordHeader();
+            padding.recordBytes = static_cast<uint32_t>(contiguous);
+            padding.isPadding = 1;
+            memcpy(ring.buffer + offset, &padding, sizeof(padding));
+        }
+        head += contiguous;
+        offset = 0;
+    }
+
+    RecordHeader header = RecordHeader();
+    header.recordBytes = static_cast<uint32_t>(recordBytes);
+    header.messageLength = static_cast<uint32_t>(messageLength);
+    header.tagLength = static_cast<uint16_t>(tagLength);
+    header.level = static_cast<uint8_t>(logLevel);
+    header.timestampMs = DateTime::CurrentTimeMillis();
+    header.threadId = std::this_thread::get_id();
+
+    char* record = ring.buffer + offset;
+    memcpy(record, &header, sizeof(header));
+    memcpy(record + sizeof(header), tag, tagLength);
+    char* messageStart = record + sizeof(header) + tagLength;
+    if (formatStr)
+    {
+#ifdef WIN32
+        vsnprintf_s(messageStart, messageLength + 1, _TRUNCATE, formatStr, *args);
+#else
+        vsnprintf(messageStart, messageLength + 1, formatStr, *args);
+#endif // WIN32
+    }
+    else
+    {
+        memcpy(messageStart, message, messageLength);
+    }
+
+    head += recordBytes;
+    ring.head.store(head, std::memory_order_release);
+    size_t usedBytes = static_cast<size_t>(head - ring.tail.load(std::memory_order_relaxed));
+    ring.inUse.store(false, std::memory_order_release);
+
+    if (usedBytes > ring.capacity / 2)
+    {
+        WakeDrainer();
+    }
+}
+
+void RingBufferLogSystem::WakeDrainer()
+{
+    //only the first thread to see the drainer asleep takes the lock.
+    if (m_drainerWaiting.exchange(false))
+    {
+        std::lock_guard<std::mutex> locker(m_drainLock);
+        m_wakeRequested = true;
+        m_drainSignal.notify_one();
+    }
+}
+
+void RingBufferLogSystem::Flush()
+{
+    std::unique_lock<std::mutex> locker(m_drainLock);
+    uint64_t ticket = ++m_flushRequested;
+    m_drainSignal.notify_one();
+    m_flushSignal.wait(locker, [&](){ return m_flushCompleted >= ticket; });
+}
+
+void RingBufferLogSystem::RunDrainer()
+{
+    for(;;)
+    {
+        uint64_t flushTarget = 0;
+        bool stopping = false;
+        {
+            std::unique_lock<std::mutex> locker(m_drainLock);
+            auto hasWork = [this](){ return m_stopDraining || m_wakeRequested || m_flushRequested != m_flushCompleted; };
+            if (!hasWork())
+            {
+                m_drainerWaiting = true;
+                m_drainSignal.wait_for(locker, DRAIN_INTERVAL, hasWork);
+                m_drainerWaiting = false;
+            }
+            m_wakeRequested = false;
+            flushTarget = m_flushRequested;
+            stopping = m_stopDraining;
+        }
+
+        //heads are read after the flush ticket, so this pass covers everything logged before Flush() was called.
+        DrainOnce();
+
+        {
+            std::lock_guard<std::mutex> locker(m_drainLock);
+            m_flushCompleted = flushTarget;
+        }
+        m_flushSignal.notify_all();
+
+        if (stopping)
+        {
+            break;
+        }
+    }
+}
+
+void RingBufferLogSystem::DrainOnce()
+{
+    struct Cursor
+    {
+        Ring* ring;
+        uint64_t tail;
+        uint64_t head;
+        RecordHeader header;
+    };
+
+    //moves the cursor to its next real record, publishing the skipped padding once the ring is empty.
+    auto loadRecord = [](Cursor& cursor)
+    {
+        while (cursor.tail < cursor.head)
+        {
+            size_t offset = static_cast<size_t>(cursor.tail % cursor.ring->capacity);
+            size_t contiguous = cursor.ring->capacity - offset;
+            if (contiguous < sizeof(RecordHeader))
+            {
+                cursor.tail += contiguous;
+                continue;
+            }
+            memcpy(&cursor.header, cursor.ring->buffer + offset, sizeof(RecordHeader));
+            if (cursor.header.isPadding)
+            {
+                cursor.tail += cursor.header.recordBytes;
+                continue;
+            }
+            return true;
+        }
+        cursor.ring->tail.store(cursor.tail, std::memory_order_release);
+        return false;
+    };
+
+    Aws::Vector<Cursor> cursors;
+    cursors.reserve(m_rings.size());
+    for (auto ring : m_rings)
+    {
+        Cursor cursor;
+        cursor.ring = ring;
+        cursor.head = ring->head.load(std::memory_order_acquire);
+        cursor.tail = ring->tail.load(std::memory_order_relaxed);
+        if (loadRecord(cursor))
+        {
+            cursors.push_back(cursor);
+        }
+    }
+
+    //every ring is in timestamp order already, so taking the oldest head record each time merges them.
+    while (!cursors.empty())
+    {
+        size_t oldest = 0;
+        for (size_t i = 1; i < cursors.size(); ++i)
+        {
+            if (cursors[i].header.timestampMs < cursors[oldest].header.timestampMs)
+            {
+                oldest = i;
+            }
+        }
+
+        Cursor& cursor = cursors[oldest];
+        const char* record = cursor.ring->buffer + static_cast<size_t>(cursor.tail % cursor.ring->capacity);
+        FormatRecord(cursor.header, record + sizeof(RecordHeader), record + sizeof(RecordHeader) + cursor.header.tagLength);
+
+        //the record is copied into the batch, its space can go back to the producers right away.
+        cursor.tail += cursor.header.recordBytes;
+        cursor.ring->tail.store(cursor.tail, std::memory_order_release);
+        if (!loadRecord(cursor))
+        {
+            cursors.erase(cursors.begin() + oldest);
+        }
+
+        if (m_batch.size() >= BATCH_WRITE_BYTES)
+        {
+            WriteBatch();
+        }
+    }
+
+    WriteBatch();
+}
+
+void RingBufferLogSystem::FormatRecord(const RecordHeader& header, const char* tag, const char* message)
+{
+    int64_t second = header.timestampMs / 1000;
+    if (second != m_cachedSecond)
+    {
+        Aws::String secondText = DateTime(second * 1000).ToGmtString("%Y-%m-%d %H:%M:%S");
+        m_cachedSecondLength = (std::min)(secondText.size(), sizeof(m_cachedSecondText));
+        memcpy(m_cachedSecondText, secondText.data(), m_cachedSecondLength);
+        m_cachedSecond = second;
+    }
+
+    auto threadIdText = m_threadIdText.find(header.threadId);
+    if (threadIdText == m_threadIdText.end())
+    {
+        //thread ids are only ever added, start over once a host has churned through many threads.
+        if (m_threadIdText.size() >= MAX_CACHED_THREAD_IDS)
+        {
+            m_threadIdText.clear();
+        }
+        Aws::OStringStream ss;
+        ss << header.threadId;
+        threadIdText = m_threadIdText.emplace(header.threadId, ss.str()).first;
+    }
+
+    size_t levelPrefixLength = 0;
+    const char* levelPrefix = GetLevelPrefix(header.level, levelPrefixLength);
+    int ms = static_cast<int>(header.timestampMs - second * 1000);
+    char msText[5] = { '.', char('0' + ms / 100), char('0' + ms / 10 % 10), char('0' + ms % 10), ' ' };
+
+    m_batch.append(levelPrefix, levelPrefixLength);
+    m_batch.append(m_cachedSecondText, m_cachedSecondLength);
+    m_batch.append(msText, sizeof(msText));
+    m_batch.append(tag, header.tagLength);
+    m_batch.append(" [", 2);
+    m_batch.append(threadIdText->second);
+    m_batch.append("] ", 2);
+    m_batch.append(message, header.messageLength);
+    m_batch.push_back('\n');
+}
+
+void RingBufferLogSystem::WriteBatch()
+{
+    if (m_batch.empty())
+    {
+        return;
+    }
+
+    RollLogFileIfNeeded();
+    m_log->write(m_batch.data(), static_cast<std::streamsize>(m_batch.size()));
+    m_log->flush();
+    m_batch.clear();
+}
+
+void RingBufferLogSystem::RollLogFileIfNeeded()
+{
+    if (!m_rollLog)
+    {
+        return;
+    }
+
+    // localtime requires access to env. variables to get Timezone, which is not thread-safe
+    int32_t currentHour = DateTime::Now().GetHour(false /*localtime*/);
+    if (currentHour != m_lastRolledHour)
+    {
+        m_log = MakeLogFile(m_filenamePrefix);
+        m_lastRolledHour = currentHour;
+    }
+}
@@ -0,0 +1,257 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+using namespace Aws::Utils::Memory;
+
+static const char* ARENA_MEMORY_SYSTEM_TAG = "ArenaMemorySystem";
+
+//every allocation is preceded by an AllocationHeader; 16 bytes keeps what follows aligned like malloc's memory.
+static const size_t HEADER_SIZE = 16;
+static const size_t FIRST_BLOCK_SIZE = 4 * 1024;
+static const size_t MAX_BLOCK_SIZE = 1024 * 1024;
+
+struct ArenaMemorySystem::Arena
+{
+    struct Block
+    {
+        Block* next;
+    };
+
+    Block* blocks;
+    char* position;
+    char* end;
+    size_t nextBlockSize;
+    //one for the scope that owns the arena plus one per allocation that has not been freed.
+    std::atomic<size_t> references;
+};
+
+struct ArenaMemorySystem::AllocationHeader
+{
+    //the arena the allocation came from, or null if it came from the underlying allocator.
+    Arena* arena;
+    //what the underlying allocator returned, which is in front of the header when the allocation had to be aligned.
+    void* rawMemory;
+};
+
+namespace
+{
+    struct ThreadArena
+    {
+        unsigned scopeDepth;
+        ArenaMemorySystem* system;
+        void* arena;
+    };
+
+    thread_local ThreadArena threadArena = { 0, nullptr, nullptr };
+
+    size_t RoundUp(size_t size)
+    {
+        return (size + HEADER_SIZE - 1) & ~(HEADER_SIZE - 1);
+    }
+
+    //bytes to skip at position so that the memory after a header placed there starts at a multiple of alignment.
+    size_t AlignmentPadding(const char* position, size_t alignment)
+    {
+        uintptr_t start = reinterpret_cast<uintptr_t>(position) + HEADER_SIZE;
+        return static_cast<size_t>((alignment - start % alignment) % alignment);
+    }
+
+    //blocks from the underlying allocator are HEADER_SIZE aligned, so this much padding is always enough.
+    size_t MaxAlignmentPadding(size_t alignment)
+    {
+        return alignment > HEADER_SIZE ? alignment - HEADER_SIZE : 0;
+    }
+}
+
+ArenaMemorySystem::ArenaMemorySystem(MemorySystemInterface* underlying) :
+    m_underlying(underlying),
+    m_liveArenas(0)
+{
+}
+
+void* ArenaMemorySystem::AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    static_assert(sizeof(AllocationHeader) <= HEADER_SIZE, "the allocation header must fit in HEADER_SIZE");
+    alignment = (std::max)(alignment, alignof(std::max_align_t));
+
+    if (threadArena.scopeDepth > 0)
+    {
+        if (threadArena.arena == nullptr)
+        {
+            threadArena.arena = CreateArena();
+            threadArena.system = this;
+        }
+
+        if (threadArena.system == this)
+        {
+            return AllocateFromArena(*static_cast<Arena*>(threadArena.arena), blockSize, alignment);
+        }
+    }
+
+    char* rawMemory = static_cast<char*>(AllocateRaw(HEADER_SIZE + MaxAlignmentPadding(alignment) + blockSize, allocationTag));
+    if (rawMemory == nullptr)
+    {
+        return nullptr;
+    }
+
+    char* memory = rawMemory + AlignmentPadding(rawMemory, alignment);
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(memory);
+    header->arena = nullptr;
+    header->rawMemory = rawMemory;
+    return memory + HEADER_SIZE;
+}
+
+void ArenaMemorySystem::FreeMemory(void* memoryPtr)
+{
+    if (memoryPtr == nullptr)
+    {
+        return;
+    }
+
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(static_cast<char*>(memoryPtr) - HEADER_SIZE);
+    if (header->arena)
+    {
+        ReleaseArena(header->arena);
+    }
+    else
+    {
+        FreeRaw(header->rawMemory);
+    }
+}
+
+ArenaMemorySystem::Arena* ArenaMemorySystem::CreateArena()
+{
+    Arena* arena = static_cast<Arena*>(AllocateRaw(sizeof(Arena), ARENA_MEMORY_SYSTEM_TAG));
+    arena->blocks = nullptr;
+    arena->position = nullptr;
+    arena->end = nullptr;
+    arena->nextBlockSize = FIRST_BLOCK_SIZE;
+    new (&arena->references) std::atomic<size_t>(1);
+    ++m_liveArenas;
+    return arena;
+}
+
+void* ArenaMemorySystem::AllocateFromArena(Arena& arena, std::size_t blockSize, std::size_t alignment)
+{
+    size_t size = HEADER_SIZE + RoundUp(blockSize);
+    if (static_cast<size_t>(arena.end - arena.position) < AlignmentPadding(arena.position, alignment) + size)
+    {
+        //a value bigger than the next block gets a block of its own.
+        size_t newBlockSize = (std::max)(arena.nextBlockSize, RoundUp(sizeof(Arena::Block)) + MaxAlignmentPadding(alignment) + size);
+        auto block = static_cast<Arena::Block*>(AllocateRaw(newBlockSize, ARENA_MEMORY_SYSTEM_TAG));
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+
+        block->next = arena.blocks;
+        arena.blocks = block;
+        arena.position = reinterpret_cast<char*>(block) + RoundUp(sizeof(Arena::Block));
+        arena.end = reinterpret_cast<char*>(block) + newBlockSize;
+        arena.nextBlockSize = (std::min)(arena.nextBlockSize * 2, MAX_BLOCK_SIZE);
+    }
+
+    char* memory = arena.position + AlignmentPadding(arena.position, alignment);
+    arena.position = memory + size;
+    arena.references.fetch_add(1, std::memory_order_relaxed);
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(memory);
+    header->arena = &arena;
+    header->rawMemory = nullptr;
+    return memory + HEADER_SIZE;
+}
+
+void ArenaMemorySystem::ReleaseArena(Arena* arena)
+{
+    if (arena->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return;
+    }
+
+    Arena::Block* block = arena->blocks;
+    while (block)
+    {
+        Arena::Block* next = block->next;
+        FreeRaw(block);
+        block = next;
+    }
+
+    typedef std::atomic<size_t> AtomicSize;
+    arena->references.~AtomicSize();
+    FreeRaw(arena);
+    --m_liveArenas;
+}
+
+void* ArenaMemorySystem::AllocateRaw(std::size_t size, const char* allocationTag)
+{
+    if (m_underlying)
+    {
+        return m_underlying->AllocateMemory(size, HEADER_SIZE, allocationTag);
+    }
+
+    return malloc(size);
+}
+
+void ArenaMemorySystem::FreeRaw(void* memoryPtr)
+{
+    if (m_underlying)
+    {
+        m_underlying->FreeMemory(memoryPtr);
+    }
+    else
+    {
+        free(memoryPtr);
+    }
+}
+
+ArenaScope::ArenaScope()
+{
+    ++threadArena.scopeDepth;
+}
+
+ArenaScope::~ArenaScope()
+{
+    if (--threadArena.scopeDepth == 0 && threadArena.arena)
+    {
+        auto arena = static_cast<ArenaMemorySystem::Arena*>(threadArena.arena);
+        ArenaMemorySystem* system = threadArena.system;
+        threadArena.arena = nullptr;
+        threadArena.system = nullptr;
+        system->ReleaseArena(arena);
+    }
+}
+
+SuspendArenaScope::SuspendArenaScope() :
+    m_scopeDepth(threadArena.scopeDepth),
+    m_system(threadArena.system),
+    m_arena(threadArena.arena)
+{
+    threadArena.scopeDepth = 0;
+    threadArena.system = nullptr;
+    threadArena.arena = nullptr;
+}
+
+SuspendArenaScope::~SuspendArenaScope()
+{
+    threadArena.scopeDepth = m_scopeDepth;
+    threadArena.system = m_system;
+    threadArena.arena = m_arena;
+}
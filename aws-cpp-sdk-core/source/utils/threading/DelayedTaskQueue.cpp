@@ -0,0 +1,148 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/DelayedTaskQueue.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <algorithm>
+#include <cassert>
+#include <exception>
+
+using namespace Aws::Utils::Threading;
+
+static const char DELAYED_TASK_QUEUE_LOG_TAG[] = "DelayedTaskQueue";
+
+bool DelayedTaskQueue::LaterDeadlineFirst::operator()(const DelayedTask& lhs, const DelayedTask& rhs) const
+{
+    if (lhs.deadline != rhs.deadline)
+    {
+        return lhs.deadline > rhs.deadline;
+    }
+    return lhs.sequence > rhs.sequence;
+}
+
+DelayedTaskQueue::DelayedTaskQueue() : m_sequence(0), m_stopped(false)
+{
+}
+
+DelayedTaskQueue::~DelayedTaskQueue()
+{
+    //the timer thread can't join itself, and detaching it would leave Run using a destroyed queue.
+    if (m_thread.joinable() && m_thread.get_id() == std::this_thread::get_id())
+    {
+        AWS_LOGSTREAM_FATAL(DELAYED_TASK_QUEUE_LOG_TAG, "A DelayedTaskQueue was destroyed by one of its own tasks.");
+        assert(false);
+        std::terminate();
+    }
+
+    Stop();
+}
+
+bool DelayedTaskQueue::Schedule(std::chrono::milliseconds delay, std::function<void()>&& task)
+{
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        if (m_stopped)
+        {
+            return false;
+        }
+
+        if (!m_thread.joinable())
+        {
+            m_thread = std::thread(&DelayedTaskQueue::Run, this);
+        }
+
+        DelayedTask delayedTask;
+        delayedTask.deadline = std::chrono::steady_clock::now() + delay;
+        delayedTask.sequence = m_sequence++;
+        delayedTask.task = std::move(task);
+        m_tasks.push_back(std::move(delayedTask));
+        std::push_heap(m_tasks.begin(), m_tasks.end(), LaterDeadlineFirst());
+    }
+
+    m_signal.notify_one();
+    return true;
+}
+
+void DelayedTaskQueue::Stop()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_stopped = true;
+    }
+
+    m_signal.notify_one();
+    //a task may stop its own queue. The timer thread can't join itself, so it is left joinable: Run returns once
+    //that task does, and the destructor joins it.
+    if (m_thread.joinable() && m_thread.get_id() != std::this_thread::get_id())
+    {
+        m_thread.join();
+    }
+
+    //whoever scheduled a task may be waiting on it, so run what is left now rather than dropping it.
+    //tasks can tell they are running early from IsStopped().
+    Aws::Vector<DelayedTask> pending;
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        pending.swap(m_tasks);
+    }
+
+    while (!pending.empty())
+    {
+        std::pop_heap(pending.begin(), pending.end(), LaterDeadlineFirst());
+        std::function<void()> task = std::move(pending.back().task);
+        pending.pop_back();
+        task();
+    }
+}
+
+bool DelayedTaskQueue::IsStopped() const
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    return m_stopped;
+}
+
+size_t DelayedTaskQueue::GetPendingTaskCount() const
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    return m_tasks.size();
+}
+
+void DelayedTaskQueue::Run()
+{
+    std::unique_lock<std::mutex> locker(m_lock);
+    while (!m_stopped)
+    {
+        if (m_tasks.empty())
+        {
+            m_signal.wait(locker);
+            continue;
+        }
+
+        auto deadline = m_tasks.front().deadline;
+        if (std::chrono::steady_clock::now() < deadline)
+        {
+            m_signal.wait_until(locker, deadline);
+            continue;
+        }
+
+        std::pop_heap(m_tasks.begin(), m_tasks.end(), LaterDeadlineFirst());
+        std::function<void()> task = std::move(m_tasks.back().task);
+        m_tasks.pop_back();
+
+        locker.unlock();
+        task();
+        locker.lock();
+    }
+}
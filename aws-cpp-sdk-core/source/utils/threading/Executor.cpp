@@ -22,6 +22,25 @@ static const char* POOLED_CLASS_TAG = "PooledThreadExecutor";
 
 using namespace Aws::Utils::Threading;
 
+bool Executor::SubmitToThreadAfter(std::chrono::milliseconds delay, std::function<void()>&& fx)
+{
+    return SubmitToThread([delay, fx] {
+        std::this_thread::sleep_for(delay);
+        fx();
+    });
+}
+
+bool DefaultExecutor::SubmitToThreadAfter(std::chrono::milliseconds delay, std::function<void()>&& fx)
+{
+    return m_delayedTasks.Schedule(delay, [this, fx]()
+    {
+        if (m_delayedTasks.IsStopped() || !SubmitToThread(std::function<void()>(fx)))
+        {
+            fx();
+        }
+    });
+}
+
 bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 {
     auto main = [fx, this] { 
@@ -67,6 +86,9 @@ void DefaultExecutor::Detach(std::thread::id id)
 
 DefaultExecutor::~DefaultExecutor()
 {
+    //the timer thread submits through this, stop it before tearing anything down.
+    m_delayedTasks.Stop();
+
     auto expected = State::Free;
     while(!m_state.compare_exchange_strong(expected, State::Shutdown))
     {
@@ -94,6 +116,9 @@ PooledThreadExecutor::PooledThreadExecutor(size_t poolSize, OverflowPolicy overf
 
 PooledThreadExecutor::~PooledThreadExecutor()
 {
+    //the timer thread submits through this, stop it before tearing anything down.
+    m_delayedTasks.Stop();
+
     for(auto threadTask : m_threadTaskHandles)
     {
         threadTask->StopProcessingWork();
@@ -141,6 +166,18 @@ bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
     return true;
 }
 
+bool PooledThreadExecutor::SubmitToThreadAfter(std::chrono::milliseconds delay, std::function<void()>&& fn)
+{
+    //run the task here if it can't be handed to a thread, a dropped task would strand whoever waits on it.
+    return m_delayedTasks.Schedule(delay, [this, fn]()
+    {
+        if (m_delayedTasks.IsStopped() || !SubmitToThread(std::function<void()>(fn)))
+        {
+            fn();
+        }
+    });
+}
+
 std::function<void()>* PooledThreadExecutor::PopTask()
 {
     std::lock_guard<std::mutex> locker(m_queueLock);
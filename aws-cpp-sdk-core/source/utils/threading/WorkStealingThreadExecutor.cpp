@@ -0,0 +1,459 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/WorkStealingThreadExecutor.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/UnreferencedParam.h>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace Aws::Utils::Threading;
+
+static const char* WORK_STEALING_TAG = "WorkStealingThreadExecutor";
+
+//slots per worker deque, must be a power of two. A full deque overflows into the worker's inbox.
+static const long long DEQUE_CAPACITY = 4096;
+//recycled task nodes kept per worker.
+static const size_t MAX_CACHED_TASK_NODES = 256;
+//rounds of yield-and-retry before an idle worker goes to sleep.
+static const int IDLE_SPINS = 16;
+
+struct WorkStealingThreadExecutor::TaskNode
+{
+    TaskNode* next;
+    TaskInvoker invoke;
+    TaskDestroyer destroy;
+    std::aligned_storage<INLINE_TASK_SIZE, alignof(std::max_align_t)>::type storage;
+};
+
+namespace
+{
+    /**
+     * Chase-Lev deque (Le, Pop, Cohen, Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory Models").
+     * The owning worker pushes and pops at the bottom, thieves take from the top. Fixed capacity, Push fails when full.
+     */
+    template<typename T>
+    class WorkStealingDeque
+    {
+    public:
+        WorkStealingDeque() : m_top(0), m_bottom(0), m_slots(Aws::NewArray<std::atomic<T*>>(static_cast<std::size_t>(DEQUE_CAPACITY), WORK_STEALING_TAG))
+        {
+        }
+
+        ~WorkStealingDeque()
+        {
+            Aws::DeleteArray(m_slots);
+        }
+
+        //owner only
+        bool Push(T* item)
+        {
+            long long bottom = m_bottom.load(std::memory_order_relaxed);
+            long long top = m_top.load(std::memory_order_acquire);
+            if (bottom - top >= DEQUE_CAPACITY)
+            {
+                return false;
+            }
+            m_slots[bottom & (DEQUE_CAPACITY - 1)].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        //owner only
+        T* Pop()
+        {
+            long long bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            long long top = m_top.load(std::memory_order_relaxed);
+            if (top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T* item = m_slots[bottom & (DEQUE_CAPACITY - 1)].load(std::memory_order_relaxed);
+            if (top == bottom)
+            {
+                //last item, race thieves for it.
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    item = nullptr;
+                }
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        //any thread
+        T* Steal()
+        {
+            long long top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            long long bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+            {
+                return nullptr;
+            }
+
+            T* item = m_slots[top & (DEQUE_CAPACITY - 1)].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+            return item;
+        }
+
+        bool IsEmpty() const
+        {
+            return m_bottom.load(std::memory_order_acquire) <= m_top.load(std::memory_order_acquire);
+        }
+
+    private:
+        //top and bottom are hammered by different threads, keep them off the same cache line.
+        alignas(64) std::atomic<long long> m_top;
+        alignas(64) std::atomic<long long> m_bottom;
+        std::atomic<T*>* m_slots;
+    };
+
+    void PinCurrentThreadToCore(size_t workerIndex)
+    {
+#if defined(__linux__)
+        unsigned cpuCount = std::thread::hardware_concurrency();
+        if (cpuCount == 0)
+        {
+            return;
+        }
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(static_cast<int>(workerIndex % cpuCount), &cpuSet);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) != 0)
+        {
+            AWS_LOGSTREAM_WARN(WORK_STEALING_TAG, "Failed to pin worker " << workerIndex << " to cpu " << workerIndex % cpuCount);
+        }
+#else
+        AWS_UNREFERENCED_PARAM(workerIndex);
+#endif
+    }
+}
+
+struct WorkStealingThreadExecutor::Worker
+{
+    Worker(WorkStealingThreadExecutor* executor, size_t workerIndex) :
+        owner(executor), index(workerIndex), inboxHead(nullptr), inboxTail(nullptr), inboxSize(0), freeList(nullptr), freeCount(0)
+    {
+    }
+
+    WorkStealingThreadExecutor* owner;
+    size_t index;
+    WorkStealingDeque<TaskNode> deque;
+
+    //submissions from threads outside the pool; thieves may take from here too.
+    std::mutex inboxLock;
+    TaskNode* inboxHead;
+    TaskNode* inboxTail;
+    std::atomic<size_t> inboxSize;
+
+    //only touched from this worker's thread.
+    TaskNode* freeList;
+    size_t freeCount;
+
+    std::thread thread;
+};
+
+WorkStealingThreadExecutor::WorkStealingThreadExecutor(size_t poolSize, bool pinThreadsToCores) :
+    m_nextInbox(0), m_continue(true), m_sleepingWorkers(0)
+{
+    if (poolSize == 0)
+    {
+        poolSize = std::thread::hardware_concurrency();
+        poolSize = poolSize ? poolSize : 1;
+    }
+
+    //all workers must exist before any thread starts looking for someone to steal from.
+    for (size_t index = 0; index < poolSize; ++index)
+    {
+        m_workers.push_back(Aws::New<Worker>(WORK_STEALING_TAG, this, index));
+    }
+
+    for (auto worker : m_workers)
+    {
+        worker->thread = std::thread(&WorkStealingThreadExecutor::RunWorker, this, worker, pinThreadsToCores);
+    }
+}
+
+WorkStealingThreadExecutor::~WorkStealingThreadExecutor()
+{
+    //the timer thread submits through this, stop it before tearing anything down.
+    m_delayedTasks.Stop();
+
+    {
+        std::lock_guard<std::mutex> locker(m_parkLock);
+        m_continue = false;
+    }
+    m_parkSignal.notify_all();
+
+    for (auto worker : m_workers)
+    {
+        worker->thread.join();
+    }
+
+    for (auto worker : m_workers)
+    {
+        while (TaskNode* node = worker->deque.Steal())
+        {
+            ReleaseTaskNode(node);
+        }
+
+        TaskNode* node = worker->inboxHead;
+        while (node)
+        {
+            TaskNode* next = node->next;
+            ReleaseTaskNode(node);
+            node = next;
+        }
+
+        node = worker->freeList;
+        while (node)
+        {
+            TaskNode* next = node->next;
+            Aws::Delete(node);
+            node = next;
+        }
+
+        Aws::Delete(worker);
+    }
+}
+
+bool WorkStealingThreadExecutor::SubmitToThread(std::function<void()>&& fn)
+{
+    return Enqueue(MakeTask(std::move(fn)));
+}
+
+bool WorkStealingThreadExecutor::SubmitToThreadAfter(std::chrono::milliseconds delay, std::function<void()>&& fn)
+{
+    //same as PooledThreadExecutor, a rejected task runs on the timer thread.
+    return m_delayedTasks.Schedule(delay, [this, fn]()
+    {
+        if (m_delayedTasks.IsStopped() || !SubmitToThread(std::function<void()>(fn)))
+        {
+            fn();
+        }
+    });
+}
+
+WorkStealingThreadExecutor::Worker*& WorkStealingThreadExecutor::CurrentWorker()
+{
+    static thread_local Worker* currentWorker = nullptr;
+    return currentWorker;
+}
+
+WorkStealingThreadExecutor::TaskNode* WorkStealingThreadExecutor::AllocateTaskNode()
+{
+    Worker* worker = CurrentWorker();
+    if (worker && worker->owner == this && worker->freeList)
+    {
+        TaskNode* node = worker->freeList;
+        worker->freeList = node->next;
+        worker->freeCount--;
+        return node;
+    }
+    return Aws::New<TaskNode>(WORK_STEALING_TAG);
+}
+
+void* WorkStealingThreadExecutor::TaskStorage(TaskNode* node)
+{
+    return &node->storage;
+}
+
+void WorkStealingThreadExecutor::SetTaskFunctions(TaskNode* node, TaskInvoker invoker, TaskDestroyer destroyer)
+{
+    node->next = nullptr;
+    node->invoke = invoker;
+    node->destroy = destroyer;
+}
+
+void WorkStealingThreadExecutor::ReleaseTaskNode(TaskNode* node)
+{
+    node->destroy(&node->storage);
+
+    Worker* worker = CurrentWorker();
+    if (worker && worker->owner == this && worker->freeCount < MAX_CACHED_TASK_NODES)
+    {
+        node->next = worker->freeList;
+        worker->freeList = node;
+        worker->freeCount++;
+        return;
+    }
+    Aws::Delete(node);
+}
+
+bool WorkStealingThreadExecutor::Enqueue(TaskNode* node)
+{
+    if (!m_continue)
+    {
+        ReleaseTaskNode(node);
+        return false;
+    }
+
+    Worker* current = CurrentWorker();
+    if (!current || current->owner != this || !current->deque.Push(node))
+    {
+        Worker* target = current && current->owner == this ? current : m_workers[m_nextInbox.fetch_add(1, std::memory_order_relaxed) % m_workers.size()];
+        std::lock_guard<std::mutex> locker(target->inboxLock);
+        node->next = nullptr;
+        if (target->inboxTail)
+        {
+            target->inboxTail->next = node;
+        }
+        else
+        {
+            target->inboxHead = node;
+        }
+        target->inboxTail = node;
+        target->inboxSize.fetch_add(1);
+    }
+
+    //pairs with the fence in RunWorker: either we see the sleeper, or the sleeper sees this task.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_sleepingWorkers.load() > 0)
+    {
+        WakeOneWorker();
+    }
+    return true;
+}
+
+void WorkStealingThreadExecutor::WakeOneWorker()
+{
+    std::lock_guard<std::mutex> locker(m_parkLock);
+    m_parkSignal.notify_one();
+}
+
+bool WorkStealingThreadExecutor::HasQueuedWork() const
+{
+    for (auto worker : m_workers)
+    {
+        if (!worker->deque.IsEmpty() || worker->inboxSize.load() > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+WorkStealingThreadExecutor::TaskNode* WorkStealingThreadExecutor::FindWork(Worker& worker)
+{
+    if (TaskNode* node = worker.deque.Pop())
+    {
+        return node;
+    }
+
+    if (worker.inboxSize.load() > 0)
+    {
+        std::lock_guard<std::mutex> locker(worker.inboxLock);
+        TaskNode* node = worker.inboxHead;
+        if (node)
+        {
+            //run the first, move the rest onto our deque where idle workers can steal them without this lock.
+            TaskNode* next = node->next;
+            size_t taken = 1;
+            while (next && worker.deque.Push(next))
+            {
+                next = next->next;
+                ++taken;
+            }
+            worker.inboxHead = next;
+            if (!next)
+            {
+                worker.inboxTail = nullptr;
+            }
+            worker.inboxSize.fetch_sub(taken);
+            return node;
+        }
+    }
+
+    const size_t workerCount = m_workers.size();
+    for (size_t offset = 1; offset < workerCount; ++offset)
+    {
+        Worker& victim = *m_workers[(worker.index + offset) % workerCount];
+        if (TaskNode* node = victim.deque.Steal())
+        {
+            return node;
+        }
+
+        if (victim.inboxSize.load() > 0)
+        {
+            std::unique_lock<std::mutex> locker(victim.inboxLock, std::try_to_lock);
+            if (locker.owns_lock() && victim.inboxHead)
+            {
+                TaskNode* node = victim.inboxHead;
+                victim.inboxHead = node->next;
+                if (!victim.inboxHead)
+                {
+                    victim.inboxTail = nullptr;
+                }
+                victim.inboxSize.fetch_sub(1);
+                return node;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+void WorkStealingThreadExecutor::RunWorker(Worker* worker, bool pinThreadToCore)
+{
+    CurrentWorker() = worker;
+    if (pinThreadToCore)
+    {
+        PinCurrentThreadToCore(worker->index);
+    }
+
+    int idleSpins = 0;
+    while (m_continue)
+    {
+        TaskNode* node = FindWork(*worker);
+        if (node)
+        {
+            idleSpins = 0;
+            node->invoke(&node->storage);
+            ReleaseTaskNode(node);
+            continue;
+        }
+
+        if (idleSpins++ < IDLE_SPINS)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        idleSpins = 0;
+        std::unique_lock<std::mutex> locker(m_parkLock);
+        m_sleepingWorkers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_continue && !HasQueuedWork())
+        {
+            m_parkSignal.wait(locker);
+        }
+        m_sleepingWorkers.fetch_sub(1);
+    }
+
+    CurrentWorker() = nullptr;
+}
@@ -0,0 +1,657 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <cstdlib>
+#include <cstring>
+
+using namespace Aws::Utils::Xml;
+
+static const char XML_READER_LOG_TAG[] = "XmlReader";
+//longer than any entity we decode, e.g. "#x10FFFF".
+static const size_t MAX_ENTITY_LENGTH = 10;
+//longest terminator passed to SkipPast.
+static const size_t MAX_TERMINATOR_LENGTH = 3;
+
+static inline bool IsWhitespace(int c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline bool IsNameEnd(int c)
+{
+    return IsWhitespace(c) || c == '/' || c == '>' || c == '=' || c == '<';
+}
+
+static void AppendUtf8(Aws::String& value, unsigned long codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        value.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        value.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        value.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        value.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        value.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+XmlReader::XmlReader(Aws::IStream& stream) :
+    m_stream(stream),
+    m_position(0),
+    m_end(0),
+    m_bufferOffset(0),
+    m_elementIsEmpty(false),
+    m_attributeCount(0)
+{
+}
+
+bool XmlReader::NextElement(Aws::String& name)
+{
+    if (!m_errorMessage.empty())
+    {
+        return false;
+    }
+
+    if (m_elementIsEmpty)
+    {
+        LeaveElement();
+        return false;
+    }
+
+    size_t depth = m_nameStarts.size();
+    switch (ReadToken(nullptr))
+    {
+        case Token::START_TAG:
+            name.assign(m_openElements, m_nameStarts.back(), Aws::String::npos);
+            return true;
+        case Token::END_TAG:
+            return false;
+        default:
+            if (depth > 0)
+            {
+                Fail("unexpected end of document");
+            }
+            return false;
+    }
+}
+
+Aws::String XmlReader::ReadText()
+{
+    Aws::String text;
+    if (!m_errorMessage.empty() || m_nameStarts.empty())
+    {
+        return text;
+    }
+
+    if (m_elementIsEmpty)
+    {
+        LeaveElement();
+        return text;
+    }
+
+    for (;;)
+    {
+        switch (ReadToken(&text))
+        {
+            case Token::START_TAG:
+                SkipElement();
+                if (!m_errorMessage.empty())
+                {
+                    return Aws::String();
+                }
+                break;
+            case Token::END_TAG:
+                return text;
+            default:
+                Fail("unexpected end of document");
+                return Aws::String();
+        }
+    }
+}
+
+void XmlReader::SkipElement()
+{
+    if (!m_errorMessage.empty() || m_nameStarts.empty())
+    {
+        return;
+    }
+
+    if (m_elementIsEmpty)
+    {
+        LeaveElement();
+        return;
+    }
+
+    size_t depth = m_nameStarts.size();
+    while (m_nameStarts.size() >= depth)
+    {
+        switch (ReadToken(nullptr))
+        {
+            case Token::START_TAG:
+                if (m_elementIsEmpty)
+                {
+                    LeaveElement();
+                }
+                break;
+            case Token::END_TAG:
+                break;
+            default:
+                Fail("unexpected end of document");
+                return;
+        }
+    }
+}
+
+Aws::String XmlReader::GetAttributeValue(const Aws::String& name) const
+{
+    for (size_t i = 0; i < m_attributeCount; ++i)
+    {
+        if (m_attributes[2 * i] == name)
+        {
+            return m_attributes[2 * i + 1];
+        }
+    }
+
+    return {};
+}
+
+XmlReader::Token XmlReader::ReadToken(Aws::String* text)
+{
+    for (;;)
+    {
+        if (!m_errorMessage.empty())
+        {
+            return Token::END_OF_DOCUMENT;
+        }
+
+        //copy or skip character data up to the next markup in one go.
+        size_t runStart = m_position;
+        while (m_position < m_end && m_buffer[m_position] != '<' && m_buffer[m_position] != '&' && m_buffer[m_position] != '\r')
+        {
+            ++m_position;
+        }
+        if (text)
+        {
+            text->append(m_buffer + runStart, m_position - runStart);
+        }
+
+        int c = NextRawChar();
+        if (c < 0)
+        {
+            return Token::END_OF_DOCUMENT;
+        }
+
+        if (c == '&')
+        {
+            if (text)
+            {
+                ReadEntity(*text);
+            }
+            continue;
+        }
+
+        if (c == '\r')
+        {
+            //line ends are normalized to \n, as XML requires.
+            if (text)
+            {
+                text->push_back('\n');
+            }
+            if (Peek() == '\n')
+            {
+                ++m_position;
+            }
+            continue;
+        }
+
+        if (c != '<')
+        {
+            if (text)
+            {
+                text->push_back(static_cast<char>(c));
+            }
+            continue;
+        }
+
+        c = Peek();
+        if (c == '/')
+        {
+            ++m_position;
+            return ReadEndTag() ? Token::END_TAG : Token::END_OF_DOCUMENT;
+        }
+
+        if (c == '?')
+        {
+            if (!SkipPast("?>", nullptr))
+            {
+                return Token::END_OF_DOCUMENT;
+            }
+            continue;
+        }
+
+        if (c == '!')
+        {
+            ++m_position;
+            c = Peek();
+            bool skipped = false;
+            if (c == '-')
+            {
+                skipped = NextRawChar() == '-' && NextRawChar() == '-' && SkipPast("-->", nullptr);
+            }
+            else if (c == '[')
+            {
+                skipped = true;
+                for (const char* expected = "[CDATA["; *expected && skipped; ++expected)
+                {
+                    skipped = NextRawChar() == static_cast<unsigned char>(*expected);
+                }
+                skipped = skipped && SkipPast("]]>", text);
+            }
+            else
+            {
+                skipped = SkipDeclaration();
+            }
+
+            if (!skipped)
+            {
+                Fail("invalid markup");
+                return Token::END_OF_DOCUMENT;
+            }
+            continue;
+        }
+
+        return ReadStartTag() ? Token::START_TAG : Token::END_OF_DOCUMENT;
+    }
+}
+
+bool XmlReader::ReadStartTag()
+{
+    m_attributeCount = 0;
+    m_nameStarts.push_back(m_openElements.size());
+    if (!ReadName(m_openElements))
+    {
+        Fail("expected an element name");
+        return false;
+    }
+
+    for (;;)
+    {
+        SkipWhitespace();
+        int c = NextRawChar();
+        if (c == '>')
+        {
+            return true;
+        }
+
+        if (c == '/')
+        {
+            if (NextRawChar() != '>')
+            {
+                Fail("expected '>' after '/'");
+                return false;
+            }
+            m_elementIsEmpty = true;
+            return true;
+        }
+
+        if (c < 0)
+        {
+            Fail("unterminated start tag");
+            return false;
+        }
+
+        //an attribute; reuse the strings left from earlier elements.
+        --m_position;
+        if (m_attributes.size() < 2 * (m_attributeCount + 1))
+        {
+            m_attributes.resize(2 * (m_attributeCount + 1));
+        }
+        Aws::String& attributeName = m_attributes[2 * m_attributeCount];
+        Aws::String& attributeValue = m_attributes[2 * m_attributeCount + 1];
+        attributeName.clear();
+        attributeValue.clear();
+        if (!ReadName(attributeName))
+        {
+            Fail("expected an attribute name");
+            return false;
+        }
+
+        SkipWhitespace();
+        if (NextRawChar() != '=')
+        {
+            Fail("expected '=' after attribute name");
+            return false;
+        }
+
+        SkipWhitespace();
+        if (!ReadAttributeValue(attributeValue))
+        {
+            return false;
+        }
+        ++m_attributeCount;
+    }
+}
+
+bool XmlReader::ReadEndTag()
+{
+    if (m_nameStarts.empty())
+    {
+        Fail("end tag without a start tag");
+        return false;
+    }
+
+    //compare against the open element's name as it is read, so nothing is copied.
+    size_t expected = m_nameStarts.back();
+    bool matches = true;
+    for (;;)
+    {
+        int c = Peek();
+        if (c < 0 || IsNameEnd(c))
+        {
+            break;
+        }
+
+        ++m_position;
+        if (matches && expected < m_openElements.size() && m_openElements[expected] == static_cast<char>(c))
+        {
+            ++expected;
+        }
+        else
+        {
+            matches = false;
+        }
+    }
+
+    if (!matches || expected != m_openElements.size())
+    {
+        Fail("end tag does not match start tag");
+        return false;
+    }
+
+    SkipWhitespace();
+    if (NextRawChar() != '>')
+    {
+        Fail("unterminated end tag");
+        return false;
+    }
+
+    LeaveElement();
+    return true;
+}
+
+bool XmlReader::ReadName(Aws::String& name)
+{
+    size_t length = name.size();
+    for (;;)
+    {
+        size_t runStart = m_position;
+        while (m_position < m_end && !IsNameEnd(m_buffer[m_position]))
+        {
+            ++m_position;
+        }
+        name.append(m_buffer + runStart, m_position - runStart);
+
+        if (m_position < m_end || !Refill())
+        {
+            return name.size() > length;
+        }
+    }
+}
+
+bool XmlReader::ReadAttributeValue(Aws::String& value)
+{
+    int quote = NextRawChar();
+    if (quote != '"' && quote != '\'')
+    {
+        Fail("expected a quoted attribute value");
+        return false;
+    }
+
+    for (;;)
+    {
+        int c = NextRawChar();
+        if (c == quote)
+        {
+            return true;
+        }
+
+        if (c < 0 || c == '<')
+        {
+            Fail("unterminated attribute value");
+            return false;
+        }
+
+        if (c == '&')
+        {
+            ReadEntity(value);
+        }
+        else
+        {
+            value.push_back(static_cast<char>(c));
+        }
+    }
+}
+
+void XmlReader::ReadEntity(Aws::String& value)
+{
+    char entity[MAX_ENTITY_LENGTH + 1];
+    size_t length = 0;
+    bool terminated = false;
+    while (length < MAX_ENTITY_LENGTH)
+    {
+        int c = Peek();
+        if (c < 0 || c == '<' || c == '&')
+        {
+            break;
+        }
+
+        ++m_position;
+        if (c == ';')
+        {
+            terminated = true;
+            break;
+        }
+        entity[length++] = static_cast<char>(c);
+    }
+    entity[length] = '\0';
+
+    if (terminated)
+    {
+        if (strcmp(entity, "lt") == 0)
+        {
+            value.push_back('<');
+            return;
+        }
+        if (strcmp(entity, "gt") == 0)
+        {
+            value.push_back('>');
+            return;
+        }
+        if (strcmp(entity, "amp") == 0)
+        {
+            value.push_back('&');
+            return;
+        }
+        if (strcmp(entity, "quot") == 0)
+        {
+            value.push_back('"');
+            return;
+        }
+        if (strcmp(entity, "apos") == 0)
+        {
+            value.push_back('\'');
+            return;
+        }
+        if (entity[0] == '#' && length > 1)
+        {
+            bool hex = entity[1] == 'x' || entity[1] == 'X';
+            const char* digits = entity + (hex ? 2 : 1);
+            char* digitsEnd = nullptr;
+            unsigned long codePoint = strtoul(digits, &digitsEnd, hex ? 16 : 10);
+            if (*digits && *digitsEnd == '\0' && codePoint > 0 && codePoint <= 0x10FFFF)
+            {
+                AppendUtf8(value, codePoint);
+                return;
+            }
+        }
+    }
+
+    //not an entity we know; keep it as written, the same as tinyxml2 does.
+    value.push_back('&');
+    value.append(entity, length);
+    if (terminated)
+    {
+        value.push_back(';');
+    }
+}
+
+void XmlReader::SkipWhitespace()
+{
+    while (IsWhitespace(Peek()))
+    {
+        ++m_position;
+    }
+}
+
+bool XmlReader::SkipPast(const char* terminator, Aws::String* text)
+{
+    size_t length = strlen(terminator);
+    char window[MAX_TERMINATOR_LENGTH] = {};
+    size_t seen = 0;
+    for (;;)
+    {
+        int c = NextRawChar();
+        if (c < 0)
+        {
+            Fail("unterminated markup");
+            return false;
+        }
+
+        if (text)
+        {
+            text->push_back(static_cast<char>(c));
+        }
+
+        memmove(window, window + 1, length - 1);
+        window[length - 1] = static_cast<char>(c);
+        if (++seen >= length && memcmp(window, terminator, length) == 0)
+        {
+            if (text)
+            {
+                text->resize(text->size() - length);
+            }
+            return true;
+        }
+    }
+}
+
+bool XmlReader::SkipDeclaration()
+{
+    //<!DOCTYPE ...> and the like; an internal subset in [] may contain '>'.
+    int bracketDepth = 0;
+    for (;;)
+    {
+        int c = NextRawChar();
+        if (c < 0)
+        {
+            return false;
+        }
+
+        if (c == '[')
+        {
+            ++bracketDepth;
+        }
+        else if (c == ']' && bracketDepth > 0)
+        {
+            --bracketDepth;
+        }
+        else if (c == '>' && bracketDepth == 0)
+        {
+            return true;
+        }
+    }
+}
+
+void XmlReader::LeaveElement()
+{
+    m_openElements.resize(m_nameStarts.back());
+    m_nameStarts.pop_back();
+    m_elementIsEmpty = false;
+    m_attributeCount = 0;
+}
+
+int XmlReader::Peek()
+{
+    if (m_position == m_end && !Refill())
+    {
+        return -1;
+    }
+
+    return static_cast<unsigned char>(m_buffer[m_position]);
+}
+
+int XmlReader::NextRawChar()
+{
+    if (m_position == m_end && !Refill())
+    {
+        return -1;
+    }
+
+    return static_cast<unsigned char>(m_buffer[m_position++]);
+}
+
+bool XmlReader::Refill()
+{
+    if (!m_errorMessage.empty() || !m_stream)
+    {
+        return false;
+    }
+
+    m_bufferOffset += m_end;
+    m_stream.read(m_buffer, BUFFER_SIZE);
+    m_end = static_cast<size_t>(m_stream.gcount());
+    m_position = 0;
+    return m_end > 0;
+}
+
+void XmlReader::Fail(const char* reason)
+{
+    if (!m_errorMessage.empty())
+    {
+        return;
+    }
+
+    Aws::StringStream ss;
+    ss << "Failed to parse XML at offset " << m_bufferOffset + m_position << ": " << reason;
+    m_errorMessage = ss.str();
+    AWS_LOGSTREAM_ERROR(XML_READER_LOG_TAG, m_errorMessage);
+}
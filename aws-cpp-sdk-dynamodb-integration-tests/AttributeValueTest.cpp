@@ -0,0 +1,285 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/AmazonWebServiceResult.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonWriter.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/dynamodb/DynamoDBErrors.h>
+#include <aws/dynamodb/model/AttributeValue.h>
+#include <aws/dynamodb/model/QueryRequest.h>
+#include <aws/dynamodb/model/QueryResult.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+
+using namespace Aws::DynamoDB::Model;
+using namespace Aws::Utils::Json;
+
+static const char ALLOCATION_TAG[] = "AttributeValueTest";
+
+namespace
+{
+    AttributeValue ReadAttributeValue(const Aws::String& json)
+    {
+        Aws::StringStream stream(json);
+        JsonReader reader(stream);
+        return AttributeValue(reader);
+    }
+
+    Aws::String WriteAttributeValue(const AttributeValue& value)
+    {
+        Aws::String json;
+        JsonWriter writer(json);
+        value.Jsonize(writer);
+        return json;
+    }
+}
+
+TEST(AttributeValueTest, GettersReturnTheStoredValueOrAnEmptyOne)
+{
+    AttributeValue s("a string that is too long for the small string buffer");
+    ASSERT_EQ(ValueType::STRING, s.GetType());
+    ASSERT_EQ("a string that is too long for the small string buffer", s.GetS());
+    ASSERT_EQ(&s.GetS(), &s.GetS());
+    ASSERT_TRUE(s.GetN().empty());
+    ASSERT_TRUE(s.GetSS().empty());
+    ASSERT_TRUE(s.GetM().empty());
+    ASSERT_FALSE(s.GetBool());
+
+    AttributeValue n;
+    n.SetN("42");
+    ASSERT_EQ(ValueType::NUMBER, n.GetType());
+    ASSERT_EQ("42", n.GetN());
+    ASSERT_TRUE(n.GetS().empty());
+
+    AttributeValue ns;
+    ns.AddNItem("1").AddNItem("2");
+    ASSERT_EQ(ValueType::NUMBER_SET, ns.GetType());
+    ASSERT_EQ(2u, ns.GetNS().size());
+    ASSERT_TRUE(ns.GetSS().empty());
+
+    AttributeValue b;
+    b.SetBool(true);
+    ASSERT_TRUE(b.GetBool());
+    ASSERT_FALSE(b.GetNull());
+
+    //setting a value of another type replaces the old one.
+    b.SetS("now a string");
+    ASSERT_EQ(ValueType::STRING, b.GetType());
+    ASSERT_FALSE(b.GetBool());
+    ASSERT_EQ("now a string", b.GetS());
+}
+
+TEST(AttributeValueTest, CopiesAndMovesAreIndependentValues)
+{
+    AttributeValue original;
+    original.AddSItem("one");
+    AttributeValue copy(original);
+    copy.AddSItem("two");
+    ASSERT_EQ(1u, original.GetSS().size());
+    ASSERT_EQ(2u, copy.GetSS().size());
+    ASSERT_NE(original, copy);
+
+    AttributeValue assigned;
+    assigned.SetN("7");
+    assigned = original;
+    ASSERT_EQ(ValueType::STRING_SET, assigned.GetType());
+    ASSERT_EQ(original, assigned);
+
+    AttributeValue moved(std::move(copy));
+    ASSERT_EQ(2u, moved.GetSS().size());
+
+    AttributeValue map;
+    map.AddMEntry("key", Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "value"));
+    assigned = std::move(map);
+    ASSERT_EQ(ValueType::ATTRIBUTE_MAP, assigned.GetType());
+    ASSERT_EQ("value", assigned.GetM().at("key")->GetS());
+}
+
+TEST(AttributeValueTest, AssigningANestedElementToItsParent)
+{
+    //the list and map own the only reference to the element being assigned from.
+    AttributeValue list;
+    list.AddLItem(Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "first"));
+    list.AddLItem(Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "second"));
+    list = *list.GetL()[1];
+    ASSERT_EQ(ValueType::STRING, list.GetType());
+    ASSERT_EQ("second", list.GetS());
+
+    AttributeValue map;
+    auto nested = Aws::MakeShared<AttributeValue>(ALLOCATION_TAG);
+    nested->AddSItem("one").AddSItem("two");
+    map.AddMEntry("k", nested);
+    nested = nullptr;
+    map = *map.GetM().at("k");
+    ASSERT_EQ(ValueType::STRING_SET, map.GetType());
+    ASSERT_EQ(2u, map.GetSS().size());
+
+    AttributeValue outer;
+    auto inner = Aws::MakeShared<AttributeValue>(ALLOCATION_TAG);
+    inner->AddMEntry("leaf", Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "value"));
+    outer.AddLItem(inner);
+    inner = nullptr;
+    outer = std::move(const_cast<AttributeValue&>(*outer.GetL()[0]));
+    ASSERT_EQ(ValueType::ATTRIBUTE_MAP, outer.GetType());
+    ASSERT_EQ("value", outer.GetM().at("leaf")->GetS());
+}
+
+TEST(AttributeValueTest, UnsetValuesEqualDefaultValues)
+{
+    AttributeValue unset;
+    AttributeValue emptyString("");
+    AttributeValue falseBool;
+    falseBool.SetBool(false);
+
+    ASSERT_EQ(unset, emptyString);
+    ASSERT_EQ(unset, falseBool);
+    ASSERT_NE(unset, AttributeValue("x"));
+    ASSERT_EQ("{}", WriteAttributeValue(unset));
+    ASSERT_EQ("{\"BOOL\":false}", WriteAttributeValue(falseBool));
+}
+
+TEST(AttributeValueTest, RoundTripsEveryType)
+{
+    Aws::String json = "{\"M\":{"
+        "\"b\":{\"B\":\"aGk=\"},"
+        "\"bool\":{\"BOOL\":true},"
+        "\"bs\":{\"BS\":[\"aGk=\",\"aGV5\"]},"
+        "\"l\":{\"L\":[{\"N\":\"1\"},{\"NULL\":true},{\"S\":\"x\"}]},"
+        "\"n\":{\"N\":\"-1.5e3\"},"
+        "\"ns\":{\"NS\":[\"1\",\"2\"]},"
+        "\"s\":{\"S\":\"x \\\"quoted\\\"\"},"
+        "\"ss\":{\"SS\":[\"p\",\"q\"]}"
+        "}}";
+
+    AttributeValue fromReader = ReadAttributeValue(json);
+    AttributeValue fromDom(JsonValue(json).View());
+    ASSERT_EQ(fromDom, fromReader);
+    ASSERT_EQ(8u, fromReader.GetM().size());
+    ASSERT_EQ(3u, fromReader.GetM().at("l")->GetL().size());
+    ASSERT_EQ(2u, fromReader.GetM().at("b")->GetB().GetLength());
+    ASSERT_EQ(json, WriteAttributeValue(fromReader));
+    ASSERT_EQ(JsonValue(json).View().WriteCompact(), fromReader.Jsonize().View().WriteCompact());
+}
+
+TEST(AttributeValueTest, DecodesQueryPageFromStream)
+{
+    const size_t ITEM_COUNT = 1000;
+    const size_t ATTRIBUTE_COUNT = 12;
+
+    Aws::String page = "{\"Count\":1000,\"ScannedCount\":1000,\"Items\":[";
+    for (size_t item = 0; item < ITEM_COUNT; ++item)
+    {
+        page += item == 0 ? "{" : ",{";
+        page += "\"pk\":{\"S\":\"customer#" + Aws::Utils::StringUtils::to_string(item) + "\"}";
+        for (size_t attribute = 0; attribute < ATTRIBUTE_COUNT; ++attribute)
+        {
+            Aws::String name = "attribute" + Aws::Utils::StringUtils::to_string(attribute);
+            if (attribute % 3 == 0)
+            {
+                page += ",\"" + name + "\":{\"N\":\"" + Aws::Utils::StringUtils::to_string(item * attribute) + "\"}";
+            }
+            else
+            {
+                page += ",\"" + name + "\":{\"S\":\"value " + Aws::Utils::StringUtils::to_string(attribute) + "\"}";
+            }
+        }
+        page += "}";
+    }
+    page += "]}";
+
+    Aws::Utils::Stream::ResponseStream responseStream(Aws::New<Aws::StringStream>(ALLOCATION_TAG, page));
+    QueryResult result(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>(std::move(responseStream),
+        Aws::Http::HeaderValueCollection()));
+
+    ASSERT_EQ(ITEM_COUNT, result.GetItems().size());
+    for (size_t item = 0; item < ITEM_COUNT; ++item)
+    {
+        const auto& attributes = result.GetItems()[item];
+        ASSERT_EQ(ATTRIBUTE_COUNT + 1, attributes.size());
+        ASSERT_EQ("customer#" + Aws::Utils::StringUtils::to_string(item), attributes.at("pk").GetS());
+        ASSERT_EQ(ValueType::NUMBER, attributes.at("attribute3").GetType());
+        ASSERT_EQ(Aws::Utils::StringUtils::to_string(item * 3), attributes.at("attribute3").GetN());
+        ASSERT_EQ("value 4", attributes.at("attribute4").GetS());
+    }
+}
+
+TEST(AttributeValueTest, TruncatedQueryPageFailsToDecode)
+{
+    const Aws::String page = "{\"Count\":2,\"ScannedCount\":2,\"Items\":[{\"pk\":{\"S\":\"customer#0\"}},"
+        "{\"pk\":{\"S\":\"customer#1\"},\"tags\":{\"L\":[{\"S\":\"a\"},{\"N\":\"1\"}]}}],"
+        "\"LastEvaluatedKey\":{\"pk\":{\"S\":\"customer#1\"}}}";
+
+    for (size_t length = 1; length <= page.size(); ++length)
+    {
+        Aws::Utils::Stream::ResponseStream responseStream(Aws::New<Aws::StringStream>(ALLOCATION_TAG, page.substr(0, length)));
+        Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream> streamResult(std::move(responseStream),
+            Aws::Http::HeaderValueCollection());
+        JsonReader jsonReader(streamResult.GetPayload().GetUnderlyingStream());
+        QueryResult result(streamResult, jsonReader);
+
+        if (length < page.size())
+        {
+            ASSERT_FALSE(jsonReader.WasParseSuccessful()) << "decoded a page cut at " << length << " bytes";
+        }
+        else
+        {
+            ASSERT_TRUE(jsonReader.WasParseSuccessful()) << jsonReader.GetErrorMessage();
+            ASSERT_EQ(2u, result.GetItems().size());
+            ASSERT_EQ("customer#1", result.GetLastEvaluatedKey().at("pk").GetS());
+        }
+    }
+}
+
+TEST(AttributeValueTest, TruncatedQueryResponseFailsTheCall)
+{
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(ALLOCATION_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+    Aws::Http::SetHttpClientFactory(mockHttpClientFactory);
+
+    {
+        Aws::Client::ClientConfiguration config;
+        config.scheme = Aws::Http::Scheme::HTTP;
+        Aws::DynamoDB::DynamoDBClient client(Aws::Auth::AWSCredentials("akid", "secret"), config);
+
+        auto httpRequest = Aws::Http::CreateHttpRequest(Aws::Http::URI("http://dynamodb.us-east-1.amazonaws.com"),
+            Aws::Http::HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto httpResponse = Aws::MakeShared<Aws::Http::Standard::StandardHttpResponse>(ALLOCATION_TAG, httpRequest);
+        httpResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+        httpResponse->GetResponseBody() << "{\"Count\":1,\"ScannedCount\":1,\"Items\":[{\"pk\":{\"S\":\"custo";
+        mockHttpClient->AddResponseToReturn(httpResponse);
+
+        QueryRequest request;
+        request.SetTableName("customers");
+        auto outcome = client.Query(request);
+
+        ASSERT_FALSE(outcome.IsSuccess());
+        ASSERT_EQ(Aws::DynamoDB::DynamoDBErrors::UNKNOWN, outcome.GetError().GetErrorType());
+        ASSERT_EQ("Json Parser Error", outcome.GetError().GetExceptionName());
+        ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+    }
+
+    Aws::Http::CleanupHttp();
+    Aws::Http::InitHttp();
+}
@@ -0,0 +1,422 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/dynamodb/DynamoDBBatcher.h>
+#include <aws/dynamodb/model/KeysAndAttributes.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::DynamoDB;
+using namespace Aws::DynamoDB::Model;
+
+static const char TABLE_NAME[] = "Table";
+
+namespace
+{
+    Aws::Map<Aws::String, AttributeValue> Key(size_t id)
+    {
+        Aws::Map<Aws::String, AttributeValue> key;
+        key["id"] = AttributeValue("item#" + Aws::Utils::StringUtils::to_string(id));
+        return key;
+    }
+
+    Aws::String Id(const WriteRequest& request)
+    {
+        return request.PutRequestHasBeenSet() ? request.GetPutRequest().GetItem().at("id").GetS() : request.GetDeleteRequest().GetKey().at("id").GetS();
+    }
+
+    BatchConfiguration Configuration(Aws::Utils::Threading::Executor* executor)
+    {
+        BatchConfiguration config(nullptr, executor);
+        config.linger = std::chrono::milliseconds(1000);
+        config.retryBackoff = std::chrono::milliseconds(1);
+        config.maxRetryBackoff = std::chrono::milliseconds(4);
+        return config;
+    }
+
+    //records every write it is sent; the first time it sees an item it leaves every other one unprocessed.
+    class FakeBatchWrite
+    {
+    public:
+        BatchWriteItemOutcome operator()(const BatchWriteItemRequest& request)
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            BatchWriteItemResult result;
+            Aws::Map<Aws::String, Aws::Vector<WriteRequest>> unprocessed;
+            size_t count = 0;
+            for (const auto& table : request.GetRequestItems())
+            {
+                for (const auto& write : table.second)
+                {
+                    ++count;
+                    Aws::String id = Id(write);
+                    if (m_leaveUnprocessed && m_seen.insert(id).second && m_seen.size() % 2 == 0)
+                    {
+                        unprocessed[table.first].push_back(write);
+                        continue;
+                    }
+                    ++m_written[id];
+                }
+            }
+            m_batchSizes.push_back(count);
+            result.SetUnprocessedItems(std::move(unprocessed));
+            return BatchWriteItemOutcome(std::move(result));
+        }
+
+        std::mutex m_mutex;
+        bool m_leaveUnprocessed = false;
+        Aws::Set<Aws::String> m_seen;
+        Aws::Map<Aws::String, size_t> m_written;
+        Aws::Vector<size_t> m_batchSizes;
+    };
+
+    //runs tasks on its pool but rejects every delayed one.
+    class NoTimerExecutor : public Aws::Utils::Threading::PooledThreadExecutor
+    {
+    public:
+        NoTimerExecutor() : PooledThreadExecutor(4) {}
+
+    protected:
+        bool SubmitToThreadAfter(std::chrono::milliseconds, std::function<void()>&&) override
+        {
+            return false;
+        }
+    };
+
+    //runs every task, delayed or not, on the thread that submits it.
+    class InlineExecutor : public Aws::Utils::Threading::Executor
+    {
+    protected:
+        bool SubmitToThread(std::function<void()>&& task) override
+        {
+            task();
+            return true;
+        }
+
+        bool SubmitToThreadAfter(std::chrono::milliseconds, std::function<void()>&& task) override
+        {
+            task();
+            return true;
+        }
+    };
+}
+
+TEST(BatchTest, WritesAreSentInBatchesOfAtMost25)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    FakeBatchWrite fake;
+    {
+        DynamoDBBatchWriter writer(Configuration(&executor), std::ref(fake));
+        std::thread other([&writer]()
+        {
+            for (size_t i = 30; i < 60; ++i)
+            {
+                writer.Delete(TABLE_NAME, Key(i));
+            }
+        });
+        for (size_t i = 0; i < 30; ++i)
+        {
+            writer.Put(TABLE_NAME, Key(i));
+        }
+        other.join();
+
+        //two full batches went right away; the rest waits for the linger or the flush.
+        ASSERT_TRUE(writer.Flush().IsSuccess());
+        ASSERT_EQ(3u, writer.GetBatchCount());
+    }
+
+    ASSERT_EQ(60u, fake.m_written.size());
+    size_t total = 0;
+    for (auto size : fake.m_batchSizes)
+    {
+        ASSERT_GE(25u, size);
+        total += size;
+    }
+    ASSERT_EQ(60u, total);
+}
+
+TEST(BatchTest, PartialBatchIsSentAfterLinger)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    FakeBatchWrite fake;
+    BatchConfiguration config = Configuration(&executor);
+    config.linger = std::chrono::milliseconds(5);
+    DynamoDBBatchWriter writer(config, std::ref(fake));
+
+    writer.Put(TABLE_NAME, Key(1));
+    writer.Put(TABLE_NAME, Key(2));
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (writer.GetBatchCount() == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(1u, writer.GetBatchCount());
+    ASSERT_TRUE(writer.Flush().IsSuccess());
+    ASSERT_EQ(1u, writer.GetBatchCount());
+}
+
+TEST(BatchTest, UnprocessedAndThrottledWritesAreSentAgain)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    FakeBatchWrite fake;
+    fake.m_leaveUnprocessed = true;
+    std::atomic<int> throttlesLeft(2);
+    auto batchWrite = [&fake, &throttlesLeft](const BatchWriteItemRequest& request)
+    {
+        if (throttlesLeft.fetch_sub(1) > 0)
+        {
+            return BatchWriteItemOutcome(Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::PROVISIONED_THROUGHPUT_EXCEEDED,
+                "ProvisionedThroughputExceededException", "Rate exceeded", true));
+        }
+        return fake(request);
+    };
+
+    DynamoDBBatchWriter writer(Configuration(&executor), batchWrite);
+    for (size_t i = 0; i < 100; ++i)
+    {
+        writer.Put(TABLE_NAME, Key(i));
+    }
+    ASSERT_TRUE(writer.Flush().IsSuccess());
+
+    ASSERT_EQ(100u, fake.m_written.size());
+    for (const auto& written : fake.m_written)
+    {
+        ASSERT_EQ(1u, written.second);
+    }
+    ASSERT_LT(4u + 2u, writer.GetBatchCount());
+}
+
+TEST(BatchTest, FailedWritesAreReported)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    BatchConfiguration config = Configuration(&executor);
+    config.maxRetries = 3;
+
+    std::atomic<size_t> calls(0);
+    auto neverProcessed = [&calls](const BatchWriteItemRequest& request)
+    {
+        ++calls;
+        BatchWriteItemResult result;
+        result.SetUnprocessedItems(request.GetRequestItems());
+        return BatchWriteItemOutcome(std::move(result));
+    };
+    DynamoDBBatchWriter giveUp(config, neverProcessed);
+    std::atomic<size_t> failed(0);
+    giveUp.SetWriteFailedHandler([&failed](const Aws::String& tableName, const WriteRequest&, const Aws::Client::AWSError<DynamoDBErrors>& error)
+    {
+        ASSERT_EQ(TABLE_NAME, tableName);
+        ASSERT_EQ("UnprocessedItems", error.GetExceptionName());
+        ++failed;
+    });
+    giveUp.Put(TABLE_NAME, Key(1));
+    giveUp.Put(TABLE_NAME, Key(2));
+    auto outcome = giveUp.Flush();
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(2u, failed.load());
+    ASSERT_EQ(3u, calls.load());
+
+    //the error is reported once; the next flush starts clean.
+    ASSERT_TRUE(giveUp.Flush().IsSuccess());
+
+    auto invalid = [](const BatchWriteItemRequest&)
+    {
+        return BatchWriteItemOutcome(Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::VALIDATION, "ValidationException", "Bad item", false));
+    };
+    DynamoDBBatchWriter rejected(config, invalid);
+    rejected.Delete(TABLE_NAME, Key(1));
+    outcome = rejected.Flush();
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(DynamoDBErrors::VALIDATION, outcome.GetError().GetErrorType());
+    ASSERT_EQ(1u, rejected.GetBatchCount());
+}
+
+TEST(BatchTest, RejectedTimersNeitherStrandNorLoseWrites)
+{
+    NoTimerExecutor executor;
+    FakeBatchWrite fake;
+    fake.m_leaveUnprocessed = true;
+    DynamoDBBatchWriter writer(Configuration(&executor), std::ref(fake));
+    std::atomic<size_t> failed(0);
+    writer.SetWriteFailedHandler([&failed](const Aws::String&, const WriteRequest&, const Aws::Client::AWSError<DynamoDBErrors>& error)
+    {
+        ASSERT_EQ("UnprocessedItems", error.GetExceptionName());
+        ++failed;
+    });
+
+    //without a linger timer the writes go out right away instead of waiting for the flush.
+    writer.Put(TABLE_NAME, Key(1));
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (writer.GetBatchCount() == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(1u, writer.GetBatchCount());
+
+    //every second item comes back unprocessed; with no retry timer those fail instead of hanging the flush.
+    for (size_t i = 2; i <= 10; ++i)
+    {
+        writer.Put(TABLE_NAME, Key(i));
+    }
+    ASSERT_FALSE(writer.Flush().IsSuccess());
+    ASSERT_EQ(5u, failed.load());
+    ASSERT_EQ(5u, fake.m_written.size());
+}
+
+TEST(BatchTest, GetsAreBatchedDedupedAndMatchedToTheirKeys)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    std::mutex mutex;
+    Aws::Vector<size_t> batchSizes;
+    Aws::Set<Aws::String> seen;
+    auto batchGet = [&mutex, &batchSizes, &seen](const BatchGetItemRequest& request)
+    {
+        std::lock_guard<std::mutex> locker(mutex);
+        BatchGetItemResult result;
+        const auto& keys = request.GetRequestItems().at(TABLE_NAME).GetKeys();
+        batchSizes.push_back(keys.size());
+
+        Aws::Set<Aws::String> inRequest;
+        Aws::Vector<Aws::Map<Aws::String, AttributeValue>> items;
+        KeysAndAttributes unprocessed;
+        for (const auto& key : keys)
+        {
+            const Aws::String& id = key.at("id").GetS();
+            EXPECT_TRUE(inRequest.insert(id).second);
+            //every third key is unprocessed the first time, and odd ids do not exist.
+            if (seen.insert(id).second && seen.size() % 3 == 0)
+            {
+                unprocessed.AddKeys(key);
+            }
+            else if (Aws::Utils::StringUtils::ConvertToInt32(id.substr(5).c_str()) % 2 == 0)
+            {
+                auto item = key;
+                item["value"] = AttributeValue(id + " value");
+                items.push_back(std::move(item));
+            }
+        }
+        //the service returns items in no particular order.
+        std::reverse(items.begin(), items.end());
+        result.AddResponses(TABLE_NAME, std::move(items));
+        if (!unprocessed.GetKeys().empty())
+        {
+            result.AddUnprocessedKeys(TABLE_NAME, std::move(unprocessed));
+        }
+        return BatchGetItemOutcome(std::move(result));
+    };
+
+    const size_t KEY_COUNT = 200;
+    std::atomic<size_t> found(0);
+    std::atomic<size_t> missing(0);
+    {
+        DynamoDBBatchGetter getter(Configuration(&executor), batchGet);
+        for (size_t i = 0; i < KEY_COUNT + 50; ++i)
+        {
+            //every fourth key is looked up a second time while the first lookup is still pending.
+            size_t id = (i / 5) * 4 + (i % 5 == 4 ? 0 : i % 5);
+            getter.Get(TABLE_NAME, Key(id), [id, &found, &missing](const DynamoDBBatchGetter::ItemOutcome& outcome)
+            {
+                ASSERT_TRUE(outcome.IsSuccess());
+                if (id % 2 == 0)
+                {
+                    ASSERT_EQ("item#" + Aws::Utils::StringUtils::to_string(id) + " value", outcome.GetResult().at("value").GetS());
+                    ++found;
+                }
+                else
+                {
+                    ASSERT_TRUE(outcome.GetResult().empty());
+                    ++missing;
+                }
+            });
+        }
+        ASSERT_TRUE(getter.Flush().IsSuccess());
+        ASSERT_LT(3u, getter.GetBatchCount());
+    }
+
+    ASSERT_EQ(KEY_COUNT / 2 + 50, found.load());
+    ASSERT_EQ(KEY_COUNT / 2, missing.load());
+    for (auto size : batchSizes)
+    {
+        ASSERT_GE(100u, size);
+    }
+}
+
+TEST(BatchTest, InlineExecutorSendsWithoutDeadlocking)
+{
+    InlineExecutor executor;
+    FakeBatchWrite fake;
+    {
+        DynamoDBBatchWriter writer(Configuration(&executor), std::ref(fake));
+        //the linger timer runs inside Put, so each write goes out on its own.
+        for (size_t i = 0; i < 3; ++i)
+        {
+            writer.Put(TABLE_NAME, Key(i));
+        }
+        ASSERT_EQ(3u, writer.GetBatchCount());
+        ASSERT_TRUE(writer.Flush().IsSuccess());
+    }
+    ASSERT_EQ(3u, fake.m_written.size());
+}
+
+TEST(BatchTest, GetsWithoutASignatureAreSentAlone)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    std::mutex mutex;
+    Aws::Vector<Aws::Vector<Aws::Map<Aws::String, AttributeValue>>> requests;
+    auto batchGet = [&mutex, &requests](const BatchGetItemRequest& request)
+    {
+        std::lock_guard<std::mutex> locker(mutex);
+        requests.push_back(request.GetRequestItems().at(TABLE_NAME).GetKeys());
+        return BatchGetItemOutcome(BatchGetItemResult());
+    };
+
+    Aws::Map<Aws::String, AttributeValue> unsignedKey;
+    unsignedKey["id"] = AttributeValue().SetBool(true);
+    std::atomic<size_t> received(0);
+    auto handler = [&received](const DynamoDBBatchGetter::ItemOutcome& outcome)
+    {
+        ASSERT_TRUE(outcome.IsSuccess());
+        ++received;
+    };
+    {
+        DynamoDBBatchGetter getter(Configuration(&executor), batchGet);
+        getter.Get(TABLE_NAME, unsignedKey, handler);
+        getter.Get(TABLE_NAME, Key(1), handler);
+        getter.Get(TABLE_NAME, unsignedKey, handler);
+        getter.Get(TABLE_NAME, Key(2), handler);
+        ASSERT_TRUE(getter.Flush().IsSuccess());
+    }
+
+    ASSERT_EQ(4u, received.load());
+    ASSERT_EQ(3u, requests.size());
+    for (const auto& keys : requests)
+    {
+        if (keys.front().at("id").GetType() == ValueType::BOOL)
+        {
+            ASSERT_EQ(1u, keys.size());
+        }
+        else
+        {
+            ASSERT_EQ(2u, keys.size());
+        }
+    }
+}
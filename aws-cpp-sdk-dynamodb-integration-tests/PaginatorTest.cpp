@@ -0,0 +1,173 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/dynamodb/DynamoDBPaginator.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Aws::DynamoDB;
+using namespace Aws::DynamoDB::Model;
+
+static const char ALLOCATION_TAG[] = "PaginatorTest";
+static const int PAGES_PER_SEGMENT = 5;
+
+namespace
+{
+    Aws::Vector<ScanRequest> SegmentRequests(int totalSegments)
+    {
+        Aws::Vector<ScanRequest> requests;
+        for (int segment = 0; segment < totalSegments; ++segment)
+        {
+            requests.push_back(ScanRequest().WithTableName("Table").WithSegment(segment).WithTotalSegments(totalSegments));
+        }
+        return requests;
+    }
+
+    //one item per page naming its segment and page; every segment has PAGES_PER_SEGMENT pages.
+    ScanOutcome ScanPage(const ScanRequest& request)
+    {
+        int page = 0;
+        auto startKey = request.GetExclusiveStartKey().find("page");
+        if (startKey != request.GetExclusiveStartKey().end())
+        {
+            page = Aws::Utils::StringUtils::ConvertToInt32(startKey->second.GetN().c_str());
+        }
+
+        ScanResult result;
+        Aws::Map<Aws::String, AttributeValue> item;
+        item["id"] = AttributeValue(Aws::Utils::StringUtils::to_string(request.GetSegment()) + "/" + Aws::Utils::StringUtils::to_string(page));
+        result.AddItems(std::move(item));
+        if (page + 1 < PAGES_PER_SEGMENT)
+        {
+            AttributeValue nextPage;
+            nextPage.SetN(Aws::Utils::StringUtils::to_string(page + 1));
+            result.AddLastEvaluatedKey("page", nextPage);
+        }
+        return ScanOutcome(std::move(result));
+    }
+
+    PaginatorConfiguration Configuration(Aws::Utils::Threading::Executor* executor)
+    {
+        PaginatorConfiguration config(nullptr, executor);
+        config.throttleBackoff = std::chrono::milliseconds(1);
+        config.maxThrottleBackoff = std::chrono::milliseconds(8);
+        return config;
+    }
+}
+
+TEST(PaginatorTest, FollowsLastEvaluatedKeyInEverySegment)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    auto paginator = Aws::MakeShared<ScanPaginator>(ALLOCATION_TAG, Configuration(&executor), SegmentRequests(4), ScanPage);
+
+    Aws::Set<Aws::String> ids;
+    auto outcome = paginator->ForEachPage([&ids](const ScanResult& page)
+    {
+        ids.insert(page.GetItems()[0].at("id").GetS());
+        return true;
+    });
+
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(4u * PAGES_PER_SEGMENT, ids.size());
+    ASSERT_EQ(1u, ids.count("3/4"));
+
+    ScanResult page;
+    ASSERT_FALSE(paginator->Next(page));
+}
+
+TEST(PaginatorTest, ThrottlingHalvesConcurrencyAndRetriesThePage)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    std::atomic<int> throttlesLeft(3);
+    auto fetcher = [&throttlesLeft](const ScanRequest& request)
+    {
+        if (throttlesLeft.fetch_sub(1) > 0)
+        {
+            return ScanOutcome(Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::PROVISIONED_THROUGHPUT_EXCEEDED,
+                "ProvisionedThroughputExceededException", "Rate exceeded", true));
+        }
+        return ScanPage(request);
+    };
+    auto paginator = Aws::MakeShared<ScanPaginator>(ALLOCATION_TAG, Configuration(&executor), SegmentRequests(4), fetcher);
+
+    size_t pages = 0;
+    ScanResult page;
+    while (paginator->Next(page))
+    {
+        if (pages++ == 0)
+        {
+            ASSERT_GT(4u, paginator->GetConcurrency());
+        }
+    }
+
+    ASSERT_TRUE(paginator->GetOutcome().IsSuccess());
+    ASSERT_EQ(4u * PAGES_PER_SEGMENT, pages);
+    ASSERT_EQ(3u, paginator->GetThrottleCount());
+}
+
+TEST(PaginatorTest, StopsRequestingWhenTheConsumerFallsBehind)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    std::atomic<size_t> requested(0);
+    auto fetcher = [&requested](const ScanRequest& request)
+    {
+        ++requested;
+        return ScanPage(request);
+    };
+    PaginatorConfiguration config = Configuration(&executor);
+    config.maxBufferedPages = 3;
+    auto paginator = Aws::MakeShared<ScanPaginator>(ALLOCATION_TAG, config, SegmentRequests(4), fetcher);
+
+    size_t consumed = 0;
+    ScanResult page;
+    while (paginator->Next(page))
+    {
+        ++consumed;
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        ASSERT_GE(consumed + config.maxBufferedPages, requested.load());
+    }
+    ASSERT_EQ(4u * PAGES_PER_SEGMENT, consumed);
+}
+
+TEST(PaginatorTest, ErrorsAndHandlersEndThePagination)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    auto failingFetcher = [](const ScanRequest& request)
+    {
+        if (request.GetSegment() == 1 && !request.GetExclusiveStartKey().empty())
+        {
+            return ScanOutcome(Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::VALIDATION, "ValidationException", "Bad key", false));
+        }
+        return ScanPage(request);
+    };
+    auto failing = Aws::MakeShared<ScanPaginator>(ALLOCATION_TAG, Configuration(&executor), SegmentRequests(2), failingFetcher);
+    auto outcome = failing->ForEachPage([](const ScanResult&) { return true; });
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(DynamoDBErrors::VALIDATION, outcome.GetError().GetErrorType());
+
+    auto stopped = Aws::MakeShared<ScanPaginator>(ALLOCATION_TAG, Configuration(&executor), SegmentRequests(4), ScanPage);
+    size_t pages = 0;
+    outcome = stopped->ForEachPage([&pages](const ScanResult&) { return ++pages < 3; });
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(3u, pages);
+    ScanResult page;
+    ASSERT_FALSE(stopped->Next(page));
+}
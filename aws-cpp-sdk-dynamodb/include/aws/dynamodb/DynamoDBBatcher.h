@@ -0,0 +1,195 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/dynamodb/DynamoDBErrors.h>
+#include <aws/dynamodb/model/AttributeValue.h>
+#include <aws/dynamodb/model/BatchGetItemRequest.h>
+#include <aws/dynamodb/model/BatchGetItemResult.h>
+#include <aws/dynamodb/model/BatchWriteItemRequest.h>
+#include <aws/dynamodb/model/BatchWriteItemResult.h>
+#include <aws/dynamodb/model/WriteRequest.h>
+#include <aws/core/NoResult.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace Aws
+{
+    namespace DynamoDB
+    {
+        typedef Aws::Utils::Outcome<Aws::NoResult, Aws::Client::AWSError<DynamoDBErrors>> BatchOutcome;
+
+        class BatchWriteEngine;
+        class BatchGetEngine;
+
+        /**
+         * Settings for DynamoDBBatchWriter and DynamoDBBatchGetter. Batches are sent with the synchronous client calls on executor,
+         * so each batch in flight holds one of its threads.
+         */
+        struct BatchConfiguration
+        {
+            BatchConfiguration(const std::shared_ptr<DynamoDBClient>& client, Aws::Utils::Threading::Executor* batchExecutor) :
+                dynamoDBClient(client), executor(batchExecutor), linger(std::chrono::milliseconds(10)), maxConcurrentRequests(4),
+                retryBackoff(std::chrono::milliseconds(50)), maxRetryBackoff(std::chrono::milliseconds(5000)), maxRetries(10),
+                consistentRead(false)
+            {
+            }
+
+            std::shared_ptr<DynamoDBClient> dynamoDBClient;
+            /**
+             * Sends the batches. Not owned; it must outlive the batches in flight.
+             */
+            Aws::Utils::Threading::Executor* executor;
+            /**
+             * How long a batch that is not full waits for more requests before it is sent.
+             */
+            std::chrono::milliseconds linger;
+            /**
+             * Upper bound on batches in flight; full batches queue up behind it.
+             */
+            size_t maxConcurrentRequests;
+            /**
+             * Delay before unprocessed or throttled requests are sent again, doubling on every attempt up to maxRetryBackoff.
+             */
+            std::chrono::milliseconds retryBackoff;
+            std::chrono::milliseconds maxRetryBackoff;
+            /**
+             * Attempts after which requests that are still unprocessed are reported as failed.
+             */
+            size_t maxRetries;
+            /**
+             * Whether DynamoDBBatchGetter asks for strongly consistent reads.
+             */
+            bool consistentRead;
+        };
+
+        /**
+         * Coalesces puts and deletes from any number of threads into BatchWriteItem requests of up to 25 writes. A batch is sent
+         * once it is full or has lingered for BatchConfiguration::linger, and the writes DynamoDB hands back as UnprocessedItems,
+         * or whole batches it throttles, are sent again with backoff.
+         *
+         * Writes are fire and forget; Flush() waits for everything written so far and returns the first error since the previous
+         * Flush(), and a handler can be set to see each write that failed. The destructor flushes.
+         *
+         * DynamoDB rejects a batch that writes the same item twice, so writes to one item within one linger period must be
+         * avoided or flushed in between.
+         */
+        class AWS_DYNAMODB_API DynamoDBBatchWriter
+        {
+        public:
+            typedef std::function<Model::BatchWriteItemOutcome(const Model::BatchWriteItemRequest&)> BatchWriteFunction;
+            typedef std::function<void(const Aws::String& tableName, const Model::WriteRequest&, const Aws::Client::AWSError<DynamoDBErrors>&)> WriteFailedHandler;
+
+            DynamoDBBatchWriter(const BatchConfiguration& config);
+            /**
+             * Sends batches through batchWrite instead of the configured client.
+             */
+            DynamoDBBatchWriter(const BatchConfiguration& config, const BatchWriteFunction& batchWrite);
+            ~DynamoDBBatchWriter();
+
+            /**
+             * Rule of 5 stuff.
+             * Don't copy or move
+             */
+            DynamoDBBatchWriter(const DynamoDBBatchWriter&) = delete;
+            DynamoDBBatchWriter& operator =(const DynamoDBBatchWriter&) = delete;
+            DynamoDBBatchWriter(DynamoDBBatchWriter&&) = delete;
+            DynamoDBBatchWriter& operator =(DynamoDBBatchWriter&&) = delete;
+
+            void Put(const Aws::String& tableName, const Aws::Map<Aws::String, Model::AttributeValue>& item);
+            void Put(const Aws::String& tableName, Aws::Map<Aws::String, Model::AttributeValue>&& item);
+            void Delete(const Aws::String& tableName, const Aws::Map<Aws::String, Model::AttributeValue>& key);
+
+            /**
+             * Sends what is pending right away and blocks until every write made so far has completed or failed.
+             */
+            BatchOutcome Flush();
+
+            /**
+             * Called on an executor thread with every write that failed.
+             */
+            void SetWriteFailedHandler(const WriteFailedHandler& handler);
+
+            /**
+             * Number of BatchWriteItem requests sent, counting re-sent ones.
+             */
+            size_t GetBatchCount() const;
+
+        private:
+            std::shared_ptr<BatchWriteEngine> m_engine;
+        };
+
+        /**
+         * Coalesces item lookups from any number of threads into BatchGetItem requests of up to 100 keys, and hands every item
+         * to the handler of its lookup. Lookups of the same key that are pending together share one key in the batch. Batches
+         * are sent when full or after BatchConfiguration::linger, and UnprocessedKeys are asked for again with backoff.
+         *
+         * Handlers run on an executor thread; an item that does not exist arrives as an empty map.
+         */
+        class AWS_DYNAMODB_API DynamoDBBatchGetter
+        {
+        public:
+            typedef std::function<Model::BatchGetItemOutcome(const Model::BatchGetItemRequest&)> BatchGetFunction;
+            typedef Aws::Utils::Outcome<Aws::Map<Aws::String, Model::AttributeValue>, Aws::Client::AWSError<DynamoDBErrors>> ItemOutcome;
+            typedef std::function<void(const ItemOutcome&)> ItemReceivedHandler;
+
+            DynamoDBBatchGetter(const BatchConfiguration& config);
+            /**
+             * Sends batches through batchGet instead of the configured client.
+             */
+            DynamoDBBatchGetter(const BatchConfiguration& config, const BatchGetFunction& batchGet);
+            ~DynamoDBBatchGetter();
+
+            /**
+             * Rule of 5 stuff.
+             * Don't copy or move
+             */
+            DynamoDBBatchGetter(const DynamoDBBatchGetter&) = delete;
+            DynamoDBBatchGetter& operator =(const DynamoDBBatchGetter&) = delete;
+            DynamoDBBatchGetter(DynamoDBBatchGetter&&) = delete;
+            DynamoDBBatchGetter& operator =(DynamoDBBatchGetter&&) = delete;
+
+            /**
+             * Looks up the item with key. A key with an attribute that is not a string, number or binary can't be matched to
+             * other lookups, so it is sent in a request of its own.
+             */
+            void Get(const Aws::String& tableName, const Aws::Map<Aws::String, Model::AttributeValue>& key, const ItemReceivedHandler& handler);
+
+            /**
+             * Sends what is pending right away and blocks until every lookup made so far has been handed to its handler.
+             */
+            BatchOutcome Flush();
+
+            /**
+             * Number of BatchGetItem requests sent, counting re-sent ones.
+             */
+            size_t GetBatchCount() const;
+
+        private:
+            std::shared_ptr<BatchGetEngine> m_engine;
+        };
+
+    } // namespace DynamoDB
+} // namespace Aws
@@ -0,0 +1,403 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/dynamodb/DynamoDBErrors.h>
+#include <aws/dynamodb/model/ScanRequest.h>
+#include <aws/dynamodb/model/ScanResult.h>
+#include <aws/dynamodb/model/QueryRequest.h>
+#include <aws/dynamodb/model/QueryResult.h>
+#include <aws/core/NoResult.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace DynamoDB
+    {
+        typedef Aws::Utils::Outcome<Aws::NoResult, Aws::Client::AWSError<DynamoDBErrors>> PaginationOutcome;
+
+        /**
+         * Settings for a Paginator. Page requests are made with the synchronous client calls on executor, so each request in
+         * flight holds one of its threads; a PooledThreadExecutor with a pool at least as large as maxConcurrentRequests bounds
+         * the work.
+         */
+        struct PaginatorConfiguration
+        {
+            PaginatorConfiguration(const std::shared_ptr<DynamoDBClient>& client, Aws::Utils::Threading::Executor* pageExecutor) :
+                dynamoDBClient(client), executor(pageExecutor), totalSegments(1), maxConcurrentRequests(8), maxBufferedPages(16),
+                throttleBackoff(std::chrono::milliseconds(100)), maxThrottleBackoff(std::chrono::milliseconds(20000))
+            {
+            }
+
+            std::shared_ptr<DynamoDBClient> dynamoDBClient;
+            /**
+             * Runs the page requests. Not owned; it must outlive the paginator's requests.
+             */
+            Aws::Utils::Threading::Executor* executor;
+            /**
+             * Number of segments a parallel scan is split into, unless the scan request sets TotalSegments itself.
+             * Queries always run as a single segment.
+             */
+            int totalSegments;
+            /**
+             * Upper bound on page requests in flight. Concurrency starts here, is halved whenever the table throttles and
+             * grows back by one after each run of successful pages.
+             */
+            size_t maxConcurrentRequests;
+            /**
+             * Pages that may be fetched or in flight ahead of the consumer. Once reached, no further requests are made until
+             * the consumer takes a page.
+             */
+            size_t maxBufferedPages;
+            /**
+             * Delay before a throttled page is asked for again, after the client's own retries have given up. Doubles on every
+             * consecutive throttle up to maxThrottleBackoff.
+             */
+            std::chrono::milliseconds throttleBackoff;
+            std::chrono::milliseconds maxThrottleBackoff;
+        };
+
+        /**
+         * Fetches every page of a Scan or Query, following LastEvaluatedKey, with the segments of a parallel scan running
+         * concurrently on the configured executor. Pages are handed out in the order they arrive, either one at a time through
+         * Next(), or to a handler through ForEachPage(); both run on the consuming thread.
+         *
+         * Create one with ParallelScan() or PaginateQuery(). The paginator must be owned by a std::shared_ptr, since requests in
+         * flight keep it alive.
+         */
+        template<typename REQUEST_TYPE, typename RESULT_TYPE>
+        class Paginator : public std::enable_shared_from_this<Paginator<REQUEST_TYPE, RESULT_TYPE>>
+        {
+        public:
+            typedef Aws::Utils::Outcome<RESULT_TYPE, Aws::Client::AWSError<DynamoDBErrors>> PageOutcome;
+            typedef std::function<PageOutcome(const REQUEST_TYPE&)> PageFetcher;
+            typedef std::function<bool(const RESULT_TYPE&)> PageHandler;
+
+            /**
+             * segmentRequests holds the request for the first page of every segment; fetcher makes one page request.
+             * Nothing is requested until the first call to Next() or ForEachPage().
+             */
+            Paginator(const PaginatorConfiguration& config, const Aws::Vector<REQUEST_TYPE>& segmentRequests, const PageFetcher& fetcher) :
+                m_executor(config.executor),
+                m_fetcher(fetcher),
+                m_ready(segmentRequests.begin(), segmentRequests.end()),
+                m_maxConcurrency((std::max)(static_cast<size_t>(1), (std::min)(config.maxConcurrentRequests, segmentRequests.size()))),
+                m_concurrency(m_maxConcurrency),
+                m_maxBufferedPages((std::max)(static_cast<size_t>(1), config.maxBufferedPages)),
+                m_initialBackoff(config.throttleBackoff),
+                m_maxBackoff(config.maxThrottleBackoff),
+                m_backoff(config.throttleBackoff),
+                m_unfinishedSegments(segmentRequests.size()),
+                m_inFlight(0),
+                m_successesAtConcurrency(0),
+                m_throttleCount(0),
+                m_stopped(false),
+                m_failed(false)
+            {
+            }
+
+            /**
+             * Rule of 5 stuff.
+             * Don't copy or move
+             */
+            Paginator(const Paginator&) = delete;
+            Paginator& operator =(const Paginator&) = delete;
+            Paginator(Paginator&&) = delete;
+            Paginator& operator =(Paginator&&) = delete;
+
+            /**
+             * Blocks until the next page has arrived and moves it into page. Returns false once every segment is exhausted,
+             * after Stop(), or after a request failed for a reason other than throttling; check GetOutcome() to tell these apart.
+             */
+            bool Next(RESULT_TYPE& page)
+            {
+                std::unique_lock<std::mutex> locker(m_lock);
+                Dispatch(locker);
+                m_signal.wait(locker, [this]() { return !m_pages.empty() || m_stopped || m_failed || m_unfinishedSegments == 0; });
+                if (m_pages.empty() || m_stopped)
+                {
+                    return false;
+                }
+
+                page = std::move(m_pages.front());
+                m_pages.pop_front();
+                //a slot in the buffer is free again.
+                Dispatch(locker);
+                return true;
+            }
+
+            /**
+             * Calls handler with every page on this thread until the pages run out or handler returns false, in which case the
+             * paginator is stopped. Returns the error that ended the pagination, if any.
+             */
+            PaginationOutcome ForEachPage(const PageHandler& handler)
+            {
+                RESULT_TYPE page;
+                while (Next(page))
+                {
+                    if (!handler(page))
+                    {
+                        Stop();
+                        break;
+                    }
+                }
+
+                return GetOutcome();
+            }
+
+            /**
+             * Makes no further requests and drops the buffered pages; responses still in flight are discarded.
+             */
+            void Stop()
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                m_stopped = true;
+                m_pages.clear();
+                m_signal.notify_all();
+            }
+
+            /**
+             * The error of the request that ended the pagination, or success.
+             */
+            PaginationOutcome GetOutcome() const
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (m_failed)
+                {
+                    return PaginationOutcome(m_error);
+                }
+                return PaginationOutcome(Aws::NoResult());
+            }
+
+            /**
+             * Current limit on requests in flight, as adapted to throttling.
+             */
+            size_t GetConcurrency() const
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                return m_concurrency;
+            }
+
+            /**
+             * Number of page requests the table throttled.
+             */
+            size_t GetThrottleCount() const
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                return m_throttleCount;
+            }
+
+        private:
+            static bool IsThrottle(const Aws::Client::AWSError<DynamoDBErrors>& error)
+            {
+                return error.GetErrorType() == DynamoDBErrors::PROVISIONED_THROUGHPUT_EXCEEDED ||
+                       error.GetErrorType() == DynamoDBErrors::THROTTLING ||
+                       error.GetErrorType() == DynamoDBErrors::REQUEST_LIMIT_EXCEEDED;
+            }
+
+            /**
+             * Submits requests while there is room under the concurrency limit and in the page buffer. The lock is released while
+             * submitting, so an executor that runs tasks inline does not deadlock.
+             */
+            void Dispatch(std::unique_lock<std::mutex>& locker)
+            {
+                Aws::Vector<REQUEST_TYPE> toSubmit;
+                while (!m_stopped && !m_failed && !m_ready.empty() && m_inFlight < m_concurrency &&
+                       m_pages.size() + m_inFlight < m_maxBufferedPages)
+                {
+                    toSubmit.push_back(std::move(m_ready.front()));
+                    m_ready.pop_front();
+                    ++m_inFlight;
+                }
+
+                if (toSubmit.empty())
+                {
+                    return;
+                }
+
+                auto self = this->shared_from_this();
+                locker.unlock();
+                for (auto& request : toSubmit)
+                {
+                    if (!m_executor->Submit([self, request]() { self->Fetch(request); }))
+                    {
+                        self->Fail(Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::INTERNAL_FAILURE, "ExecutorRejected",
+                            "The executor rejected a page request.", false));
+                    }
+                }
+                locker.lock();
+            }
+
+            void Fetch(const REQUEST_TYPE& request)
+            {
+                PageOutcome outcome = m_fetcher(request);
+
+                std::unique_lock<std::mutex> locker(m_lock);
+                --m_inFlight;
+                if (outcome.IsSuccess())
+                {
+                    RESULT_TYPE& page = outcome.GetResult();
+                    if (page.GetLastEvaluatedKey().empty())
+                    {
+                        --m_unfinishedSegments;
+                    }
+                    else
+                    {
+                        REQUEST_TYPE nextRequest(request);
+                        nextRequest.SetExclusiveStartKey(page.GetLastEvaluatedKey());
+                        m_ready.push_back(std::move(nextRequest));
+                    }
+
+                    //additive increase: one more request in flight after a full round at the current concurrency.
+                    m_backoff = m_initialBackoff;
+                    if (m_concurrency < m_maxConcurrency && ++m_successesAtConcurrency >= m_concurrency)
+                    {
+                        ++m_concurrency;
+                        m_successesAtConcurrency = 0;
+                    }
+
+                    if (!m_stopped)
+                    {
+                        m_pages.push_back(std::move(page));
+                    }
+                }
+                else if (IsThrottle(outcome.GetError()))
+                {
+                    //multiplicative decrease, and the same page is asked for again after a backoff.
+                    ++m_throttleCount;
+                    m_concurrency = (std::max)(static_cast<size_t>(1), m_concurrency / 2);
+                    m_successesAtConcurrency = 0;
+                    auto delay = m_backoff;
+                    m_backoff = (std::min)(m_backoff * 2, m_maxBackoff);
+                    ++m_inFlight;
+
+                    auto self = this->shared_from_this();
+                    locker.unlock();
+                    if (!m_executor->SubmitAfter(delay, [self, request]() { self->Retry(request); }))
+                    {
+                        Fail(outcome.GetError());
+                    }
+                    return;
+                }
+                else
+                {
+                    m_failed = true;
+                    m_error = outcome.GetError();
+                }
+
+                m_signal.notify_all();
+                Dispatch(locker);
+            }
+
+            void Retry(const REQUEST_TYPE& request)
+            {
+                std::unique_lock<std::mutex> locker(m_lock);
+                --m_inFlight;
+                m_ready.push_front(request);
+                Dispatch(locker);
+            }
+
+            void Fail(const Aws::Client::AWSError<DynamoDBErrors>& error)
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                --m_inFlight;
+                if (!m_failed)
+                {
+                    m_failed = true;
+                    m_error = error;
+                }
+                m_signal.notify_all();
+            }
+
+            Aws::Utils::Threading::Executor* m_executor;
+            PageFetcher m_fetcher;
+            mutable std::mutex m_lock;
+            std::condition_variable m_signal;
+            Aws::Deque<REQUEST_TYPE> m_ready;
+            Aws::Deque<RESULT_TYPE> m_pages;
+            size_t m_maxConcurrency;
+            size_t m_concurrency;
+            size_t m_maxBufferedPages;
+            std::chrono::milliseconds m_initialBackoff;
+            std::chrono::milliseconds m_maxBackoff;
+            std::chrono::milliseconds m_backoff;
+            size_t m_unfinishedSegments;
+            size_t m_inFlight;
+            size_t m_successesAtConcurrency;
+            size_t m_throttleCount;
+            bool m_stopped;
+            bool m_failed;
+            Aws::Client::AWSError<DynamoDBErrors> m_error;
+        };
+
+        typedef Paginator<Model::ScanRequest, Model::ScanResult> ScanPaginator;
+        typedef Paginator<Model::QueryRequest, Model::QueryResult> QueryPaginator;
+
+        /**
+         * Scans the table of request in config.totalSegments segments, or in request's own TotalSegments when it sets them.
+         * For a full table export:
+         *
+         *     auto outcome = ParallelScan(config, request)->ForEachPage([](const Model::ScanResult& page) { ...; return true; });
+         */
+        inline std::shared_ptr<ScanPaginator> ParallelScan(const PaginatorConfiguration& config, const Model::ScanRequest& request)
+        {
+            int totalSegments = request.TotalSegmentsHasBeenSet() ? request.GetTotalSegments() : config.totalSegments;
+            Aws::Vector<Model::ScanRequest> segmentRequests;
+            if (totalSegments <= 1 || request.SegmentHasBeenSet())
+            {
+                segmentRequests.push_back(request);
+            }
+            else
+            {
+                for (int segment = 0; segment < totalSegments; ++segment)
+                {
+                    Model::ScanRequest segmentRequest(request);
+                    segmentRequest.SetSegment(segment);
+                    segmentRequest.SetTotalSegments(totalSegments);
+                    segmentRequests.push_back(std::move(segmentRequest));
+                }
+            }
+
+            auto client = config.dynamoDBClient;
+            return Aws::MakeShared<ScanPaginator>("DynamoDBPaginator", config, segmentRequests,
+                [client](const Model::ScanRequest& segmentRequest) { return client->Scan(segmentRequest); });
+        }
+
+        /**
+         * Pages through the results of request.
+         */
+        inline std::shared_ptr<QueryPaginator> PaginateQuery(const PaginatorConfiguration& config, const Model::QueryRequest& request)
+        {
+            auto client = config.dynamoDBClient;
+            return Aws::MakeShared<QueryPaginator>("DynamoDBPaginator", config, Aws::Vector<Model::QueryRequest>(1, request),
+                [client](const Model::QueryRequest& pageRequest) { return client->Query(pageRequest); });
+        }
+
+    } // namespace DynamoDB
+} // namespace Aws
@@ -18,8 +18,11 @@
 #include <aws/dynamodb/DynamoDB_EXPORTS.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/Array.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 namespace Aws
 {
@@ -27,21 +30,27 @@ namespace DynamoDB
 {
 namespace Model
 {
-class AttributeValueValue;
-
 enum class ValueType {STRING, NUMBER, BYTEBUFFER, STRING_SET, NUMBER_SET, BYTEBUFFER_SET, ATTRIBUTE_MAP, ATTRIBUTE_LIST, BOOL, NULLVALUE};
 
 /// http://docs.aws.amazon.com/amazondynamodb/latest/APIReference/API_AttributeValue.html
+/// The value is stored inline as a tagged union, so strings short enough for the string's own small buffer, numbers and
+/// booleans cost no allocation, and getters return references to the stored value rather than copies.
 class AWS_DYNAMODB_API AttributeValue
 {
 public:
-    AttributeValue() {};
-    explicit AttributeValue(const Aws::String& s) { SetS(s); }
-    explicit AttributeValue(const Aws::Vector<Aws::String>& ss) { SetSS(ss); }
-    AttributeValue(Aws::Utils::Json::JsonView jsonValue) { *this = jsonValue; }
+    AttributeValue() : m_type(ValueType::NULLVALUE), m_hasValue(false) {}
+    explicit AttributeValue(const Aws::String& s) : AttributeValue() { SetS(s); }
+    explicit AttributeValue(const Aws::Vector<Aws::String>& ss) : AttributeValue() { SetSS(ss); }
+    AttributeValue(Aws::Utils::Json::JsonView jsonValue) : AttributeValue() { *this = jsonValue; }
+    AttributeValue(Aws::Utils::Json::JsonReader& jsonReader) : AttributeValue() { *this = jsonReader; }
+    AttributeValue(const AttributeValue& other);
+    AttributeValue(AttributeValue&& other);
+    AttributeValue& operator = (const AttributeValue& other);
+    AttributeValue& operator = (AttributeValue&& other);
+    ~AttributeValue();
 
     /// returns the String value if the value is specialized to this type, otherwise an empty String
-    const Aws::String GetS() const;
+    const Aws::String& GetS() const;
     /// if already specialized to a String, sets the value to this String
     /// if uninitialized, specializes the type to a String with specified value
     /// if already specialized to another type then the behavior is undefined
@@ -51,7 +60,7 @@ public:
     AttributeValue& SetS(const char* n) { return SetS(Aws::String(n)); }
 
     /// returns the Number value if the value is specialized to this type, otherwise an empty String
-    const Aws::String GetN() const;
+    const Aws::String& GetN() const;
     /// if already specialized to a Number, sets the value to this Number
     /// if uninitialized, specializes the type to a Number with specified value
     /// if already specialized to another type then the behavior is undefined
@@ -62,14 +71,14 @@ public:
     AttributeValue& SetN(const char* n) { return SetN(Aws::String(n)); }
 
     /// returns the ByteBuffer if the value is specialized to this type, otherwise an empty Buffer
-    const Aws::Utils::ByteBuffer GetB() const;
+    const Aws::Utils::ByteBuffer& GetB() const;
     /// if already specialized to a ByteBuffer, sets the value to this value
     /// if uninitialized, specializes the type to a ByteBuffer with the specified value
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetB(const Aws::Utils::ByteBuffer& b);
 
     /// returns the String Vector if the value is specialized to this type, otherwise an empty Vector
-    const Aws::Vector<Aws::String> GetSS() const;
+    const Aws::Vector<Aws::String>& GetSS() const;
     /// if already specialized to a String Set, sets to these values
     /// if uninitialized, specializes the type to a String Set with specified values
     /// if already specialized to another type then the behavior is undefined
@@ -84,7 +93,7 @@ public:
     AttributeValue& AddSItem(const char* sItem) { return AddSItem(Aws::String(sItem)); }
 
     /// returns the Number Vector if the value is specialized to this type, otherwise an empty Vector
-    const Aws::Vector<Aws::String> GetNS() const;
+    const Aws::Vector<Aws::String>& GetNS() const;
     /// if already specialized to a Number Set, sets to these values
     /// if uninitialized, specializes the type to a Number Set with specified values
     /// if already specialized to another type then the behavior is undefined
@@ -99,7 +108,7 @@ public:
     AttributeValue& AddNItem(const char* nItem) { return AddNItem(Aws::String(nItem)); }
 
     /// returns the ByteBuffer Vector if the value is specialized to this type, otherwise an empty Vector
-    const Aws::Vector<Aws::Utils::ByteBuffer> GetBS() const;
+    const Aws::Vector<Aws::Utils::ByteBuffer>& GetBS() const;
     /// if already specialized to a ByteBuffer Set, sets to these values
     /// if uninitialized, specializes the type to a ByteBuffer Set with specified values
     /// if already specialized to another type then the behavior is undefined
@@ -114,7 +123,7 @@ public:
     AttributeValue& AddBItem(const unsigned char* bItem, size_t size);
 
     /// returns the Attribute Map if the value is specialized to this type, otherwise an empty Map
-    const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> GetM() const;
+    const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>& GetM() const;
     /// if already specialized to an Attribute Map, sets to these values
     /// if uninitialized, specializes the type to an Attribute Map with specified values
     /// if already specialized to another type then the behavior is undefined
@@ -129,7 +138,7 @@ public:
     AttributeValue& AddMEntry(const char* key, const std::shared_ptr<AttributeValue>& value) { return AddMEntry(Aws::String(key), value); }
 
     /// returns the Attribute List if the value is specialized to this type, otherwise an empty Vector
-    const Aws::Vector<std::shared_ptr<AttributeValue>> GetL() const;
+    const Aws::Vector<std::shared_ptr<AttributeValue>>& GetL() const;
     /// if already specialized to an Attribute List, sets to these values
     /// if uninitialized, specializes the type to an Attribute List with specified values
     /// if already specialized to another type then the behavior is undefined
@@ -154,16 +163,41 @@ public:
     AttributeValue& SetNull(bool value);
 
     AttributeValue& operator = (Aws::Utils::Json::JsonView);
+    /// reads one {"<type>": value} object from the reader, without building a DOM
+    AttributeValue& operator = (Aws::Utils::Json::JsonReader&);
 
     bool operator == (const AttributeValue& other) const;
     inline bool operator != (const AttributeValue& other) const { return !(*this == other); }
 
     Aws::String SerializeAttribute() const;
     Aws::Utils::Json::JsonValue Jsonize() const;
+    /// writes the same JSON as Jsonize() straight to the writer
+    void Jsonize(Aws::Utils::Json::JsonWriter& jsonWriter) const;
     ValueType GetType() const;
 
 private:
-    std::shared_ptr<AttributeValueValue> m_value;
+    typedef Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> AttributeMap;
+    typedef Aws::Vector<std::shared_ptr<AttributeValue>> AttributeList;
+
+    /// destroys the current value and leaves an empty value of the given type in its place
+    void Specialize(ValueType type);
+    void Destroy();
+    /// takes other's value; this value must be empty and must not own other
+    void MoveFrom(AttributeValue&& other);
+    bool IsDefault() const;
+
+    ValueType m_type;
+    bool m_hasValue;
+    union
+    {
+        Aws::String m_s;
+        Aws::Utils::ByteBuffer m_b;
+        Aws::Vector<Aws::String> m_stringSet;
+        Aws::Vector<Aws::Utils::ByteBuffer> m_bS;
+        AttributeMap m_m;
+        AttributeList m_l;
+        bool m_bool;
+    };
 };
 
 } // namespace Model
@@ -24,6 +24,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -43,6 +44,8 @@ namespace Model
     Capacity();
     Capacity(Aws::Utils::Json::JsonView jsonValue);
     Capacity& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Capacity(Aws::Utils::Json::JsonReader& jsonReader);
+    Capacity& operator=(Aws::Utils::Json::JsonReader& jsonReader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
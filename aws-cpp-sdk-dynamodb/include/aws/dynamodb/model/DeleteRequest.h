@@ -28,6 +28,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonWriter;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -48,6 +49,7 @@ namespace Model
     DeleteRequest(Aws::Utils::Json::JsonView jsonValue);
     DeleteRequest& operator=(Aws::Utils::Json::JsonView jsonValue);
     Aws::Utils::Json::JsonValue Jsonize() const;
+    void Jsonize(Aws::Utils::Json::JsonWriter& jsonWriter) const;
 
 
     /**
@@ -32,7 +32,12 @@ namespace Utils
 namespace Json
 {
   class JsonValue;
+  class JsonReader;
 } // namespace Json
+namespace Stream
+{
+  class ResponseStream;
+} // namespace Stream
 } // namespace Utils
 namespace DynamoDB
 {
@@ -50,6 +55,16 @@ namespace Model
     QueryResult();
     QueryResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     QueryResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    /**
+     * Decodes the response body straight from the stream, without building a DOM.
+     */
+    QueryResult(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result);
+    QueryResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result);
+    /**
+     * Decodes the response body from jsonReader. A malformed or truncated body leaves this result partly
+     * filled, so check jsonReader.WasParseSuccessful() before using it.
+     */
+    QueryResult(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result, Aws::Utils::Json::JsonReader& jsonReader);
 
 
     /**
@@ -0,0 +1,635 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/dynamodb/DynamoDBBatcher.h>
+#include <aws/dynamodb/model/KeysAndAttributes.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+using namespace Aws::DynamoDB;
+using namespace Aws::DynamoDB::Model;
+using namespace Aws::Client;
+using namespace Aws::Utils;
+
+static const char CLASS_TAG[] = "DynamoDBBatcher";
+static const size_t MAX_WRITES_PER_BATCH = 25;
+static const size_t MAX_KEYS_PER_BATCH = 100;
+
+namespace Aws
+{
+    namespace DynamoDB
+    {
+        /**
+         * Cuts the entries handed to Add() into batches of at most maxBatchSize and sends them on the executor, at most
+         * maxConcurrentRequests at a time. Whatever Send() hands back as unprocessed goes to the front of the queue again after a
+         * backoff. m_outstanding counts the entries that have not completed yet, which is what Flush() waits on.
+         */
+        template<typename ENTRY>
+        class BatchEngine : public std::enable_shared_from_this<BatchEngine<ENTRY>>
+        {
+        public:
+            typedef Outcome<Aws::Vector<ENTRY>, AWSError<DynamoDBErrors>> SendOutcome;
+
+            BatchEngine(const BatchConfiguration& config, size_t maxBatchSize) :
+                m_config(config), m_maxBatchSize(maxBatchSize), m_lingerGeneration(0), m_inFlight(0), m_outstanding(0),
+                m_hasError(false), m_batchCount(0)
+            {
+            }
+
+            virtual ~BatchEngine() = default;
+
+            void Add(ENTRY&& entry)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (SendAlone(entry))
+                {
+                    ++m_outstanding;
+                    Batch batch{Aws::Vector<ENTRY>(), 0};
+                    batch.entries.push_back(std::move(entry));
+                    m_ready.push_back(std::move(batch));
+                    Dispatch(lock);
+                    return;
+                }
+
+                for (auto& pending : m_pending)
+                {
+                    if (Coalesce(pending, entry))
+                    {
+                        return;
+                    }
+                }
+
+                m_pending.push_back(std::move(entry));
+                ++m_outstanding;
+                if (m_pending.size() >= m_maxBatchSize)
+                {
+                    CutBatch();
+                    Dispatch(lock);
+                    return;
+                }
+                if (m_pending.size() > 1)
+                {
+                    return;
+                }
+
+                //the executor may run the timer inline, or reject it, so don't hold the lock Linger takes.
+                size_t generation = ++m_lingerGeneration;
+                lock.unlock();
+                std::weak_ptr<BatchEngine> weakSelf = this->shared_from_this();
+                bool scheduled = m_config.executor->SubmitAfter(m_config.linger, [weakSelf, generation]()
+                {
+                    if (auto self = weakSelf.lock())
+                    {
+                        self->Linger(generation);
+                    }
+                });
+                if (!scheduled)
+                {
+                    //nothing would cut this batch before a flush, so send it without lingering.
+                    Linger(generation);
+                }
+            }
+
+            BatchOutcome Flush()
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (!m_pending.empty())
+                {
+                    CutBatch();
+                    Dispatch(lock);
+                }
+                m_drained.wait(lock, [this]() { return m_outstanding == 0; });
+
+                if (m_hasError)
+                {
+                    m_hasError = false;
+                    return BatchOutcome(m_firstError);
+                }
+                return BatchOutcome(NoResult());
+            }
+
+            size_t GetBatchCount() const
+            {
+                return m_batchCount.load();
+            }
+
+        protected:
+            /**
+             * Sends one batch. Entries that completed are done with; the ones DynamoDB did not process are returned to be sent
+             * again. An error means none of the entries were processed.
+             */
+            virtual SendOutcome Send(const Aws::Vector<ENTRY>& entries) = 0;
+
+            /**
+             * Reports an entry that will not be sent again.
+             */
+            virtual void Failed(const ENTRY& entry, const AWSError<DynamoDBErrors>& error) = 0;
+
+            /**
+             * Folds entry into an equivalent pending one instead of sending it twice. Called with the lock held.
+             */
+            virtual bool Coalesce(ENTRY&, ENTRY&)
+            {
+                return false;
+            }
+
+            /**
+             * True for an entry that can't share a batch, because it can't be told apart from the others in it.
+             */
+            virtual bool SendAlone(const ENTRY&) const
+            {
+                return false;
+            }
+
+            std::mutex m_mutex;
+
+        private:
+            struct Batch
+            {
+                Aws::Vector<ENTRY> entries;
+                size_t attempt;
+            };
+
+            void Linger(size_t generation)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (generation == m_lingerGeneration && !m_pending.empty())
+                {
+                    CutBatch();
+                    Dispatch(lock);
+                }
+            }
+
+            void CutBatch()
+            {
+                m_ready.push_back(Batch{std::move(m_pending), 0});
+                m_pending.clear();
+                //the linger timer of these entries must not cut the next batch early.
+                ++m_lingerGeneration;
+            }
+
+            //takes as many ready batches as there are free slots and submits them without holding the lock.
+            void Dispatch(std::unique_lock<std::mutex>& lock)
+            {
+                Aws::Vector<std::shared_ptr<Batch>> toSend;
+                while (!m_ready.empty() && m_inFlight < m_config.maxConcurrentRequests)
+                {
+                    toSend.push_back(Aws::MakeShared<Batch>(CLASS_TAG, std::move(m_ready.front())));
+                    m_ready.pop_front();
+                    ++m_inFlight;
+                }
+                if (toSend.empty())
+                {
+                    return;
+                }
+
+                auto self = this->shared_from_this();
+                lock.unlock();
+                for (auto& batch : toSend)
+                {
+                    if (!m_config.executor->Submit([self, batch]() { self->Run(*batch); }))
+                    {
+                        Run(*batch);
+                    }
+                }
+                lock.lock();
+            }
+
+            void Run(Batch& batch)
+            {
+                ++m_batchCount;
+                size_t batchSize = batch.entries.size();
+                Aws::Vector<ENTRY> unprocessed;
+                auto outcome = Send(batch.entries);
+                if (outcome.IsSuccess())
+                {
+                    unprocessed = std::move(outcome.GetResult());
+                }
+                else if (outcome.GetError().ShouldRetry())
+                {
+                    //throttling or a service side failure; the whole batch goes again.
+                    unprocessed = std::move(batch.entries);
+                }
+                else
+                {
+                    Fail(batch.entries, outcome.GetError());
+                }
+
+                size_t completed = batchSize - unprocessed.size();
+                if (!unprocessed.empty())
+                {
+                    if (batch.attempt + 1 >= m_config.maxRetries)
+                    {
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, unprocessed.size() << " requests still unprocessed after " << batch.attempt + 1
+                            << " attempts, giving up on them.");
+                        Fail(unprocessed, AWSError<DynamoDBErrors>(DynamoDBErrors::PROVISIONED_THROUGHPUT_EXCEEDED, "UnprocessedItems",
+                            "Requests were still unprocessed after the maximum number of attempts", true));
+                        completed += unprocessed.size();
+                    }
+                    else if (!Retry(unprocessed, batch.attempt + 1))
+                    {
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, "The executor rejected the retry of " << unprocessed.size() << " requests, giving up on them.");
+                        Fail(unprocessed, AWSError<DynamoDBErrors>(DynamoDBErrors::PROVISIONED_THROUGHPUT_EXCEEDED, "UnprocessedItems",
+                            "Requests were unprocessed and their retry could not be scheduled", true));
+                        completed += unprocessed.size();
+                    }
+                }
+
+                std::unique_lock<std::mutex> lock(m_mutex);
+                --m_inFlight;
+                Complete(completed);
+                Dispatch(lock);
+            }
+
+            //schedules entries to go to the front of the queue after a backoff. On false they are left in entries.
+            bool Retry(Aws::Vector<ENTRY>& entries, size_t attempt)
+            {
+                auto shift = (std::min)(attempt - 1, static_cast<size_t>(20));
+                std::chrono::milliseconds backoff((std::min)(m_config.retryBackoff.count() << shift, m_config.maxRetryBackoff.count()));
+
+                auto self = this->shared_from_this();
+                auto batch = Aws::MakeShared<Batch>(CLASS_TAG, Batch{std::move(entries), attempt});
+                bool scheduled = m_config.executor->SubmitAfter(backoff, [self, batch]()
+                {
+                    std::unique_lock<std::mutex> lock(self->m_mutex);
+                    self->m_ready.push_front(std::move(*batch));
+                    self->Dispatch(lock);
+                });
+                if (!scheduled)
+                {
+                    entries = std::move(batch->entries);
+                }
+                return scheduled;
+            }
+
+            void Fail(const Aws::Vector<ENTRY>& entries, const AWSError<DynamoDBErrors>& error)
+            {
+                for (const auto& entry : entries)
+                {
+                    Failed(entry, error);
+                }
+
+                std::lock_guard<std::mutex> locker(m_mutex);
+                if (!m_hasError)
+                {
+                    m_hasError = true;
+                    m_firstError = error;
+                }
+            }
+
+            void Complete(size_t count)
+            {
+                m_outstanding -= count;
+                if (m_outstanding == 0)
+                {
+                    m_drained.notify_all();
+                }
+            }
+
+            BatchConfiguration m_config;
+            size_t m_maxBatchSize;
+            std::condition_variable m_drained;
+            Aws::Vector<ENTRY> m_pending;
+            size_t m_lingerGeneration;
+            Aws::Deque<Batch> m_ready;
+            size_t m_inFlight;
+            size_t m_outstanding;
+            bool m_hasError;
+            AWSError<DynamoDBErrors> m_firstError;
+            std::atomic<size_t> m_batchCount;
+        };
+
+        struct PendingWrite
+        {
+            Aws::String tableName;
+            WriteRequest request;
+        };
+
+        class BatchWriteEngine : public BatchEngine<PendingWrite>
+        {
+        public:
+            BatchWriteEngine(const BatchConfiguration& config, const DynamoDBBatchWriter::BatchWriteFunction& batchWrite) :
+                BatchEngine<PendingWrite>(config, MAX_WRITES_PER_BATCH), m_batchWrite(batchWrite)
+            {
+            }
+
+            void SetWriteFailedHandler(const DynamoDBBatchWriter::WriteFailedHandler& handler)
+            {
+                std::lock_guard<std::mutex> locker(m_mutex);
+                m_writeFailedHandler = handler;
+            }
+
+        protected:
+            SendOutcome Send(const Aws::Vector<PendingWrite>& entries) override
+            {
+                Aws::Map<Aws::String, Aws::Vector<WriteRequest>> requestItems;
+                for (const auto& entry : entries)
+                {
+                    requestItems[entry.tableName].push_back(entry.request);
+                }
+                BatchWriteItemRequest request;
+                request.SetRequestItems(std::move(requestItems));
+
+                auto outcome = m_batchWrite(request);
+                if (!outcome.IsSuccess())
+                {
+                    return SendOutcome(outcome.GetError());
+                }
+
+                Aws::Vector<PendingWrite> unprocessed;
+                for (const auto& table : outcome.GetResult().GetUnprocessedItems())
+                {
+                    for (const auto& writeRequest : table.second)
+                    {
+                        unprocessed.push_back(PendingWrite{table.first, writeRequest});
+                    }
+                }
+                return SendOutcome(std::move(unprocessed));
+            }
+
+            void Failed(const PendingWrite& entry, const AWSError<DynamoDBErrors>& error) override
+            {
+                DynamoDBBatchWriter::WriteFailedHandler handler;
+                {
+                    std::lock_guard<std::mutex> locker(m_mutex);
+                    handler = m_writeFailedHandler;
+                }
+                if (handler)
+                {
+                    handler(entry.tableName, entry.request, error);
+                }
+            }
+
+        private:
+            DynamoDBBatchWriter::BatchWriteFunction m_batchWrite;
+            DynamoDBBatchWriter::WriteFailedHandler m_writeFailedHandler;
+        };
+
+        struct PendingGet
+        {
+            Aws::String tableName;
+            Aws::Map<Aws::String, AttributeValue> key;
+            Aws::String signature;
+            Aws::Vector<DynamoDBBatchGetter::ItemReceivedHandler> handlers;
+        };
+
+        class BatchGetEngine : public BatchEngine<PendingGet>
+        {
+        public:
+            BatchGetEngine(const BatchConfiguration& config, const DynamoDBBatchGetter::BatchGetFunction& batchGet) :
+                BatchEngine<PendingGet>(config, MAX_KEYS_PER_BATCH), m_batchGet(batchGet), m_consistentRead(config.consistentRead)
+            {
+            }
+
+            /**
+             * Identifies the item a key or a returned item belongs to by the values of the key attributes. Key attributes are
+             * always strings, numbers or binaries.
+             */
+            static Aws::String Signature(const Aws::String& tableName, const Aws::Vector<Aws::String>& keyNames,
+                const Aws::Map<Aws::String, AttributeValue>& item)
+            {
+                Aws::String signature = tableName;
+                for (const auto& name : keyNames)
+                {
+                    auto attribute = item.find(name);
+                    if (attribute == item.end())
+                    {
+                        return Aws::String();
+                    }
+
+                    signature += '\0';
+                    signature += name;
+                    signature += '\0';
+                    switch (attribute->second.GetType())
+                    {
+                        case ValueType::STRING:
+                            signature += 'S';
+                            signature += attribute->second.GetS();
+                            break;
+                        case ValueType::NUMBER:
+                            signature += 'N';
+                            signature += attribute->second.GetN();
+                            break;
+                        case ValueType::BYTEBUFFER:
+                            signature += 'B';
+                            signature.append(reinterpret_cast<const char*>(attribute->second.GetB().GetUnderlyingData()),
+                                attribute->second.GetB().GetLength());
+                            break;
+                        default:
+                            return Aws::String();
+                    }
+                }
+                return signature;
+            }
+
+            static Aws::Vector<Aws::String> KeyNames(const Aws::Map<Aws::String, AttributeValue>& key)
+            {
+                Aws::Vector<Aws::String> names;
+                for (const auto& attribute : key)
+                {
+                    names.push_back(attribute.first);
+                }
+                return names;
+            }
+
+        protected:
+            SendOutcome Send(const Aws::Vector<PendingGet>& entries) override
+            {
+                BatchGetItemRequest request;
+                Aws::Map<Aws::String, KeysAndAttributes> requestItems;
+                Aws::Map<Aws::String, Aws::Vector<Aws::String>> keyNames;
+                Aws::Map<Aws::String, size_t> entryBySignature;
+                for (size_t i = 0; i < entries.size(); ++i)
+                {
+                    auto& keys = requestItems[entries[i].tableName];
+                    keys.AddKeys(entries[i].key);
+                    if (m_consistentRead)
+                    {
+                        keys.SetConsistentRead(true);
+                    }
+                    keyNames.emplace(entries[i].tableName, KeyNames(entries[i].key));
+                    entryBySignature.emplace(entries[i].signature, i);
+                }
+                request.SetRequestItems(std::move(requestItems));
+
+                auto outcome = m_batchGet(request);
+                if (!outcome.IsSuccess())
+                {
+                    return SendOutcome(outcome.GetError());
+                }
+
+                Aws::Vector<bool> answered(entries.size(), false);
+                for (const auto& table : outcome.GetResult().GetResponses())
+                {
+                    auto names = keyNames.find(table.first);
+                    if (names == keyNames.end())
+                    {
+                        continue;
+                    }
+                    for (const auto& item : table.second)
+                    {
+                        auto entry = entryBySignature.find(Signature(table.first, names->second, item));
+                        if (entry != entryBySignature.end() && !answered[entry->second])
+                        {
+                            answered[entry->second] = true;
+                            Deliver(entries[entry->second], DynamoDBBatchGetter::ItemOutcome(item));
+                        }
+                    }
+                }
+
+                Aws::Vector<PendingGet> unprocessed;
+                for (const auto& table : outcome.GetResult().GetUnprocessedKeys())
+                {
+                    for (const auto& key : table.second.GetKeys())
+                    {
+                        auto entry = entryBySignature.find(Signature(table.first, KeyNames(key), key));
+                        if (entry != entryBySignature.end() && !answered[entry->second])
+                        {
+                            answered[entry->second] = true;
+                            unprocessed.push_back(entries[entry->second]);
+                        }
+                    }
+                }
+
+                //whatever was neither returned nor left unprocessed does not exist.
+                for (size_t i = 0; i < entries.size(); ++i)
+                {
+                    if (!answered[i])
+                    {
+                        Deliver(entries[i], DynamoDBBatchGetter::ItemOutcome(Aws::Map<Aws::String, AttributeValue>()));
+                    }
+                }
+                return SendOutcome(std::move(unprocessed));
+            }
+
+            void Failed(const PendingGet& entry, const AWSError<DynamoDBErrors>& error) override
+            {
+                Deliver(entry, DynamoDBBatchGetter::ItemOutcome(error));
+            }
+
+            bool SendAlone(const PendingGet& entry) const override
+            {
+                //a key without a signature can't be deduplicated or matched to its item, so it gets a request of its own.
+                return entry.signature.empty();
+            }
+
+            bool Coalesce(PendingGet& pending, PendingGet& entry) override
+            {
+                if (pending.signature != entry.signature)
+                {
+                    return false;
+                }
+                pending.handlers.insert(pending.handlers.end(), entry.handlers.begin(), entry.handlers.end());
+                return true;
+            }
+
+        private:
+            static void Deliver(const PendingGet& entry, const DynamoDBBatchGetter::ItemOutcome& outcome)
+            {
+                for (const auto& handler : entry.handlers)
+                {
+                    handler(outcome);
+                }
+            }
+
+            DynamoDBBatchGetter::BatchGetFunction m_batchGet;
+            bool m_consistentRead;
+        };
+
+    } // namespace DynamoDB
+} // namespace Aws
+
+DynamoDBBatchWriter::DynamoDBBatchWriter(const BatchConfiguration& config) :
+    DynamoDBBatchWriter(config, [config](const BatchWriteItemRequest& request) { return config.dynamoDBClient->BatchWriteItem(request); })
+{
+}
+
+DynamoDBBatchWriter::DynamoDBBatchWriter(const BatchConfiguration& config, const BatchWriteFunction& batchWrite) :
+    m_engine(Aws::MakeShared<BatchWriteEngine>(CLASS_TAG, config, batchWrite))
+{
+}
+
+DynamoDBBatchWriter::~DynamoDBBatchWriter()
+{
+    m_engine->Flush();
+}
+
+void DynamoDBBatchWriter::Put(const Aws::String& tableName, const Aws::Map<Aws::String, AttributeValue>& item)
+{
+    m_engine->Add(PendingWrite{tableName, WriteRequest().WithPutRequest(PutRequest().WithItem(item))});
+}
+
+void DynamoDBBatchWriter::Put(const Aws::String& tableName, Aws::Map<Aws::String, AttributeValue>&& item)
+{
+    m_engine->Add(PendingWrite{tableName, WriteRequest().WithPutRequest(PutRequest().WithItem(std::move(item)))});
+}
+
+void DynamoDBBatchWriter::Delete(const Aws::String& tableName, const Aws::Map<Aws::String, AttributeValue>& key)
+{
+    m_engine->Add(PendingWrite{tableName, WriteRequest().WithDeleteRequest(DeleteRequest().WithKey(key))});
+}
+
+BatchOutcome DynamoDBBatchWriter::Flush()
+{
+    return m_engine->Flush();
+}
+
+void DynamoDBBatchWriter::SetWriteFailedHandler(const WriteFailedHandler& handler)
+{
+    m_engine->SetWriteFailedHandler(handler);
+}
+
+size_t DynamoDBBatchWriter::GetBatchCount() const
+{
+    return m_engine->GetBatchCount();
+}
+
+DynamoDBBatchGetter::DynamoDBBatchGetter(const BatchConfiguration& config) :
+    DynamoDBBatchGetter(config, [config](const BatchGetItemRequest& request) { return config.dynamoDBClient->BatchGetItem(request); })
+{
+}
+
+DynamoDBBatchGetter::DynamoDBBatchGetter(const BatchConfiguration& config, const BatchGetFunction& batchGet) :
+    m_engine(Aws::MakeShared<BatchGetEngine>(CLASS_TAG, config, batchGet))
+{
+}
+
+DynamoDBBatchGetter::~DynamoDBBatchGetter()
+{
+    m_engine->Flush();
+}
+
+void DynamoDBBatchGetter::Get(const Aws::String& tableName, const Aws::Map<Aws::String, AttributeValue>& key, const ItemReceivedHandler& handler)
+{
+    PendingGet entry{tableName, key, BatchGetEngine::Signature(tableName, BatchGetEngine::KeyNames(key), key), {handler}};
+    m_engine->Add(std::move(entry));
+}
+
+BatchOutcome DynamoDBBatchGetter::Flush()
+{
+    return m_engine->Flush();
+}
+
+size_t DynamoDBBatchGetter::GetBatchCount() const
+{
+    return m_engine->GetBatchCount();
+}
@@ -22,6 +22,8 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/DNS.h>
@@ -125,6 +127,7 @@ void DynamoDBClient::init(const ClientConfiguration& config)
   {
       OverrideEndpoint(config.endpointOverride);
   }
+  SetWarmUpEndpoint(m_uri);
   if (!config.endpointOverride.empty())
   {
     m_enableEndpointDiscovery = false;
@@ -145,6 +148,7 @@ void DynamoDBClient::OverrideEndpoint(const Aws::String& endpoint)
   {
       m_uri = m_configScheme + "://" + endpoint;
   }
+  SetWarmUpEndpoint(m_uri);
   m_enableEndpointDiscovery = false;
 }
 
@@ -184,6 +188,7 @@ BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& requ
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
+    Aws::Utils::Memory::ArenaScope arenaScope;
     return BatchGetItemOutcome(BatchGetItemResult(outcome.GetResult()));
   }
   else
@@ -202,7 +207,39 @@ BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(const BatchGetI
 
 void DynamoDBClient::BatchGetItemAsync(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->BatchGetItemAsyncHelper( request, handler, context ); } );
+  BatchGetItemAsync(BatchGetItemRequest(request), handler, context);
+}
+
+void DynamoDBClient::BatchGetItemAsync(BatchGetItemRequest&& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<BatchGetItemRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->BatchGetItemAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<BatchGetItemRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        BatchGetItemResult result;
+        {
+          Aws::Utils::Memory::ArenaScope arenaScope;
+          result = outcome.GetResult();
+        }
+        handler(this, *asyncRequest, BatchGetItemOutcome(std::move(result)), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, BatchGetItemOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::BatchGetItemAsyncHelper(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -264,7 +301,34 @@ BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(const Batch
 
 void DynamoDBClient::BatchWriteItemAsync(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->BatchWriteItemAsyncHelper( request, handler, context ); } );
+  BatchWriteItemAsync(BatchWriteItemRequest(request), handler, context);
+}
+
+void DynamoDBClient::BatchWriteItemAsync(BatchWriteItemRequest&& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<BatchWriteItemRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->BatchWriteItemAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<BatchWriteItemRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, BatchWriteItemOutcome(BatchWriteItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, BatchWriteItemOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::BatchWriteItemAsyncHelper(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -326,7 +390,34 @@ CreateBackupOutcomeCallable DynamoDBClient::CreateBackupCallable(const CreateBac
 
 void DynamoDBClient::CreateBackupAsync(const CreateBackupRequest& request, const CreateBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateBackupAsyncHelper( request, handler, context ); } );
+  CreateBackupAsync(CreateBackupRequest(request), handler, context);
+}
+
+void DynamoDBClient::CreateBackupAsync(CreateBackupRequest&& request, const CreateBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<CreateBackupRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->CreateBackupAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<CreateBackupRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, CreateBackupOutcome(CreateBackupResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, CreateBackupOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::CreateBackupAsyncHelper(const CreateBackupRequest& request, const CreateBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -388,7 +479,34 @@ CreateGlobalTableOutcomeCallable DynamoDBClient::CreateGlobalTableCallable(const
 
 void DynamoDBClient::CreateGlobalTableAsync(const CreateGlobalTableRequest& request, const CreateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateGlobalTableAsyncHelper( request, handler, context ); } );
+  CreateGlobalTableAsync(CreateGlobalTableRequest(request), handler, context);
+}
+
+void DynamoDBClient::CreateGlobalTableAsync(CreateGlobalTableRequest&& request, const CreateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<CreateGlobalTableRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->CreateGlobalTableAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<CreateGlobalTableRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, CreateGlobalTableOutcome(CreateGlobalTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, CreateGlobalTableOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::CreateGlobalTableAsyncHelper(const CreateGlobalTableRequest& request, const CreateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -450,7 +568,34 @@ CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(const CreateTable
 
 void DynamoDBClient::CreateTableAsync(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateTableAsyncHelper( request, handler, context ); } );
+  CreateTableAsync(CreateTableRequest(request), handler, context);
+}
+
+void DynamoDBClient::CreateTableAsync(CreateTableRequest&& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<CreateTableRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->CreateTableAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<CreateTableRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, CreateTableOutcome(CreateTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, CreateTableOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::CreateTableAsyncHelper(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -512,7 +657,34 @@ DeleteBackupOutcomeCallable DynamoDBClient::DeleteBackupCallable(const DeleteBac
 
 void DynamoDBClient::DeleteBackupAsync(const DeleteBackupRequest& request, const DeleteBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteBackupAsyncHelper( request, handler, context ); } );
+  DeleteBackupAsync(DeleteBackupRequest(request), handler, context);
+}
+
+void DynamoDBClient::DeleteBackupAsync(DeleteBackupRequest&& request, const DeleteBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DeleteBackupRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DeleteBackupAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DeleteBackupRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DeleteBackupOutcome(DeleteBackupResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DeleteBackupOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DeleteBackupAsyncHelper(const DeleteBackupRequest& request, const DeleteBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -574,7 +746,34 @@ DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(const DeleteItemReq
 
 void DynamoDBClient::DeleteItemAsync(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteItemAsyncHelper( request, handler, context ); } );
+  DeleteItemAsync(DeleteItemRequest(request), handler, context);
+}
+
+void DynamoDBClient::DeleteItemAsync(DeleteItemRequest&& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DeleteItemRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DeleteItemAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DeleteItemRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DeleteItemOutcome(DeleteItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DeleteItemOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DeleteItemAsyncHelper(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -636,7 +835,34 @@ DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(const DeleteTable
 
 void DynamoDBClient::DeleteTableAsync(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteTableAsyncHelper( request, handler, context ); } );
+  DeleteTableAsync(DeleteTableRequest(request), handler, context);
+}
+
+void DynamoDBClient::DeleteTableAsync(DeleteTableRequest&& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DeleteTableRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DeleteTableAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DeleteTableRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DeleteTableOutcome(DeleteTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DeleteTableOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DeleteTableAsyncHelper(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -698,7 +924,34 @@ DescribeBackupOutcomeCallable DynamoDBClient::DescribeBackupCallable(const Descr
 
 void DynamoDBClient::DescribeBackupAsync(const DescribeBackupRequest& request, const DescribeBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeBackupAsyncHelper( request, handler, context ); } );
+  DescribeBackupAsync(DescribeBackupRequest(request), handler, context);
+}
+
+void DynamoDBClient::DescribeBackupAsync(DescribeBackupRequest&& request, const DescribeBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DescribeBackupRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DescribeBackupAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DescribeBackupRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DescribeBackupOutcome(DescribeBackupResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DescribeBackupOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DescribeBackupAsyncHelper(const DescribeBackupRequest& request, const DescribeBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -760,7 +1013,34 @@ DescribeContinuousBackupsOutcomeCallable DynamoDBClient::DescribeContinuousBacku
 
 void DynamoDBClient::DescribeContinuousBackupsAsync(const DescribeContinuousBackupsRequest& request, const DescribeContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeContinuousBackupsAsyncHelper( request, handler, context ); } );
+  DescribeContinuousBackupsAsync(DescribeContinuousBackupsRequest(request), handler, context);
+}
+
+void DynamoDBClient::DescribeContinuousBackupsAsync(DescribeContinuousBackupsRequest&& request, const DescribeContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DescribeContinuousBackupsRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DescribeContinuousBackupsAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DescribeContinuousBackupsRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DescribeContinuousBackupsOutcome(DescribeContinuousBackupsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DescribeContinuousBackupsOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DescribeContinuousBackupsAsyncHelper(const DescribeContinuousBackupsRequest& request, const DescribeContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -795,7 +1075,34 @@ DescribeEndpointsOutcomeCallable DynamoDBClient::DescribeEndpointsCallable(const
 
 void DynamoDBClient::DescribeEndpointsAsync(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeEndpointsAsyncHelper( request, handler, context ); } );
+  DescribeEndpointsAsync(DescribeEndpointsRequest(request), handler, context);
+}
+
+void DynamoDBClient::DescribeEndpointsAsync(DescribeEndpointsRequest&& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests())
+  {
+    auto asyncRequest = Aws::MakeShared<DescribeEndpointsRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DescribeEndpointsAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DescribeEndpointsRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DescribeEndpointsOutcome(DescribeEndpointsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DescribeEndpointsOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DescribeEndpointsAsyncHelper(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -857,7 +1164,34 @@ DescribeGlobalTableOutcomeCallable DynamoDBClient::DescribeGlobalTableCallable(c
 
 void DynamoDBClient::DescribeGlobalTableAsync(const DescribeGlobalTableRequest& request, const DescribeGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableAsyncHelper( request, handler, context ); } );
+  DescribeGlobalTableAsync(DescribeGlobalTableRequest(request), handler, context);
+}
+
+void DynamoDBClient::DescribeGlobalTableAsync(DescribeGlobalTableRequest&& request, const DescribeGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DescribeGlobalTableRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DescribeGlobalTableAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DescribeGlobalTableRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DescribeGlobalTableOutcome(DescribeGlobalTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DescribeGlobalTableOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DescribeGlobalTableAsyncHelper(const DescribeGlobalTableRequest& request, const DescribeGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -919,7 +1253,34 @@ DescribeGlobalTableSettingsOutcomeCallable DynamoDBClient::DescribeGlobalTableSe
 
 void DynamoDBClient::DescribeGlobalTableSettingsAsync(const DescribeGlobalTableSettingsRequest& request, const DescribeGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+  DescribeGlobalTableSettingsAsync(DescribeGlobalTableSettingsRequest(request), handler, context);
+}
+
+void DynamoDBClient::DescribeGlobalTableSettingsAsync(DescribeGlobalTableSettingsRequest&& request, const DescribeGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DescribeGlobalTableSettingsRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DescribeGlobalTableSettingsAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DescribeGlobalTableSettingsRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DescribeGlobalTableSettingsOutcome(DescribeGlobalTableSettingsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DescribeGlobalTableSettingsOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DescribeGlobalTableSettingsAsyncHelper(const DescribeGlobalTableSettingsRequest& request, const DescribeGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -981,7 +1342,34 @@ DescribeLimitsOutcomeCallable DynamoDBClient::DescribeLimitsCallable(const Descr
 
 void DynamoDBClient::DescribeLimitsAsync(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeLimitsAsyncHelper( request, handler, context ); } );
+  DescribeLimitsAsync(DescribeLimitsRequest(request), handler, context);
+}
+
+void DynamoDBClient::DescribeLimitsAsync(DescribeLimitsRequest&& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DescribeLimitsRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DescribeLimitsAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DescribeLimitsRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DescribeLimitsOutcome(DescribeLimitsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DescribeLimitsOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DescribeLimitsAsyncHelper(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1043,7 +1431,34 @@ DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(const Describ
 
 void DynamoDBClient::DescribeTableAsync(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeTableAsyncHelper( request, handler, context ); } );
+  DescribeTableAsync(DescribeTableRequest(request), handler, context);
+}
+
+void DynamoDBClient::DescribeTableAsync(DescribeTableRequest&& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DescribeTableRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DescribeTableAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DescribeTableRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DescribeTableOutcome(DescribeTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DescribeTableOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DescribeTableAsyncHelper(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1105,7 +1520,34 @@ DescribeTimeToLiveOutcomeCallable DynamoDBClient::DescribeTimeToLiveCallable(con
 
 void DynamoDBClient::DescribeTimeToLiveAsync(const DescribeTimeToLiveRequest& request, const DescribeTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeTimeToLiveAsyncHelper( request, handler, context ); } );
+  DescribeTimeToLiveAsync(DescribeTimeToLiveRequest(request), handler, context);
+}
+
+void DynamoDBClient::DescribeTimeToLiveAsync(DescribeTimeToLiveRequest&& request, const DescribeTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<DescribeTimeToLiveRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->DescribeTimeToLiveAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<DescribeTimeToLiveRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DescribeTimeToLiveOutcome(DescribeTimeToLiveResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, DescribeTimeToLiveOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::DescribeTimeToLiveAsyncHelper(const DescribeTimeToLiveRequest& request, const DescribeTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1167,7 +1609,34 @@ GetItemOutcomeCallable DynamoDBClient::GetItemCallable(const GetItemRequest& req
 
 void DynamoDBClient::GetItemAsync(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetItemAsyncHelper( request, handler, context ); } );
+  GetItemAsync(GetItemRequest(request), handler, context);
+}
+
+void DynamoDBClient::GetItemAsync(GetItemRequest&& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<GetItemRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->GetItemAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<GetItemRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, GetItemOutcome(GetItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, GetItemOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::GetItemAsyncHelper(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1229,7 +1698,34 @@ ListBackupsOutcomeCallable DynamoDBClient::ListBackupsCallable(const ListBackups
 
 void DynamoDBClient::ListBackupsAsync(const ListBackupsRequest& request, const ListBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListBackupsAsyncHelper( request, handler, context ); } );
+  ListBackupsAsync(ListBackupsRequest(request), handler, context);
+}
+
+void DynamoDBClient::ListBackupsAsync(ListBackupsRequest&& request, const ListBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<ListBackupsRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->ListBackupsAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<ListBackupsRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, ListBackupsOutcome(ListBackupsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, ListBackupsOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::ListBackupsAsyncHelper(const ListBackupsRequest& request, const ListBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1291,14 +1787,41 @@ ListGlobalTablesOutcomeCallable DynamoDBClient::ListGlobalTablesCallable(const L
 
 void DynamoDBClient::ListGlobalTablesAsync(const ListGlobalTablesRequest& request, const ListGlobalTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListGlobalTablesAsyncHelper( request, handler, context ); } );
+  ListGlobalTablesAsync(ListGlobalTablesRequest(request), handler, context);
 }
 
-void DynamoDBClient::ListGlobalTablesAsyncHelper(const ListGlobalTablesRequest& request, const ListGlobalTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+void DynamoDBClient::ListGlobalTablesAsync(ListGlobalTablesRequest&& request, const ListGlobalTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListGlobalTables(request), context);
-}
-
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<ListGlobalTablesRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->ListGlobalTablesAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<ListGlobalTablesRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, ListGlobalTablesOutcome(ListGlobalTablesResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, ListGlobalTablesOutcome(outcome.GetError()), context);
+      }
+    });
+}
+
+void DynamoDBClient::ListGlobalTablesAsyncHelper(const ListGlobalTablesRequest& request, const ListGlobalTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, ListGlobalTables(request), context);
+}
+
 ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) const
 {
   Aws::Http::URI uri = m_uri;
@@ -1353,7 +1876,34 @@ ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(const ListTablesReq
 
 void DynamoDBClient::ListTablesAsync(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTablesAsyncHelper( request, handler, context ); } );
+  ListTablesAsync(ListTablesRequest(request), handler, context);
+}
+
+void DynamoDBClient::ListTablesAsync(ListTablesRequest&& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<ListTablesRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->ListTablesAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<ListTablesRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, ListTablesOutcome(ListTablesResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, ListTablesOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::ListTablesAsyncHelper(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1415,7 +1965,34 @@ ListTagsOfResourceOutcomeCallable DynamoDBClient::ListTagsOfResourceCallable(con
 
 void DynamoDBClient::ListTagsOfResourceAsync(const ListTagsOfResourceRequest& request, const ListTagsOfResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTagsOfResourceAsyncHelper( request, handler, context ); } );
+  ListTagsOfResourceAsync(ListTagsOfResourceRequest(request), handler, context);
+}
+
+void DynamoDBClient::ListTagsOfResourceAsync(ListTagsOfResourceRequest&& request, const ListTagsOfResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<ListTagsOfResourceRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->ListTagsOfResourceAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<ListTagsOfResourceRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, ListTagsOfResourceOutcome(ListTagsOfResourceResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, ListTagsOfResourceOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::ListTagsOfResourceAsyncHelper(const ListTagsOfResourceRequest& request, const ListTagsOfResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1477,7 +2054,34 @@ PutItemOutcomeCallable DynamoDBClient::PutItemCallable(const PutItemRequest& req
 
 void DynamoDBClient::PutItemAsync(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->PutItemAsyncHelper( request, handler, context ); } );
+  PutItemAsync(PutItemRequest(request), handler, context);
+}
+
+void DynamoDBClient::PutItemAsync(PutItemRequest&& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<PutItemRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->PutItemAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<PutItemRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, PutItemOutcome(PutItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, PutItemOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::PutItemAsyncHelper(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1485,6 +2089,19 @@ void DynamoDBClient::PutItemAsyncHelper(const PutItemRequest& request, const Put
   handler(this, request, PutItem(request), context);
 }
 
+static QueryOutcome DecodeQueryResult(const StreamOutcome& outcome)
+{
+  Aws::Utils::Memory::ArenaScope arenaScope;
+  Aws::Utils::Json::JsonReader jsonReader(outcome.GetResult().GetPayload().GetUnderlyingStream());
+  QueryResult result(outcome.GetResult(), jsonReader);
+  if(!jsonReader.WasParseSuccessful())
+  {
+    AWS_LOGSTREAM_ERROR("Query", "Json parsing failed with message " << jsonReader.GetErrorMessage());
+    return QueryOutcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::UNKNOWN, "Json Parser Error", jsonReader.GetErrorMessage(), false));
+  }
+  return QueryOutcome(std::move(result));
+}
+
 QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
 {
   Aws::Http::URI uri = m_uri;
@@ -1518,10 +2135,10 @@ QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
-    return QueryOutcome(QueryResult(outcome.GetResult()));
+    return DecodeQueryResult(outcome);
   }
   else
   {
@@ -1539,7 +2156,34 @@ QueryOutcomeCallable DynamoDBClient::QueryCallable(const QueryRequest& request)
 
 void DynamoDBClient::QueryAsync(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->QueryAsyncHelper( request, handler, context ); } );
+  QueryAsync(QueryRequest(request), handler, context);
+}
+
+void DynamoDBClient::QueryAsync(QueryRequest&& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<QueryRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->QueryAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<QueryRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestWithUnparsedResponseAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const StreamOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DecodeQueryResult(outcome), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, QueryOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::QueryAsyncHelper(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1601,7 +2245,34 @@ RestoreTableFromBackupOutcomeCallable DynamoDBClient::RestoreTableFromBackupCall
 
 void DynamoDBClient::RestoreTableFromBackupAsync(const RestoreTableFromBackupRequest& request, const RestoreTableFromBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RestoreTableFromBackupAsyncHelper( request, handler, context ); } );
+  RestoreTableFromBackupAsync(RestoreTableFromBackupRequest(request), handler, context);
+}
+
+void DynamoDBClient::RestoreTableFromBackupAsync(RestoreTableFromBackupRequest&& request, const RestoreTableFromBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<RestoreTableFromBackupRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->RestoreTableFromBackupAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<RestoreTableFromBackupRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, RestoreTableFromBackupOutcome(RestoreTableFromBackupResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, RestoreTableFromBackupOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::RestoreTableFromBackupAsyncHelper(const RestoreTableFromBackupRequest& request, const RestoreTableFromBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1663,7 +2334,34 @@ RestoreTableToPointInTimeOutcomeCallable DynamoDBClient::RestoreTableToPointInTi
 
 void DynamoDBClient::RestoreTableToPointInTimeAsync(const RestoreTableToPointInTimeRequest& request, const RestoreTableToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RestoreTableToPointInTimeAsyncHelper( request, handler, context ); } );
+  RestoreTableToPointInTimeAsync(RestoreTableToPointInTimeRequest(request), handler, context);
+}
+
+void DynamoDBClient::RestoreTableToPointInTimeAsync(RestoreTableToPointInTimeRequest&& request, const RestoreTableToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<RestoreTableToPointInTimeRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->RestoreTableToPointInTimeAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<RestoreTableToPointInTimeRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, RestoreTableToPointInTimeOutcome(RestoreTableToPointInTimeResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, RestoreTableToPointInTimeOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::RestoreTableToPointInTimeAsyncHelper(const RestoreTableToPointInTimeRequest& request, const RestoreTableToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1671,6 +2369,19 @@ void DynamoDBClient::RestoreTableToPointInTimeAsyncHelper(const RestoreTableToPo
   handler(this, request, RestoreTableToPointInTime(request), context);
 }
 
+static ScanOutcome DecodeScanResult(const StreamOutcome& outcome)
+{
+  Aws::Utils::Memory::ArenaScope arenaScope;
+  Aws::Utils::Json::JsonReader jsonReader(outcome.GetResult().GetPayload().GetUnderlyingStream());
+  ScanResult result(outcome.GetResult(), jsonReader);
+  if(!jsonReader.WasParseSuccessful())
+  {
+    AWS_LOGSTREAM_ERROR("Scan", "Json parsing failed with message " << jsonReader.GetErrorMessage());
+    return ScanOutcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::UNKNOWN, "Json Parser Error", jsonReader.GetErrorMessage(), false));
+  }
+  return ScanOutcome(std::move(result));
+}
+
 ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
 {
   Aws::Http::URI uri = m_uri;
@@ -1704,10 +2415,10 @@ ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
-    return ScanOutcome(ScanResult(outcome.GetResult()));
+    return DecodeScanResult(outcome);
   }
   else
   {
@@ -1725,7 +2436,34 @@ ScanOutcomeCallable DynamoDBClient::ScanCallable(const ScanRequest& request) con
 
 void DynamoDBClient::ScanAsync(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ScanAsyncHelper( request, handler, context ); } );
+  ScanAsync(ScanRequest(request), handler, context);
+}
+
+void DynamoDBClient::ScanAsync(ScanRequest&& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<ScanRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->ScanAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<ScanRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestWithUnparsedResponseAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const StreamOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, DecodeScanResult(outcome), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, ScanOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::ScanAsyncHelper(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1787,7 +2525,34 @@ TagResourceOutcomeCallable DynamoDBClient::TagResourceCallable(const TagResource
 
 void DynamoDBClient::TagResourceAsync(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TagResourceAsyncHelper( request, handler, context ); } );
+  TagResourceAsync(TagResourceRequest(request), handler, context);
+}
+
+void DynamoDBClient::TagResourceAsync(TagResourceRequest&& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<TagResourceRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->TagResourceAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<TagResourceRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, TagResourceOutcome(NoResult()), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, TagResourceOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::TagResourceAsyncHelper(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1849,7 +2614,34 @@ TransactGetItemsOutcomeCallable DynamoDBClient::TransactGetItemsCallable(const T
 
 void DynamoDBClient::TransactGetItemsAsync(const TransactGetItemsRequest& request, const TransactGetItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TransactGetItemsAsyncHelper( request, handler, context ); } );
+  TransactGetItemsAsync(TransactGetItemsRequest(request), handler, context);
+}
+
+void DynamoDBClient::TransactGetItemsAsync(TransactGetItemsRequest&& request, const TransactGetItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<TransactGetItemsRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->TransactGetItemsAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<TransactGetItemsRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, TransactGetItemsOutcome(TransactGetItemsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, TransactGetItemsOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::TransactGetItemsAsyncHelper(const TransactGetItemsRequest& request, const TransactGetItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1911,7 +2703,34 @@ TransactWriteItemsOutcomeCallable DynamoDBClient::TransactWriteItemsCallable(con
 
 void DynamoDBClient::TransactWriteItemsAsync(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TransactWriteItemsAsyncHelper( request, handler, context ); } );
+  TransactWriteItemsAsync(TransactWriteItemsRequest(request), handler, context);
+}
+
+void DynamoDBClient::TransactWriteItemsAsync(TransactWriteItemsRequest&& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<TransactWriteItemsRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->TransactWriteItemsAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<TransactWriteItemsRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, TransactWriteItemsOutcome(TransactWriteItemsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, TransactWriteItemsOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::TransactWriteItemsAsyncHelper(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1973,7 +2792,34 @@ UntagResourceOutcomeCallable DynamoDBClient::UntagResourceCallable(const UntagRe
 
 void DynamoDBClient::UntagResourceAsync(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UntagResourceAsyncHelper( request, handler, context ); } );
+  UntagResourceAsync(UntagResourceRequest(request), handler, context);
+}
+
+void DynamoDBClient::UntagResourceAsync(UntagResourceRequest&& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<UntagResourceRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->UntagResourceAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<UntagResourceRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, UntagResourceOutcome(NoResult()), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, UntagResourceOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::UntagResourceAsyncHelper(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2035,7 +2881,34 @@ UpdateContinuousBackupsOutcomeCallable DynamoDBClient::UpdateContinuousBackupsCa
 
 void DynamoDBClient::UpdateContinuousBackupsAsync(const UpdateContinuousBackupsRequest& request, const UpdateContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateContinuousBackupsAsyncHelper( request, handler, context ); } );
+  UpdateContinuousBackupsAsync(UpdateContinuousBackupsRequest(request), handler, context);
+}
+
+void DynamoDBClient::UpdateContinuousBackupsAsync(UpdateContinuousBackupsRequest&& request, const UpdateContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<UpdateContinuousBackupsRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->UpdateContinuousBackupsAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<UpdateContinuousBackupsRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, UpdateContinuousBackupsOutcome(UpdateContinuousBackupsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, UpdateContinuousBackupsOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::UpdateContinuousBackupsAsyncHelper(const UpdateContinuousBackupsRequest& request, const UpdateContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2097,7 +2970,34 @@ UpdateGlobalTableOutcomeCallable DynamoDBClient::UpdateGlobalTableCallable(const
 
 void DynamoDBClient::UpdateGlobalTableAsync(const UpdateGlobalTableRequest& request, const UpdateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableAsyncHelper( request, handler, context ); } );
+  UpdateGlobalTableAsync(UpdateGlobalTableRequest(request), handler, context);
+}
+
+void DynamoDBClient::UpdateGlobalTableAsync(UpdateGlobalTableRequest&& request, const UpdateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<UpdateGlobalTableRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->UpdateGlobalTableAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<UpdateGlobalTableRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, UpdateGlobalTableOutcome(UpdateGlobalTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, UpdateGlobalTableOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::UpdateGlobalTableAsyncHelper(const UpdateGlobalTableRequest& request, const UpdateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2159,7 +3059,34 @@ UpdateGlobalTableSettingsOutcomeCallable DynamoDBClient::UpdateGlobalTableSettin
 
 void DynamoDBClient::UpdateGlobalTableSettingsAsync(const UpdateGlobalTableSettingsRequest& request, const UpdateGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+  UpdateGlobalTableSettingsAsync(UpdateGlobalTableSettingsRequest(request), handler, context);
+}
+
+void DynamoDBClient::UpdateGlobalTableSettingsAsync(UpdateGlobalTableSettingsRequest&& request, const UpdateGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<UpdateGlobalTableSettingsRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->UpdateGlobalTableSettingsAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<UpdateGlobalTableSettingsRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, UpdateGlobalTableSettingsOutcome(UpdateGlobalTableSettingsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, UpdateGlobalTableSettingsOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::UpdateGlobalTableSettingsAsyncHelper(const UpdateGlobalTableSettingsRequest& request, const UpdateGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2221,7 +3148,34 @@ UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(const UpdateItemReq
 
 void DynamoDBClient::UpdateItemAsync(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateItemAsyncHelper( request, handler, context ); } );
+  UpdateItemAsync(UpdateItemRequest(request), handler, context);
+}
+
+void DynamoDBClient::UpdateItemAsync(UpdateItemRequest&& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<UpdateItemRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->UpdateItemAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<UpdateItemRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, UpdateItemOutcome(UpdateItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, UpdateItemOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::UpdateItemAsyncHelper(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2283,7 +3237,34 @@ UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(const UpdateTable
 
 void DynamoDBClient::UpdateTableAsync(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateTableAsyncHelper( request, handler, context ); } );
+  UpdateTableAsync(UpdateTableRequest(request), handler, context);
+}
+
+void DynamoDBClient::UpdateTableAsync(UpdateTableRequest&& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<UpdateTableRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->UpdateTableAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<UpdateTableRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, UpdateTableOutcome(UpdateTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, UpdateTableOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::UpdateTableAsyncHelper(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2345,7 +3326,34 @@ UpdateTimeToLiveOutcomeCallable DynamoDBClient::UpdateTimeToLiveCallable(const U
 
 void DynamoDBClient::UpdateTimeToLiveAsync(const UpdateTimeToLiveRequest& request, const UpdateTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateTimeToLiveAsyncHelper( request, handler, context ); } );
+  UpdateTimeToLiveAsync(UpdateTimeToLiveRequest(request), handler, context);
+}
+
+void DynamoDBClient::UpdateTimeToLiveAsync(UpdateTimeToLiveRequest&& request, const UpdateTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!HttpClientSupportsAsyncRequests() || m_enableEndpointDiscovery)
+  {
+    auto asyncRequest = Aws::MakeShared<UpdateTimeToLiveRequest>(ALLOCATION_TAG, std::move(request));
+    m_executor->Submit( [this, asyncRequest, handler, context](){ this->UpdateTimeToLiveAsyncHelper( *asyncRequest, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto asyncRequest = Aws::MakeShared<UpdateTimeToLiveRequest>(ALLOCATION_TAG, std::move(request));
+  MakeRequestAsync(uri, asyncRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, m_executor,
+    [this, asyncRequest, handler, context](const JsonOutcome& outcome)
+    {
+      if(outcome.IsSuccess())
+      {
+        handler(this, *asyncRequest, UpdateTimeToLiveOutcome(UpdateTimeToLiveResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *asyncRequest, UpdateTimeToLiveOutcome(outcome.GetError()), context);
+      }
+    });
 }
 
 void DynamoDBClient::UpdateTimeToLiveAsyncHelper(const UpdateTimeToLiveRequest& request, const UpdateTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
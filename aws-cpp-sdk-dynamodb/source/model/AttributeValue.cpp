@@ -14,163 +14,371 @@
 */
 
 #include <aws/dynamodb/model/AttributeValue.h>
-#include <aws/dynamodb/model/AttributeValueValue.h>
+#include <aws/core/utils/HashingUtils.h>
 
+#include <cassert>
+#include <new>
 #include <utility>
 
 using namespace Aws::DynamoDB::Model;
 using namespace Aws::Utils;
 using namespace Aws::Utils::Json;
 
-const Aws::String AttributeValue::GetS() const
+namespace
 {
-    if (m_value)
+    //what the getters hand out for a value of another type; none of these allocate.
+    const Aws::String EMPTY_STRING;
+    const ByteBuffer EMPTY_BYTE_BUFFER;
+    const Aws::Vector<Aws::String> EMPTY_STRING_SET;
+    const Aws::Vector<ByteBuffer> EMPTY_BYTE_BUFFER_SET;
+    const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> EMPTY_MAP;
+    const Aws::Vector<std::shared_ptr<AttributeValue>> EMPTY_LIST;
+
+    template<typename T>
+    void DestroyMember(T& member)
+    {
+        member.~T();
+    }
+}
+
+AttributeValue::AttributeValue(const AttributeValue& other) :
+    AttributeValue()
+{
+    if (!other.m_hasValue)
+    {
+        return;
+    }
+
+    Specialize(other.m_type);
+    switch (m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            m_s = other.m_s;
+            break;
+        case ValueType::BYTEBUFFER:
+            m_b = other.m_b;
+            break;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            m_stringSet = other.m_stringSet;
+            break;
+        case ValueType::BYTEBUFFER_SET:
+            m_bS = other.m_bS;
+            break;
+        case ValueType::ATTRIBUTE_MAP:
+            m_m = other.m_m;
+            break;
+        case ValueType::ATTRIBUTE_LIST:
+            m_l = other.m_l;
+            break;
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            m_bool = other.m_bool;
+            break;
+    }
+}
+
+AttributeValue::AttributeValue(AttributeValue&& other) :
+    AttributeValue()
+{
+    MoveFrom(std::move(other));
+}
+
+AttributeValue::~AttributeValue()
+{
+    Destroy();
+}
+
+AttributeValue& AttributeValue::operator =(const AttributeValue& other)
+{
+    //other may live inside this value's own list or map, so copy it out before destroying anything.
+    AttributeValue copy(other);
+    Destroy();
+    MoveFrom(std::move(copy));
+    return *this;
+}
+
+AttributeValue& AttributeValue::operator =(AttributeValue&& other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    //same as the copy: other may be owned by this value, so take its contents before destroying ours.
+    AttributeValue moved(std::move(other));
+    Destroy();
+    MoveFrom(std::move(moved));
+    return *this;
+}
+
+void AttributeValue::MoveFrom(AttributeValue&& other)
+{
+    assert(!m_hasValue);
+    if (!other.m_hasValue)
+    {
+        return;
+    }
+
+    Specialize(other.m_type);
+    switch (m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            m_s = std::move(other.m_s);
+            break;
+        case ValueType::BYTEBUFFER:
+            m_b = std::move(other.m_b);
+            break;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            m_stringSet = std::move(other.m_stringSet);
+            break;
+        case ValueType::BYTEBUFFER_SET:
+            m_bS = std::move(other.m_bS);
+            break;
+        case ValueType::ATTRIBUTE_MAP:
+            m_m = std::move(other.m_m);
+            break;
+        case ValueType::ATTRIBUTE_LIST:
+            m_l = std::move(other.m_l);
+            break;
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            m_bool = other.m_bool;
+            break;
+    }
+}
+
+void AttributeValue::Specialize(ValueType type)
+{
+    Destroy();
+
+    switch (type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            new (&m_s) Aws::String();
+            break;
+        case ValueType::BYTEBUFFER:
+            new (&m_b) ByteBuffer();
+            break;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            new (&m_stringSet) Aws::Vector<Aws::String>();
+            break;
+        case ValueType::BYTEBUFFER_SET:
+            new (&m_bS) Aws::Vector<ByteBuffer>();
+            break;
+        case ValueType::ATTRIBUTE_MAP:
+            new (&m_m) AttributeMap();
+            break;
+        case ValueType::ATTRIBUTE_LIST:
+            new (&m_l) AttributeList();
+            break;
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            m_bool = false;
+            break;
+    }
+
+    m_type = type;
+    m_hasValue = true;
+}
+
+void AttributeValue::Destroy()
+{
+    if (!m_hasValue)
+    {
+        return;
+    }
+
+    switch (m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            DestroyMember(m_s);
+            break;
+        case ValueType::BYTEBUFFER:
+            DestroyMember(m_b);
+            break;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            DestroyMember(m_stringSet);
+            break;
+        case ValueType::BYTEBUFFER_SET:
+            DestroyMember(m_bS);
+            break;
+        case ValueType::ATTRIBUTE_MAP:
+            DestroyMember(m_m);
+            break;
+        case ValueType::ATTRIBUTE_LIST:
+            DestroyMember(m_l);
+            break;
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            break;
+    }
+
+    m_hasValue = false;
+}
+
+const Aws::String& AttributeValue::GetS() const
+{
+    if (m_hasValue && m_type == ValueType::STRING)
     {
-        return m_value->GetS();
+        return m_s;
     }
     else
     {
-        return {};
+        return EMPTY_STRING;
     }
 }
 
 AttributeValue& AttributeValue::SetS(const Aws::String& s)
 {
-    m_value = Aws::MakeShared<AttributeValueString>("AttributeValue", s);
+    Specialize(ValueType::STRING);
+    m_s = s;
     return *this;
 }
 
-const Aws::String AttributeValue::GetN() const
+const Aws::String& AttributeValue::GetN() const
 {
-    if (m_value)
+    if (m_hasValue && m_type == ValueType::NUMBER)
     {
-        return m_value->GetN();
+        return m_s;
     }
     else
     {
-        return {};
+        return EMPTY_STRING;
     }
 }
 
 AttributeValue& AttributeValue::SetN(const Aws::String& n)
 {
-    m_value = Aws::MakeShared<AttributeValueNumeric>("AttributeValue", n);
+    Specialize(ValueType::NUMBER);
+    m_s = n;
     return *this;
 }
 
-const ByteBuffer AttributeValue::GetB() const
+const ByteBuffer& AttributeValue::GetB() const
 {
-    if (m_value)
+    if (m_hasValue && m_type == ValueType::BYTEBUFFER)
     {
-        return m_value->GetB();
+        return m_b;
     }
     else
     {
-        return {};
+        return EMPTY_BYTE_BUFFER;
     }
 }
 
 AttributeValue& AttributeValue::SetB(const ByteBuffer& b)
 {
-    m_value = Aws::MakeShared<AttributeValueByteBuffer>("AttributeValue", b);
+    Specialize(ValueType::BYTEBUFFER);
+    m_b = b;
     return *this;
 }
 
-const Aws::Vector<Aws::String> AttributeValue::GetSS() const
+const Aws::Vector<Aws::String>& AttributeValue::GetSS() const
 {
-    if (m_value)
+    if (m_hasValue && m_type == ValueType::STRING_SET)
     {
-        return m_value->GetSS();
+        return m_stringSet;
     }
     else
     {
-        return {};
+        return EMPTY_STRING_SET;
     }
 }
 
 AttributeValue& AttributeValue::SetSS(const Aws::Vector<Aws::String>& ss)
 {
-    m_value = Aws::MakeShared<AttributeValueStringSet>("AttributeValue", ss);
+    Specialize(ValueType::STRING_SET);
+    m_stringSet = ss;
     return *this;
 }
 
 AttributeValue& AttributeValue::AddSItem(const Aws::String& sItem)
 {
-    if (!m_value)
+    if (!m_hasValue)
     {
-        Aws::Vector<Aws::String> ss;
-        ss.push_back(sItem);
-        m_value = Aws::MakeShared<AttributeValueStringSet>("AttributeValue", ss);
+        Specialize(ValueType::STRING_SET);
     }
-    else
+
+    assert(m_type == ValueType::STRING_SET);
+    if (m_type == ValueType::STRING_SET)
     {
-        m_value->AddSItem(sItem);
+        m_stringSet.push_back(sItem);
     }
     return *this;
 }
 
-const Aws::Vector<Aws::String> AttributeValue::GetNS() const
+const Aws::Vector<Aws::String>& AttributeValue::GetNS() const
 {
-    if (m_value)
+    if (m_hasValue && m_type == ValueType::NUMBER_SET)
     {
-        return m_value->GetNS();
+        return m_stringSet;
     }
     else
     {
-        return {};
+        return EMPTY_STRING_SET;
     }
 }
 
 AttributeValue& AttributeValue::SetNS(const Aws::Vector<Aws::String>& ns)
 {
-    m_value = Aws::MakeShared<AttributeValueNumberSet>("AttributeValue", ns);
+    Specialize(ValueType::NUMBER_SET);
+    m_stringSet = ns;
     return *this;
 }
 
 AttributeValue& AttributeValue::AddNItem(const Aws::String& nItem)
 {
-    if (!m_value)
+    if (!m_hasValue)
     {
-        Aws::Vector<Aws::String> ns;
-        ns.push_back(nItem);
-        m_value = Aws::MakeShared<AttributeValueNumberSet>("AttributeValue", ns);
+        Specialize(ValueType::NUMBER_SET);
     }
-    else
+
+    assert(m_type == ValueType::NUMBER_SET);
+    if (m_type == ValueType::NUMBER_SET)
     {
-        m_value->AddNItem(nItem);
+        m_stringSet.push_back(nItem);
     }
     return *this;
 }
 
-const Aws::Vector<ByteBuffer> AttributeValue::GetBS() const
+const Aws::Vector<ByteBuffer>& AttributeValue::GetBS() const
 {
-    if (m_value)
+    if (m_hasValue && m_type == ValueType::BYTEBUFFER_SET)
     {
-        return m_value->GetBS();
+        return m_bS;
     }
     else
     {
-        return {};
+        return EMPTY_BYTE_BUFFER_SET;
     }
 }
 
 AttributeValue& AttributeValue::SetBS(const Aws::Vector<ByteBuffer>& bs)
 {
-    m_value = Aws::MakeShared<AttributeValueByteBufferSet>("AttributeValue", bs);
+    Specialize(ValueType::BYTEBUFFER_SET);
+    m_bS = bs;
     return *this;
 }
 
 AttributeValue& AttributeValue::AddBItem(const ByteBuffer& bItem)
 {
-    if (!m_value)
+    if (!m_hasValue)
     {
-        Aws::Vector<ByteBuffer> bs;
-        bs.push_back(bItem);
-        m_value = Aws::MakeShared<AttributeValueByteBufferSet>("AttributeValue", bs);
+        Specialize(ValueType::BYTEBUFFER_SET);
     }
-    else
+
+    assert(m_type == ValueType::BYTEBUFFER_SET);
+    if (m_type == ValueType::BYTEBUFFER_SET)
     {
-        m_value->AddBItem(bItem);
+        m_bS.push_back(bItem);
     }
     return *this;
 }
@@ -180,108 +388,95 @@ AttributeValue& AttributeValue::AddBItem(const unsigned char* bItem, size_t size
     return AddBItem(ByteBuffer(bItem, size));
 }
 
-const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> AttributeValue::GetM() const
+const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>& AttributeValue::GetM() const
 {
-    if (m_value)
+    if (m_hasValue && m_type == ValueType::ATTRIBUTE_MAP)
     {
-        return m_value->GetM();
+        return m_m;
     }
     else
     {
-        return {};
+        return EMPTY_MAP;
     }
 }
 
 AttributeValue& AttributeValue::SetM(const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>& map)
 {
-    m_value = Aws::MakeShared<AttributeValueMap>("AttributeValue", map);
+    Specialize(ValueType::ATTRIBUTE_MAP);
+    m_m = map;
     return *this;
 }
 
 AttributeValue& AttributeValue::AddMEntry(const Aws::String& key, const std::shared_ptr<AttributeValue>& value)
 {
-    if (!m_value)
+    if (!m_hasValue)
     {
-        Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> map;
-        auto kvp = std::pair<Aws::String, const std::shared_ptr<AttributeValue>>(key, value);
-        map.insert(map.begin(), kvp);
-        m_value = Aws::MakeShared<AttributeValueMap>("AttributeValue", map);
+        Specialize(ValueType::ATTRIBUTE_MAP);
     }
-    else
+
+    assert(m_type == ValueType::ATTRIBUTE_MAP);
+    if (m_type == ValueType::ATTRIBUTE_MAP)
     {
-        m_value->AddMEntry(key, value);
+        m_m.insert(m_m.begin(), std::pair<Aws::String, const std::shared_ptr<AttributeValue>>(key, value));
     }
-
     return *this;
 }
 
-const Aws::Vector<std::shared_ptr<AttributeValue>> AttributeValue::GetL() const
+const Aws::Vector<std::shared_ptr<AttributeValue>>& AttributeValue::GetL() const
 {
-    if (m_value)
+    if (m_hasValue && m_type == ValueType::ATTRIBUTE_LIST)
     {
-        return m_value->GetL();
+        return m_l;
     }
     else
     {
-        return {};
+        return EMPTY_LIST;
     }
 }
 
 AttributeValue& AttributeValue::SetL(const Aws::Vector<std::shared_ptr<AttributeValue>>& list)
 {
-    m_value = Aws::MakeShared<AttributeValueList>("AttributeValue", list);
+    Specialize(ValueType::ATTRIBUTE_LIST);
+    m_l = list;
     return *this;
 }
 
 AttributeValue& AttributeValue::AddLItem(const std::shared_ptr<AttributeValue>& listItem)
 {
-    if (!m_value)
+    if (!m_hasValue)
     {
-        Aws::Vector<std::shared_ptr<AttributeValue>> list;
-        list.push_back(listItem);
-        m_value = Aws::MakeShared<AttributeValueList>("AttributeValue", list);
+        Specialize(ValueType::ATTRIBUTE_LIST);
     }
-    else
+
+    assert(m_type == ValueType::ATTRIBUTE_LIST);
+    if (m_type == ValueType::ATTRIBUTE_LIST)
     {
-        m_value->AddLItem(listItem);
+        m_l.push_back(listItem);
     }
-
     return *this;
 }
 
 bool AttributeValue::GetBool() const
 {
-    if (m_value)
-    {
-        return m_value->GetBool();
-    }
-    else
-    {
-        return false;
-    }
+    return m_hasValue && m_type == ValueType::BOOL && m_bool;
 }
 
 AttributeValue& AttributeValue::SetBool(bool value)
 {
-    m_value = Aws::MakeShared<AttributeValueBool>("AttributeValue", value);
+    Specialize(ValueType::BOOL);
+    m_bool = value;
     return *this;
 }
 
 bool AttributeValue::GetNull() const
 {
-    if (m_value)
-    {
-        return m_value->GetNull();
-    }
-    else
-    {
-        return false;
-    }
+    return m_hasValue && m_type == ValueType::NULLVALUE && m_bool;
 }
 
 AttributeValue& AttributeValue::SetNull(bool value)
 {
-    m_value = Aws::MakeShared<AttributeValueNull>("AttributeValue", value);
+    Specialize(ValueType::NULLVALUE);
+    m_bool = value;
     return *this;
 }
 
@@ -289,101 +484,421 @@ AttributeValue& AttributeValue::operator =(JsonView jsonValue)
 {
     if (jsonValue.ValueExists("S"))
     {
-        m_value = Aws::MakeShared<AttributeValueString>("AttributeValue", jsonValue);
-        return *this;
+        return SetS(jsonValue.GetString("S"));
     }
 
     if (jsonValue.ValueExists("N"))
     {
-        m_value = Aws::MakeShared<AttributeValueNumeric>("AttributeValue", jsonValue);
-        return *this;
+        return SetN(jsonValue.GetString("N"));
     }
 
     if (jsonValue.ValueExists("B"))
     {
-        m_value = Aws::MakeShared<AttributeValueByteBuffer>("AttributeValue", jsonValue);
-        return *this;
-    }
-
-    if (jsonValue.ValueExists("SS"))
-    {
-        m_value = Aws::MakeShared<AttributeValueStringSet>("AttributeValue", jsonValue);
+        Specialize(ValueType::BYTEBUFFER);
+        m_b = HashingUtils::Base64Decode(jsonValue.GetString("B"));
         return *this;
     }
 
-    if (jsonValue.ValueExists("NS"))
+    if (jsonValue.ValueExists("SS") || jsonValue.ValueExists("NS"))
     {
-        m_value = Aws::MakeShared<AttributeValueNumberSet>("AttributeValue", jsonValue);
+        bool isStringSet = jsonValue.ValueExists("SS");
+        Specialize(isStringSet ? ValueType::STRING_SET : ValueType::NUMBER_SET);
+        const Array<JsonView> array = jsonValue.GetArray(isStringSet ? "SS" : "NS");
+        m_stringSet.reserve(array.GetLength());
+        for (unsigned i = 0; i < array.GetLength(); ++i)
+        {
+            m_stringSet.push_back(array[i].AsString());
+        }
         return *this;
     }
 
     if (jsonValue.ValueExists("BS"))
     {
-        m_value = Aws::MakeShared<AttributeValueByteBufferSet>("AttributeValue", jsonValue);
+        Specialize(ValueType::BYTEBUFFER_SET);
+        const Array<JsonView> array = jsonValue.GetArray("BS");
+        m_bS.reserve(array.GetLength());
+        for (unsigned i = 0; i < array.GetLength(); ++i)
+        {
+            m_bS.push_back(HashingUtils::Base64Decode(array[i].AsString()));
+        }
         return *this;
     }
 
     if (jsonValue.ValueExists("M"))
     {
-        m_value = Aws::MakeShared<AttributeValueMap>("AttributeValue", jsonValue);
+        Specialize(ValueType::ATTRIBUTE_MAP);
+        const Aws::Map<Aws::String, JsonView> map = jsonValue.GetObject("M").GetAllObjects();
+        for (auto& item : map)
+        {
+            m_m.emplace(item.first, Aws::MakeShared<AttributeValue>("AttributeValue", item.second));
+        }
         return *this;
     }
 
     if (jsonValue.ValueExists("L"))
     {
-        m_value = Aws::MakeShared<AttributeValueList>("AttributeValue", jsonValue);
+        Specialize(ValueType::ATTRIBUTE_LIST);
+        const Array<JsonView> array = jsonValue.GetArray("L");
+        m_l.reserve(array.GetLength());
+        for (unsigned i = 0; i < array.GetLength(); ++i)
+        {
+            m_l.push_back(Aws::MakeShared<AttributeValue>("AttributeValue", array[i]));
+        }
         return *this;
     }
 
     if (jsonValue.ValueExists("BOOL"))
     {
-        m_value = Aws::MakeShared<AttributeValueBool>("AttributeValue", jsonValue);
-        return *this;
+        return SetBool(jsonValue.GetBool("BOOL"));
     }
 
     if (jsonValue.ValueExists("NULL"))
     {
-        m_value = Aws::MakeShared<AttributeValueNull>("AttributeValue", jsonValue);
-        return *this;
+        return SetNull(jsonValue.GetBool("NULL"));
     }
 
     return *this;
 }
 
-bool AttributeValue::operator ==(const AttributeValue& other) const
+AttributeValue& AttributeValue::operator =(JsonReader& jsonReader)
 {
-    if (this == &other)
-        return true;
+    Aws::String type;
+    if (!jsonReader.BeginObject())
+    {
+        return *this;
+    }
 
-    if (m_value)
+    //each value is read straight into the storage of its type.
+    while (jsonReader.NextMember(type))
     {
-        if (other.m_value)
+        if (type == "S")
+        {
+            Specialize(ValueType::STRING);
+            m_s = jsonReader.ReadString();
+        }
+        else if (type == "N")
         {
-            return *m_value == *other.m_value;
+            Specialize(ValueType::NUMBER);
+            m_s = jsonReader.ReadString();
+        }
+        else if (type == "B")
+        {
+            Specialize(ValueType::BYTEBUFFER);
+            m_b = HashingUtils::Base64Decode(jsonReader.ReadString());
+        }
+        else if (type == "SS" || type == "NS")
+        {
+            Specialize(type == "SS" ? ValueType::STRING_SET : ValueType::NUMBER_SET);
+            if (jsonReader.BeginArray())
+            {
+                while (jsonReader.NextElement())
+                {
+                    m_stringSet.push_back(jsonReader.ReadString());
+                }
+            }
+        }
+        else if (type == "BS")
+        {
+            Specialize(ValueType::BYTEBUFFER_SET);
+            if (jsonReader.BeginArray())
+            {
+                while (jsonReader.NextElement())
+                {
+                    m_bS.push_back(HashingUtils::Base64Decode(jsonReader.ReadString()));
+                }
+            }
+        }
+        else if (type == "M")
+        {
+            Specialize(ValueType::ATTRIBUTE_MAP);
+            if (jsonReader.BeginObject())
+            {
+                Aws::String key;
+                while (jsonReader.NextMember(key))
+                {
+                    m_m.emplace(key, Aws::MakeShared<AttributeValue>("AttributeValue", jsonReader));
+                }
+            }
+        }
+        else if (type == "L")
+        {
+            Specialize(ValueType::ATTRIBUTE_LIST);
+            if (jsonReader.BeginArray())
+            {
+                while (jsonReader.NextElement())
+                {
+                    m_l.push_back(Aws::MakeShared<AttributeValue>("AttributeValue", jsonReader));
+                }
+            }
+        }
+        else if (type == "BOOL")
+        {
+            SetBool(jsonReader.ReadBool());
+        }
+        else if (type == "NULL")
+        {
+            SetNull(jsonReader.ReadBool());
         }
         else
         {
-            return m_value->IsDefault();
+            jsonReader.SkipValue();
         }
     }
-    else if (other.m_value)
+
+    return *this;
+}
+
+bool AttributeValue::IsDefault() const
+{
+    if (!m_hasValue)
+    {
+        return true;
+    }
+
+    switch (m_type)
     {
-        return other.m_value->IsDefault();
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            return m_s.empty();
+        case ValueType::BYTEBUFFER:
+            return m_b.GetLength() == 0;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            return m_stringSet.empty();
+        case ValueType::BYTEBUFFER_SET:
+            return m_bS.empty();
+        case ValueType::ATTRIBUTE_MAP:
+            return m_m.empty();
+        case ValueType::ATTRIBUTE_LIST:
+            return m_l.empty();
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            return !m_bool;
     }
 
     return true;
 }
 
-JsonValue AttributeValue::Jsonize() const
+bool AttributeValue::operator ==(const AttributeValue& other) const
 {
-    if (m_value)
+    if (this == &other)
+        return true;
+
+    if (!m_hasValue || !other.m_hasValue)
     {
-        return m_value->Jsonize();
+        return IsDefault() && other.IsDefault();
     }
-    else
+
+    if (m_type != other.m_type)
+    {
+        return false;
+    }
+
+    switch (m_type)
     {
-        return JsonValue();
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            return m_s == other.m_s;
+        case ValueType::BYTEBUFFER:
+            return m_b == other.m_b;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            return m_stringSet == other.m_stringSet;
+        case ValueType::BYTEBUFFER_SET:
+            return m_bS == other.m_bS;
+        case ValueType::ATTRIBUTE_MAP:
+        {
+            if (m_m.size() != other.m_m.size())
+                return false;
+
+            for (auto& mapItem : m_m)
+            {
+                auto foundItem = other.m_m.find(mapItem.first);
+                if (foundItem == other.m_m.end())
+                    return false;
+
+                if (*foundItem->second != *mapItem.second)
+                    return false;
+            }
+            return true;
+        }
+        case ValueType::ATTRIBUTE_LIST:
+        {
+            if (m_l.size() != other.m_l.size())
+                return false;
+
+            for (unsigned i = 0; i < m_l.size(); ++i)
+            {
+                if (*m_l[i] != *other.m_l[i])
+                    return false;
+            }
+            return true;
+        }
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            return m_bool == other.m_bool;
     }
+
+    return false;
+}
+
+JsonValue AttributeValue::Jsonize() const
+{
+    JsonValue value;
+    if (!m_hasValue)
+    {
+        return value;
+    }
+
+    switch (m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            if (!m_s.empty())
+            {
+                value.WithString(m_type == ValueType::STRING ? "S" : "N", m_s);
+            }
+            break;
+        case ValueType::BYTEBUFFER:
+            if (m_b.GetLength() > 0)
+            {
+                value.WithString("B", HashingUtils::Base64Encode(m_b));
+            }
+            break;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            if (m_stringSet.size() > 0)
+            {
+                Array<JsonValue> array(m_stringSet.size());
+                for (unsigned i = 0; i < m_stringSet.size(); ++i)
+                {
+                    array[i].AsString(m_stringSet[i]);
+                }
+                value.WithArray(m_type == ValueType::STRING_SET ? "SS" : "NS", std::move(array));
+            }
+            break;
+        case ValueType::BYTEBUFFER_SET:
+            if (m_bS.size() > 0)
+            {
+                Array<JsonValue> array(m_bS.size());
+                for (unsigned i = 0; i < m_bS.size(); ++i)
+                {
+                    array[i].AsString(HashingUtils::Base64Encode(m_bS[i]));
+                }
+                value.WithArray("BS", std::move(array));
+            }
+            break;
+        case ValueType::ATTRIBUTE_MAP:
+        {
+            JsonValue mapValue;
+            for (auto& mapItem : m_m)
+            {
+                mapValue.WithObject(mapItem.first, mapItem.second->Jsonize());
+            }
+            value.WithObject("M", std::move(mapValue));
+            break;
+        }
+        case ValueType::ATTRIBUTE_LIST:
+        {
+            Array<JsonValue> list(m_l.size());
+            for (unsigned i = 0; i < m_l.size(); ++i)
+            {
+                list[i] = m_l[i]->Jsonize();
+            }
+            value.WithArray("L", std::move(list));
+            break;
+        }
+        case ValueType::BOOL:
+            value.WithBool("BOOL", m_bool);
+            break;
+        case ValueType::NULLVALUE:
+            value.WithBool("NULL", m_bool);
+            break;
+    }
+
+    return value;
+}
+
+void AttributeValue::Jsonize(JsonWriter& jsonWriter) const
+{
+    jsonWriter.StartObject();
+    if (!m_hasValue)
+    {
+        jsonWriter.EndObject();
+        return;
+    }
+
+    switch (m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            if (!m_s.empty())
+            {
+                jsonWriter.WriteKey(m_type == ValueType::STRING ? "S" : "N");
+                jsonWriter.WriteString(m_s);
+            }
+            break;
+        case ValueType::BYTEBUFFER:
+            if (m_b.GetLength() > 0)
+            {
+                jsonWriter.WriteKey("B");
+                jsonWriter.WriteBase64(m_b);
+            }
+            break;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            if (m_stringSet.size() > 0)
+            {
+                jsonWriter.WriteKey(m_type == ValueType::STRING_SET ? "SS" : "NS");
+                jsonWriter.StartArray();
+                for (const auto& s : m_stringSet)
+                {
+                    jsonWriter.WriteString(s);
+                }
+                jsonWriter.EndArray();
+            }
+            break;
+        case ValueType::BYTEBUFFER_SET:
+            if (m_bS.size() > 0)
+            {
+                jsonWriter.WriteKey("BS");
+                jsonWriter.StartArray();
+                for (const auto& b : m_bS)
+                {
+                    jsonWriter.WriteBase64(b);
+                }
+                jsonWriter.EndArray();
+            }
+            break;
+        case ValueType::ATTRIBUTE_MAP:
+            jsonWriter.WriteKey("M");
+            jsonWriter.StartObject();
+            for (auto& mapItem : m_m)
+            {
+                jsonWriter.WriteKey(mapItem.first);
+                mapItem.second->Jsonize(jsonWriter);
+            }
+            jsonWriter.EndObject();
+            break;
+        case ValueType::ATTRIBUTE_LIST:
+            jsonWriter.WriteKey("L");
+            jsonWriter.StartArray();
+            for (const auto& listItem : m_l)
+            {
+                listItem->Jsonize(jsonWriter);
+            }
+            jsonWriter.EndArray();
+            break;
+        case ValueType::BOOL:
+            jsonWriter.WriteKey("BOOL");
+            jsonWriter.WriteBool(m_bool);
+            break;
+        case ValueType::NULLVALUE:
+            jsonWriter.WriteKey("NULL");
+            jsonWriter.WriteBool(m_bool);
+            break;
+    }
+    jsonWriter.EndObject();
 }
 
 Aws::String AttributeValue::SerializeAttribute() const
@@ -394,5 +909,5 @@ Aws::String AttributeValue::SerializeAttribute() const
 
 Aws::DynamoDB::Model::ValueType AttributeValue::GetType() const
 {
-    return m_value->GetType();
+    return m_type;
 }
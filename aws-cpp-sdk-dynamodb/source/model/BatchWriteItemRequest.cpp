@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/BatchWriteItemRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -33,35 +34,40 @@ BatchWriteItemRequest::BatchWriteItemRequest() :
 
 Aws::String BatchWriteItemRequest::SerializePayload() const
 {
-  JsonValue payload;
-
+  Aws::String payload;
+  JsonWriter jsonWriter(payload);
+  jsonWriter.StartObject();
   if(m_requestItemsHasBeenSet)
   {
-   JsonValue requestItemsJsonMap;
-   for(auto& requestItemsItem : m_requestItems)
+   jsonWriter.WriteKey("RequestItems");
+   jsonWriter.StartObject();
+   for(const auto& requestItemsItem : m_requestItems)
    {
-     Array<JsonValue> writeRequestsJsonList(requestItemsItem.second.size());
-     for(unsigned writeRequestsIndex = 0; writeRequestsIndex < writeRequestsJsonList.GetLength(); ++writeRequestsIndex)
+     jsonWriter.WriteKey(requestItemsItem.first);
+     jsonWriter.StartArray();
+     for(const auto& writeRequestsItem : requestItemsItem.second)
      {
-       writeRequestsJsonList[writeRequestsIndex].AsObject(requestItemsItem.second[writeRequestsIndex].Jsonize());
+       writeRequestsItem.Jsonize(jsonWriter);
      }
-     requestItemsJsonMap.WithArray(requestItemsItem.first, std::move(writeRequestsJsonList));
+     jsonWriter.EndArray();
    }
-   payload.WithObject("RequestItems", std::move(requestItemsJsonMap));
-
+   jsonWriter.EndObject();
   }
 
   if(m_returnConsumedCapacityHasBeenSet)
   {
-   payload.WithString("ReturnConsumedCapacity", ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
+   jsonWriter.WriteKey("ReturnConsumedCapacity");
+   jsonWriter.WriteString(ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
   }
 
   if(m_returnItemCollectionMetricsHasBeenSet)
   {
-   payload.WithString("ReturnItemCollectionMetrics", ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
+   jsonWriter.WriteKey("ReturnItemCollectionMetrics");
+   jsonWriter.WriteString(ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
   }
 
-  return payload.View().WriteReadable();
+  jsonWriter.EndObject();
+  return payload;
 }
 
 Aws::Http::HeaderValueCollection BatchWriteItemRequest::GetRequestSpecificHeaders() const
@@ -15,7 +15,10 @@
 
 #include <aws/dynamodb/model/Capacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/HashingUtils.h>
 
+#include <cstring>
 #include <utility>
 
 using namespace Aws::Utils::Json;
@@ -51,27 +54,82 @@ Capacity::Capacity(JsonView jsonValue) :
 
 Capacity& Capacity::operator =(JsonView jsonValue)
 {
-  if(jsonValue.ValueExists("ReadCapacityUnits"))
+  for(JsonView member = jsonValue.GetFirstMember(); member.IsValid(); member = member.GetNextMember())
   {
-    m_readCapacityUnits = jsonValue.GetDouble("ReadCapacityUnits");
-
-    m_readCapacityUnitsHasBeenSet = true;
+    if(member.IsNull())
+    {
+      continue;
+    }
+    const char* memberName = member.GetMemberName();
+    switch(HashingUtils::HashString(memberName))
+    {
+      case HashingUtils::ConstexprHashString("ReadCapacityUnits"):
+        if(strcmp(memberName, "ReadCapacityUnits") == 0)
+        {
+          m_readCapacityUnits = member.AsDouble();
+          m_readCapacityUnitsHasBeenSet = true;
+        }
+        break;
+      case HashingUtils::ConstexprHashString("WriteCapacityUnits"):
+        if(strcmp(memberName, "WriteCapacityUnits") == 0)
+        {
+          m_writeCapacityUnits = member.AsDouble();
+          m_writeCapacityUnitsHasBeenSet = true;
+        }
+        break;
+      case HashingUtils::ConstexprHashString("CapacityUnits"):
+        if(strcmp(memberName, "CapacityUnits") == 0)
+        {
+          m_capacityUnits = member.AsDouble();
+          m_capacityUnitsHasBeenSet = true;
+        }
+        break;
+      default:
+        break;
+    }
   }
+  return *this;
+}
 
-  if(jsonValue.ValueExists("WriteCapacityUnits"))
-  {
-    m_writeCapacityUnits = jsonValue.GetDouble("WriteCapacityUnits");
-
-    m_writeCapacityUnitsHasBeenSet = true;
-  }
+Capacity::Capacity(JsonReader& jsonReader) : 
+    m_readCapacityUnits(0.0),
+    m_readCapacityUnitsHasBeenSet(false),
+    m_writeCapacityUnits(0.0),
+    m_writeCapacityUnitsHasBeenSet(false),
+    m_capacityUnits(0.0),
+    m_capacityUnitsHasBeenSet(false)
+{
+  *this = jsonReader;
+}
 
-  if(jsonValue.ValueExists("CapacityUnits"))
+Capacity& Capacity::operator =(JsonReader& jsonReader)
+{
+  Aws::String memberName;
+  if(jsonReader.BeginObject())
   {
-    m_capacityUnits = jsonValue.GetDouble("CapacityUnits");
-
-    m_capacityUnitsHasBeenSet = true;
+    while(jsonReader.NextMember(memberName))
+    {
+      if(memberName == "ReadCapacityUnits")
+      {
+        m_readCapacityUnits = jsonReader.ReadDouble();
+        m_readCapacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "WriteCapacityUnits")
+      {
+        m_writeCapacityUnits = jsonReader.ReadDouble();
+        m_writeCapacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "CapacityUnits")
+      {
+        m_capacityUnits = jsonReader.ReadDouble();
+        m_capacityUnitsHasBeenSet = true;
+      }
+      else
+      {
+        jsonReader.SkipValue();
+      }
+    }
   }
-
   return *this;
 }
 
@@ -15,7 +15,10 @@
 
 #include <aws/dynamodb/model/ConsumedCapacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/HashingUtils.h>
 
+#include <cstring>
 #include <utility>
 
 using namespace Aws::Utils::Json;
@@ -59,61 +62,156 @@ ConsumedCapacity::ConsumedCapacity(JsonView jsonValue) :
 
 ConsumedCapacity& ConsumedCapacity::operator =(JsonView jsonValue)
 {
-  if(jsonValue.ValueExists("TableName"))
+  for(JsonView member = jsonValue.GetFirstMember(); member.IsValid(); member = member.GetNextMember())
   {
-    m_tableName = jsonValue.GetString("TableName");
-
-    m_tableNameHasBeenSet = true;
-  }
-
-  if(jsonValue.ValueExists("CapacityUnits"))
-  {
-    m_capacityUnits = jsonValue.GetDouble("CapacityUnits");
-
-    m_capacityUnitsHasBeenSet = true;
-  }
-
-  if(jsonValue.ValueExists("ReadCapacityUnits"))
-  {
-    m_readCapacityUnits = jsonValue.GetDouble("ReadCapacityUnits");
-
-    m_readCapacityUnitsHasBeenSet = true;
-  }
-
-  if(jsonValue.ValueExists("WriteCapacityUnits"))
-  {
-    m_writeCapacityUnits = jsonValue.GetDouble("WriteCapacityUnits");
-
-    m_writeCapacityUnitsHasBeenSet = true;
-  }
-
-  if(jsonValue.ValueExists("Table"))
-  {
-    m_table = jsonValue.GetObject("Table");
-
-    m_tableHasBeenSet = true;
-  }
-
-  if(jsonValue.ValueExists("LocalSecondaryIndexes"))
-  {
-    Aws::Map<Aws::String, JsonView> localSecondaryIndexesJsonMap = jsonValue.GetObject("LocalSecondaryIndexes").GetAllObjects();
-    for(auto& localSecondaryIndexesItem : localSecondaryIndexesJsonMap)
+    if(member.IsNull())
     {
-      m_localSecondaryIndexes[localSecondaryIndexesItem.first] = localSecondaryIndexesItem.second.AsObject();
+      continue;
+    }
+    const char* memberName = member.GetMemberName();
+    switch(HashingUtils::HashString(memberName))
+    {
+      case HashingUtils::ConstexprHashString("TableName"):
+        if(strcmp(memberName, "TableName") == 0)
+        {
+          m_tableName = member.AsString();
+          m_tableNameHasBeenSet = true;
+        }
+        break;
+      case HashingUtils::ConstexprHashString("CapacityUnits"):
+        if(strcmp(memberName, "CapacityUnits") == 0)
+        {
+          m_capacityUnits = member.AsDouble();
+          m_capacityUnitsHasBeenSet = true;
+        }
+        break;
+      case HashingUtils::ConstexprHashString("ReadCapacityUnits"):
+        if(strcmp(memberName, "ReadCapacityUnits") == 0)
+        {
+          m_readCapacityUnits = member.AsDouble();
+          m_readCapacityUnitsHasBeenSet = true;
+        }
+        break;
+      case HashingUtils::ConstexprHashString("WriteCapacityUnits"):
+        if(strcmp(memberName, "WriteCapacityUnits") == 0)
+        {
+          m_writeCapacityUnits = member.AsDouble();
+          m_writeCapacityUnitsHasBeenSet = true;
+        }
+        break;
+      case HashingUtils::ConstexprHashString("Table"):
+        if(strcmp(memberName, "Table") == 0)
+        {
+          m_table = member.AsObject();
+          m_tableHasBeenSet = true;
+        }
+        break;
+      case HashingUtils::ConstexprHashString("LocalSecondaryIndexes"):
+        if(strcmp(memberName, "LocalSecondaryIndexes") == 0)
+        {
+          Aws::Map<Aws::String, JsonView> localSecondaryIndexesJsonMap = member.GetAllObjects();
+          for(auto& localSecondaryIndexesItem : localSecondaryIndexesJsonMap)
+          {
+            m_localSecondaryIndexes[localSecondaryIndexesItem.first] = localSecondaryIndexesItem.second.AsObject();
+          }
+          m_localSecondaryIndexesHasBeenSet = true;
+        }
+        break;
+      case HashingUtils::ConstexprHashString("GlobalSecondaryIndexes"):
+        if(strcmp(memberName, "GlobalSecondaryIndexes") == 0)
+        {
+          Aws::Map<Aws::String, JsonView> globalSecondaryIndexesJsonMap = member.GetAllObjects();
+          for(auto& globalSecondaryIndexesItem : globalSecondaryIndexesJsonMap)
+          {
+            m_globalSecondaryIndexes[globalSecondaryIndexesItem.first] = globalSecondaryIndexesItem.second.AsObject();
+          }
+          m_globalSecondaryIndexesHasBeenSet = true;
+        }
+        break;
+      default:
+        break;
     }
-    m_localSecondaryIndexesHasBeenSet = true;
   }
+  return *this;
+}
 
-  if(jsonValue.ValueExists("GlobalSecondaryIndexes"))
+ConsumedCapacity::ConsumedCapacity(JsonReader& jsonReader) : 
+    m_tableNameHasBeenSet(false),
+    m_capacityUnits(0.0),
+    m_capacityUnitsHasBeenSet(false),
+    m_readCapacityUnits(0.0),
+    m_readCapacityUnitsHasBeenSet(false),
+    m_writeCapacityUnits(0.0),
+    m_writeCapacityUnitsHasBeenSet(false),
+    m_tableHasBeenSet(false),
+    m_localSecondaryIndexesHasBeenSet(false),
+    m_globalSecondaryIndexesHasBeenSet(false)
+{
+  *this = jsonReader;
+}
+
+ConsumedCapacity& ConsumedCapacity::operator =(JsonReader& jsonReader)
+{
+  Aws::String memberName;
+  if(jsonReader.BeginObject())
   {
-    Aws::Map<Aws::String, JsonView> globalSecondaryIndexesJsonMap = jsonValue.GetObject("GlobalSecondaryIndexes").GetAllObjects();
-    for(auto& globalSecondaryIndexesItem : globalSecondaryIndexesJsonMap)
+    while(jsonReader.NextMember(memberName))
     {
-      m_globalSecondaryIndexes[globalSecondaryIndexesItem.first] = globalSecondaryIndexesItem.second.AsObject();
+      if(memberName == "TableName")
+      {
+        m_tableName = jsonReader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(memberName == "CapacityUnits")
+      {
+        m_capacityUnits = jsonReader.ReadDouble();
+        m_capacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "ReadCapacityUnits")
+      {
+        m_readCapacityUnits = jsonReader.ReadDouble();
+        m_readCapacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "WriteCapacityUnits")
+      {
+        m_writeCapacityUnits = jsonReader.ReadDouble();
+        m_writeCapacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "Table")
+      {
+        m_table = jsonReader;
+        m_tableHasBeenSet = true;
+      }
+      else if(memberName == "LocalSecondaryIndexes")
+      {
+        if(jsonReader.BeginObject())
+        {
+          Aws::String localSecondaryIndexesKey;
+          while(jsonReader.NextMember(localSecondaryIndexesKey))
+          {
+            m_localSecondaryIndexes[localSecondaryIndexesKey] = Capacity(jsonReader);
+          }
+        }
+        m_localSecondaryIndexesHasBeenSet = true;
+      }
+      else if(memberName == "GlobalSecondaryIndexes")
+      {
+        if(jsonReader.BeginObject())
+        {
+          Aws::String globalSecondaryIndexesKey;
+          while(jsonReader.NextMember(globalSecondaryIndexesKey))
+          {
+            m_globalSecondaryIndexes[globalSecondaryIndexesKey] = Capacity(jsonReader);
+          }
+        }
+        m_globalSecondaryIndexesHasBeenSet = true;
+      }
+      else
+      {
+        jsonReader.SkipValue();
+      }
     }
-    m_globalSecondaryIndexesHasBeenSet = true;
   }
-
   return *this;
 }
 
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/DeleteRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -72,6 +73,24 @@ JsonValue DeleteRequest::Jsonize() const
   return payload;
 }
 
+void DeleteRequest::Jsonize(JsonWriter& jsonWriter) const
+{
+  jsonWriter.StartObject();
+  if(m_keyHasBeenSet)
+  {
+   jsonWriter.WriteKey("Key");
+   jsonWriter.StartObject();
+   for(const auto& keyItem : m_key)
+   {
+     jsonWriter.WriteKey(keyItem.first);
+     keyItem.second.Jsonize(jsonWriter);
+   }
+   jsonWriter.EndObject();
+  }
+
+  jsonWriter.EndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/PutRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -72,6 +73,24 @@ JsonValue PutRequest::Jsonize() const
   return payload;
 }
 
+void PutRequest::Jsonize(JsonWriter& jsonWriter) const
+{
+  jsonWriter.StartObject();
+  if(m_itemHasBeenSet)
+  {
+   jsonWriter.WriteKey("Item");
+   jsonWriter.StartObject();
+   for(const auto& itemItem : m_item)
+   {
+     jsonWriter.WriteKey(itemItem.first);
+     itemItem.second.Jsonize(jsonWriter);
+   }
+   jsonWriter.EndObject();
+  }
+
+  jsonWriter.EndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
@@ -15,14 +15,19 @@
 
 #include <aws/dynamodb/model/QueryResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/HashingUtils.h>
 
+#include <cstring>
 #include <utility>
 
 using namespace Aws::DynamoDB::Model;
 using namespace Aws::Utils::Json;
+using namespace Aws::Utils::Stream;
 using namespace Aws::Utils;
 using namespace Aws;
 
@@ -42,49 +47,138 @@ QueryResult::QueryResult(const Aws::AmazonWebServiceResult<JsonValue>& result) :
 QueryResult& QueryResult::operator =(const Aws::AmazonWebServiceResult<JsonValue>& result)
 {
   JsonView jsonValue = result.GetPayload().View();
-  if(jsonValue.ValueExists("Items"))
+  for(JsonView member = jsonValue.GetFirstMember(); member.IsValid(); member = member.GetNextMember())
   {
-    Array<JsonView> itemsJsonList = jsonValue.GetArray("Items");
-    for(unsigned itemsIndex = 0; itemsIndex < itemsJsonList.GetLength(); ++itemsIndex)
+    if(member.IsNull())
     {
-      Aws::Map<Aws::String, JsonView> attributeMapJsonMap = itemsJsonList[itemsIndex].GetAllObjects();
-      Aws::Map<Aws::String, AttributeValue> attributeMapMap;
-      for(auto& attributeMapItem : attributeMapJsonMap)
-      {
-        attributeMapMap[attributeMapItem.first] = attributeMapItem.second.AsObject();
-      }
-      m_items.push_back(std::move(attributeMapMap));
+      continue;
+    }
+    const char* memberName = member.GetMemberName();
+    switch(HashingUtils::HashString(memberName))
+    {
+      case HashingUtils::ConstexprHashString("Items"):
+        if(strcmp(memberName, "Items") == 0)
+        {
+          Array<JsonView> itemsJsonList = member.AsArray();
+          for(unsigned itemsIndex = 0; itemsIndex < itemsJsonList.GetLength(); ++itemsIndex)
+          {
+            Aws::Map<Aws::String, JsonView> attributeMapJsonMap = itemsJsonList[itemsIndex].GetAllObjects();
+            Aws::Map<Aws::String, AttributeValue> attributeMapMap;
+            for(auto& attributeMapItem : attributeMapJsonMap)
+            {
+              attributeMapMap[attributeMapItem.first] = attributeMapItem.second.AsObject();
+            }
+            m_items.push_back(std::move(attributeMapMap));
+          }
+        }
+        break;
+      case HashingUtils::ConstexprHashString("Count"):
+        if(strcmp(memberName, "Count") == 0)
+        {
+          m_count = member.AsInteger();
+        }
+        break;
+      case HashingUtils::ConstexprHashString("ScannedCount"):
+        if(strcmp(memberName, "ScannedCount") == 0)
+        {
+          m_scannedCount = member.AsInteger();
+        }
+        break;
+      case HashingUtils::ConstexprHashString("LastEvaluatedKey"):
+        if(strcmp(memberName, "LastEvaluatedKey") == 0)
+        {
+          Aws::Map<Aws::String, JsonView> lastEvaluatedKeyJsonMap = member.GetAllObjects();
+          for(auto& lastEvaluatedKeyItem : lastEvaluatedKeyJsonMap)
+          {
+            m_lastEvaluatedKey[lastEvaluatedKeyItem.first] = lastEvaluatedKeyItem.second.AsObject();
+          }
+        }
+        break;
+      case HashingUtils::ConstexprHashString("ConsumedCapacity"):
+        if(strcmp(memberName, "ConsumedCapacity") == 0)
+        {
+          m_consumedCapacity = member.AsObject();
+        }
+        break;
+      default:
+        break;
     }
   }
 
-  if(jsonValue.ValueExists("Count"))
-  {
-    m_count = jsonValue.GetInteger("Count");
 
-  }
+  return *this;
+}
 
-  if(jsonValue.ValueExists("ScannedCount"))
-  {
-    m_scannedCount = jsonValue.GetInteger("ScannedCount");
+QueryResult::QueryResult(const Aws::AmazonWebServiceResult<ResponseStream>& result) : 
+    m_count(0),
+    m_scannedCount(0)
+{
+  *this = result;
+}
 
-  }
+QueryResult& QueryResult::operator =(const Aws::AmazonWebServiceResult<ResponseStream>& result)
+{
+  JsonReader jsonReader(result.GetPayload().GetUnderlyingStream());
+  return *this = QueryResult(result, jsonReader);
+}
 
-  if(jsonValue.ValueExists("LastEvaluatedKey"))
+QueryResult::QueryResult(const Aws::AmazonWebServiceResult<ResponseStream>& result, JsonReader& jsonReader) : 
+    m_count(0),
+    m_scannedCount(0)
+{
+  Aws::String memberName;
+  if(jsonReader.BeginObject())
   {
-    Aws::Map<Aws::String, JsonView> lastEvaluatedKeyJsonMap = jsonValue.GetObject("LastEvaluatedKey").GetAllObjects();
-    for(auto& lastEvaluatedKeyItem : lastEvaluatedKeyJsonMap)
+    while(jsonReader.NextMember(memberName))
     {
-      m_lastEvaluatedKey[lastEvaluatedKeyItem.first] = lastEvaluatedKeyItem.second.AsObject();
+      if(memberName == "Items")
+      {
+        if(jsonReader.BeginArray())
+        {
+          while(jsonReader.NextElement())
+          {
+            Aws::Map<Aws::String, AttributeValue> attributeMapMap;
+            if(jsonReader.BeginObject())
+            {
+              Aws::String attributeMapKey;
+              while(jsonReader.NextMember(attributeMapKey))
+              {
+                attributeMapMap[attributeMapKey] = AttributeValue(jsonReader);
+              }
+            }
+            m_items.push_back(std::move(attributeMapMap));
+          }
+        }
+      }
+      else if(memberName == "Count")
+      {
+        m_count = jsonReader.ReadInteger();
+      }
+      else if(memberName == "ScannedCount")
+      {
+        m_scannedCount = jsonReader.ReadInteger();
+      }
+      else if(memberName == "LastEvaluatedKey")
+      {
+        if(jsonReader.BeginObject())
+        {
+          Aws::String lastEvaluatedKeyKey;
+          while(jsonReader.NextMember(lastEvaluatedKeyKey))
+          {
+            m_lastEvaluatedKey[lastEvaluatedKeyKey] = AttributeValue(jsonReader);
+          }
+        }
+      }
+      else if(memberName == "ConsumedCapacity")
+      {
+        m_consumedCapacity = jsonReader;
+      }
+      else
+      {
+        jsonReader.SkipValue();
+      }
     }
   }
 
-  if(jsonValue.ValueExists("ConsumedCapacity"))
-  {
-    m_consumedCapacity = jsonValue.GetObject("ConsumedCapacity");
-
-  }
-
-
-
-  return *this;
+  AWS_UNREFERENCED_PARAM(result);
 }
@@ -15,6 +15,8 @@
 
 #include <aws/dynamodb/model/ScanResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -23,6 +25,7 @@
 
 using namespace Aws::DynamoDB::Model;
 using namespace Aws::Utils::Json;
+using namespace Aws::Utils::Stream;
 using namespace Aws::Utils;
 using namespace Aws;
 
@@ -88,3 +91,77 @@ ScanResult& ScanResult::operator =(const Aws::AmazonWebServiceResult<JsonValue>&
 
   return *this;
 }
+
+ScanResult::ScanResult(const Aws::AmazonWebServiceResult<ResponseStream>& result) : 
+    m_count(0),
+    m_scannedCount(0)
+{
+  *this = result;
+}
+
+ScanResult& ScanResult::operator =(const Aws::AmazonWebServiceResult<ResponseStream>& result)
+{
+  JsonReader jsonReader(result.GetPayload().GetUnderlyingStream());
+  return *this = ScanResult(result, jsonReader);
+}
+
+ScanResult::ScanResult(const Aws::AmazonWebServiceResult<ResponseStream>& result, JsonReader& jsonReader) : 
+    m_count(0),
+    m_scannedCount(0)
+{
+  Aws::String memberName;
+  if(jsonReader.BeginObject())
+  {
+    while(jsonReader.NextMember(memberName))
+    {
+      if(memberName == "Items")
+      {
+        if(jsonReader.BeginArray())
+        {
+          while(jsonReader.NextElement())
+          {
+            Aws::Map<Aws::String, AttributeValue> attributeMapMap;
+            if(jsonReader.BeginObject())
+            {
+              Aws::String attributeMapKey;
+              while(jsonReader.NextMember(attributeMapKey))
+              {
+                attributeMapMap[attributeMapKey] = AttributeValue(jsonReader);
+              }
+            }
+            m_items.push_back(std::move(attributeMapMap));
+          }
+        }
+      }
+      else if(memberName == "Count")
+      {
+        m_count = jsonReader.ReadInteger();
+      }
+      else if(memberName == "ScannedCount")
+      {
+        m_scannedCount = jsonReader.ReadInteger();
+      }
+      else if(memberName == "LastEvaluatedKey")
+      {
+        if(jsonReader.BeginObject())
+        {
+          Aws::String lastEvaluatedKeyKey;
+          while(jsonReader.NextMember(lastEvaluatedKeyKey))
+          {
+            m_lastEvaluatedKey[lastEvaluatedKeyKey] = AttributeValue(jsonReader);
+          }
+        }
+      }
+      else if(memberName == "ConsumedCapacity")
+      {
+        m_consumedCapacity = jsonReader;
+      }
+      else
+      {
+        jsonReader.SkipValue();
+      }
+    }
+  }
+
+  AWS_UNREFERENCED_PARAM(result);
+}
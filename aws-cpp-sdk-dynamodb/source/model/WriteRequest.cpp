@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/WriteRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -79,6 +80,24 @@ JsonValue WriteRequest::Jsonize() const
   return payload;
 }
 
+void WriteRequest::Jsonize(JsonWriter& jsonWriter) const
+{
+  jsonWriter.StartObject();
+  if(m_putRequestHasBeenSet)
+  {
+   jsonWriter.WriteKey("PutRequest");
+   m_putRequest.Jsonize(jsonWriter);
+  }
+
+  if(m_deleteRequestHasBeenSet)
+  {
+   jsonWriter.WriteKey("DeleteRequest");
+   m_deleteRequest.Jsonize(jsonWriter);
+  }
+
+  jsonWriter.EndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
@@ -27,6 +27,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonWriter;
 } // namespace Json
 } // namespace Utils
 namespace Kinesis
@@ -47,6 +48,7 @@ namespace Model
     PutRecordsRequestEntry(Aws::Utils::Json::JsonView jsonValue);
     PutRecordsRequestEntry& operator=(Aws::Utils::Json::JsonView jsonValue);
     Aws::Utils::Json::JsonValue Jsonize() const;
+    void Jsonize(Aws::Utils::Json::JsonWriter& jsonWriter) const;
 
 
     /**
@@ -15,6 +15,7 @@
 
 #include <aws/kinesis/model/PutRecordsRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -30,26 +31,28 @@ PutRecordsRequest::PutRecordsRequest() :
 
 Aws::String PutRecordsRequest::SerializePayload() const
 {
-  JsonValue payload;
-
+  Aws::String payload;
+  JsonWriter jsonWriter(payload);
+  jsonWriter.StartObject();
   if(m_recordsHasBeenSet)
   {
-   Array<JsonValue> recordsJsonList(m_records.size());
-   for(unsigned recordsIndex = 0; recordsIndex < recordsJsonList.GetLength(); ++recordsIndex)
+   jsonWriter.WriteKey("Records");
+   jsonWriter.StartArray();
+   for(const auto& recordsItem : m_records)
    {
-     recordsJsonList[recordsIndex].AsObject(m_records[recordsIndex].Jsonize());
+     recordsItem.Jsonize(jsonWriter);
    }
-   payload.WithArray("Records", std::move(recordsJsonList));
-
+   jsonWriter.EndArray();
   }
 
   if(m_streamNameHasBeenSet)
   {
-   payload.WithString("StreamName", m_streamName);
-
+   jsonWriter.WriteKey("StreamName");
+   jsonWriter.WriteString(m_streamName);
   }
 
-  return payload.View().WriteReadable();
+  jsonWriter.EndObject();
+  return payload;
 }
 
 Aws::Http::HeaderValueCollection PutRecordsRequest::GetRequestSpecificHeaders() const
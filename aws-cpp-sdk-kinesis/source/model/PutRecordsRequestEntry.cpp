@@ -15,6 +15,7 @@
 
 #include <aws/kinesis/model/PutRecordsRequestEntry.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 #include <aws/core/utils/HashingUtils.h>
 
 #include <utility>
@@ -93,6 +94,30 @@ JsonValue PutRecordsRequestEntry::Jsonize() const
   return payload;
 }
 
+void PutRecordsRequestEntry::Jsonize(JsonWriter& jsonWriter) const
+{
+  jsonWriter.StartObject();
+  if(m_dataHasBeenSet)
+  {
+   jsonWriter.WriteKey("Data");
+   jsonWriter.WriteBase64(m_data);
+  }
+
+  if(m_explicitHashKeyHasBeenSet)
+  {
+   jsonWriter.WriteKey("ExplicitHashKey");
+   jsonWriter.WriteString(m_explicitHashKey);
+  }
+
+  if(m_partitionKeyHasBeenSet)
+  {
+   jsonWriter.WriteKey("PartitionKey");
+   jsonWriter.WriteString(m_partitionKey);
+  }
+
+  jsonWriter.EndObject();
+}
+
 } // namespace Model
 } // namespace Kinesis
 } // namespace Aws
@@ -29,16 +29,22 @@
 
 #include <aws/s3-encryption/modules/CryptoModule.h>
 #include <aws/s3-encryption/modules/CryptoModuleFactory.h>
+#include <aws/s3-encryption/modules/MultipartUploadCryptoContext.h>
 #include <aws/s3-encryption/materials/KMSEncryptionMaterials.h>
 #include <aws/s3-encryption/materials/SimpleEncryptionMaterials.h>
 #include <aws/s3-encryption/CryptoConfiguration.h>
 #include <aws/s3-encryption/handlers/InstructionFileHandler.h>
 #include <aws/s3-encryption/S3EncryptionClient.h>
+#include <aws/s3-encryption/S3EncryptionTransferClient.h>
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/CreateBucketRequest.h>
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
 
 #include <aws/kms/KMSClient.h>
 #include <aws/kms/model/EncryptRequest.h>
@@ -62,6 +68,8 @@ namespace
     static const char* const GET_RANGE_OUTPUT = "ge for encryption and";
     static size_t const GCM_TAG_LENGTH = 128u;
     static size_t const GCM_IV_SIZE_BYTES = 12u;
+    static const char* const UPLOAD_ID_TEST = "testUploadId";
+    static uint64_t const MULTIPART_PART_SIZE = 32u;
 #endif
 
     using namespace Aws::Auth;
@@ -225,6 +233,55 @@ namespace
         mutable size_t m_requestContentLength;
     };
 
+#ifndef ENABLE_COMMONCRYPTO_ENCRYPTION
+    /*
+    * Mock S3 Client that also keeps the parts of one multipart upload in memory. Completing the upload joins the listed
+    * parts into the object body, which can then be read back with the get/head operations of MockS3Client.
+    */
+    class MockMultipartS3Client : public MockS3Client
+    {
+    public:
+        Aws::S3::Model::CreateMultipartUploadOutcome CreateMultipartUpload(const Aws::S3::Model::CreateMultipartUploadRequest& request) const override
+        {
+            m_metadata = request.GetMetadata();
+            m_parts.clear();
+            Aws::S3::Model::CreateMultipartUploadResult result;
+            result.SetUploadId(UPLOAD_ID_TEST);
+            return result;
+        }
+
+        Aws::S3::Model::UploadPartOutcome UploadPart(const Aws::S3::Model::UploadPartRequest& request) const override
+        {
+            std::shared_ptr<Aws::IOStream> body = request.GetBody();
+            Aws::String partBody((Aws::IStreamBufIterator(*body)), Aws::IStreamBufIterator());
+            m_parts[request.GetPartNumber()] = partBody;
+            Aws::S3::Model::UploadPartResult result;
+            result.SetETag("etag" + Aws::Utils::StringUtils::to_string(request.GetPartNumber()));
+            return result;
+        }
+
+        Aws::S3::Model::CompleteMultipartUploadOutcome CompleteMultipartUpload(const Aws::S3::Model::CompleteMultipartUploadRequest& request) const override
+        {
+            bodyString.clear();
+            for (const auto& part : request.GetMultipartUpload().GetParts())
+            {
+                EXPECT_EQ("etag" + Aws::Utils::StringUtils::to_string(part.GetPartNumber()), part.GetETag());
+                bodyString += m_parts[part.GetPartNumber()];
+            }
+            m_requestContentLength = bodyString.size();
+            return Aws::S3::Model::CompleteMultipartUploadResult();
+        }
+
+        Aws::S3::Model::AbortMultipartUploadOutcome AbortMultipartUpload(const Aws::S3::Model::AbortMultipartUploadRequest&) const override
+        {
+            m_parts.clear();
+            return Aws::S3::Model::AbortMultipartUploadResult();
+        }
+
+        mutable Aws::Map<int, Aws::String> m_parts;
+    };
+#endif
+
     class CryptoModulesTest : public ::testing::Test
     {
     protected:
@@ -246,6 +303,72 @@ namespace
             ASSERT_TRUE(metadataMap[KEY_WRAP_ALGORITHM].size() > 0u);
             ASSERT_TRUE(metadataMap[MATERIALS_DESCRIPTION_HEADER].size() > 0u);
         }
+
+#ifndef ENABLE_COMMONCRYPTO_ENCRYPTION
+        static Aws::String MakeMultipartTestBody(size_t length)
+        {
+            Aws::String body;
+            for (size_t i = 0; i < length; ++i)
+            {
+                body.push_back(static_cast<char>('a' + i % 26));
+            }
+            return body;
+        }
+
+        /*
+        * Uploads body in parts of MULTIPART_PART_SIZE bytes, last part first, and completes the upload.
+        */
+        template<typename CLIENT_TYPE>
+        static void UploadInParts(const CLIENT_TYPE& client, const Aws::String& body)
+        {
+            CreateMultipartUploadRequest createRequest;
+            createRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME);
+            auto createOutcome = client.CreateMultipartUpload(createRequest);
+            ASSERT_TRUE(createOutcome.IsSuccess());
+            Aws::String uploadId = createOutcome.GetResult().GetUploadId();
+
+            size_t partCount = (body.size() + MULTIPART_PART_SIZE - 1) / MULTIPART_PART_SIZE;
+            Aws::Vector<CompletedPart> parts(partCount);
+            for (size_t i = partCount; i > 0; --i)
+            {
+                size_t offset = (i - 1) * MULTIPART_PART_SIZE;
+                std::shared_ptr<Aws::IOStream> partStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+                *partStream << body.substr(offset, MULTIPART_PART_SIZE);
+                UploadPartRequest partRequest;
+                partRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME).WithUploadId(uploadId).WithPartNumber(static_cast<int>(i));
+                partRequest.SetBody(partStream);
+                auto partOutcome = client.UploadPart(partRequest);
+                ASSERT_TRUE(partOutcome.IsSuccess());
+                parts[i - 1].WithPartNumber(static_cast<int>(i)).WithETag(partOutcome.GetResult().GetETag());
+            }
+
+            CompleteMultipartUploadRequest completeRequest;
+            completeRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME).WithUploadId(uploadId);
+            completeRequest.SetMultipartUpload(CompletedMultipartUpload().WithParts(parts));
+            auto completeOutcome = client.CompleteMultipartUpload(completeRequest);
+            ASSERT_TRUE(completeOutcome.IsSuccess());
+        }
+
+        template<typename CLIENT_TYPE>
+        static Aws::String GetBody(const CLIENT_TYPE& client, const Aws::String& range)
+        {
+            GetObjectRequest getRequest;
+            getRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME);
+            if (!range.empty())
+            {
+                getRequest.SetRange(range);
+            }
+            auto getOutcome = client.GetObject(getRequest);
+            EXPECT_TRUE(getOutcome.IsSuccess());
+            if (!getOutcome.IsSuccess())
+            {
+                return "";
+            }
+            Aws::OStringStream ss;
+            ss << getOutcome.GetResult().GetBody().rdbuf();
+            return ss.str();
+        }
+#endif
     };
 
     TEST_F(CryptoModulesTest, EncryptionOnlyOperationsTestWithSimpleEncryptionMaterials)
@@ -832,6 +955,203 @@ namespace
         ASSERT_DEATH({ decryptionModule->GetObjectSecurely(getRequest, headOutcome.GetResult(), contentCryptoMaterial, getObjectFunction); }, ASSERTION_FAILED);
     }
 #endif // !defined(NDEBUG) && defined(GTEST_HAS_DEATH_TEST)
+
+    TEST_F(CryptoModulesTest, MultipartUploadMatchesSinglePassGCM)
+    {
+        auto key = Aws::Utils::Crypto::SymmetricCipher::GenerateKey();
+        auto iv = Aws::Utils::Crypto::SymmetricCipher::GenerateIV(GCM_IV_SIZE_BYTES);
+        Aws::Vector<size_t> lengths = { 5u, MULTIPART_PART_SIZE, 2 * MULTIPART_PART_SIZE + 20, 3 * MULTIPART_PART_SIZE };
+        for (size_t length : lengths)
+        {
+            Aws::String body = MakeMultipartTestBody(length);
+            Aws::Utils::CryptoBuffer plaintext(reinterpret_cast<const unsigned char*>(body.c_str()), body.size());
+            auto gcmCipher = CreateAES_GCMImplementation(key, iv);
+            auto encrypted = gcmCipher->EncryptBuffer(plaintext);
+            auto finalBlock = gcmCipher->FinalizeEncryption();
+            Aws::String expected(reinterpret_cast<const char*>(encrypted.GetUnderlyingData()), encrypted.GetLength());
+            expected.append(reinterpret_cast<const char*>(finalBlock.GetUnderlyingData()), finalBlock.GetLength());
+            expected.append(reinterpret_cast<const char*>(gcmCipher->GetTag().GetUnderlyingData()), gcmCipher->GetTag().GetLength());
+
+            MockMultipartS3Client s3Client;
+            auto uploadPartFunction = [&s3Client](const UploadPartRequest& partRequest) { return s3Client.UploadPart(partRequest); };
+            auto completeFunction = [&s3Client](const CompleteMultipartUploadRequest& completeRequest) { return s3Client.CompleteMultipartUpload(completeRequest); };
+            MultipartUploadCryptoContext context(key, iv, MULTIPART_PART_SIZE);
+
+            size_t partCount = (length + MULTIPART_PART_SIZE - 1) / MULTIPART_PART_SIZE;
+            CompletedMultipartUpload completedUpload;
+            for (size_t i = 0; i < partCount; ++i)
+            {
+                std::shared_ptr<Aws::IOStream> partStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+                *partStream << body.substr(i * MULTIPART_PART_SIZE, MULTIPART_PART_SIZE);
+                UploadPartRequest partRequest;
+                partRequest.WithUploadId(UPLOAD_ID_TEST).WithPartNumber(static_cast<int>(i + 1));
+                partRequest.SetBody(partStream);
+                auto partOutcome = context.UploadPartSecurely(partRequest, uploadPartFunction);
+                ASSERT_TRUE(partOutcome.IsSuccess());
+                completedUpload.AddParts(CompletedPart().WithPartNumber(static_cast<int>(i + 1)).WithETag(partOutcome.GetResult().GetETag()));
+            }
+
+            CompleteMultipartUploadRequest completeRequest;
+            completeRequest.WithUploadId(UPLOAD_ID_TEST).WithMultipartUpload(completedUpload);
+            ASSERT_TRUE(context.CompleteMultipartUploadSecurely(completeRequest, uploadPartFunction, completeFunction).IsSuccess());
+            ASSERT_EQ(expected, s3Client.bodyString);
+        }
+    }
+
+    TEST_F(CryptoModulesTest, MultipartUploadWithShortLastPart)
+    {
+        auto materials = Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, CryptoMode::AUTHENTICATED_ENCRYPTION);
+        auto s3Client = Aws::MakeShared<MockMultipartS3Client>(ALLOCATION_TAG);
+        S3EncryptionClient client(materials, cryptoConfig, s3Client);
+        ASSERT_TRUE(client.MultipartUploadSupported());
+
+        Aws::String body = MakeMultipartTestBody(2 * MULTIPART_PART_SIZE + 20);
+        UploadInParts(S3EncryptionTransferClient(Aws::MakeShared<S3EncryptionClient>(ALLOCATION_TAG, materials, cryptoConfig, s3Client), MULTIPART_PART_SIZE,
+            Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "", "")), body);
+        MetadataFilled(s3Client->GetMetadata());
+
+        //the short last part goes up with the tag, so there is no extra part.
+        ASSERT_EQ(3u, s3Client->m_parts.size());
+        ASSERT_EQ(body.size() + GCM_TAG_LENGTH / 8u, s3Client->GetRequestContentLength());
+        ASSERT_NE(body, s3Client->bodyString.substr(0, body.size()));
+
+        ASSERT_EQ(body, GetBody(client, ""));
+        ASSERT_EQ(body.substr(20, 40), GetBody(client, "bytes=20-59"));
+        ASSERT_EQ(body.substr(MULTIPART_PART_SIZE * 2), GetBody(client, "bytes=64-83"));
+
+        CryptoConfiguration strictAEConfig(StorageMethod::METADATA, CryptoMode::STRICT_AUTHENTICATED_ENCRYPTION);
+        S3EncryptionClient strictClient(materials, strictAEConfig, s3Client);
+        ASSERT_EQ(body, GetBody(strictClient, ""));
+
+        HeadObjectRequest headRequest;
+        headRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME);
+        auto headOutcome = client.HeadObject(headRequest);
+        ASSERT_TRUE(headOutcome.IsSuccess());
+        ASSERT_EQ(static_cast<long long>(body.size()), headOutcome.GetResult().GetContentLength());
+
+        s3Client->bodyString[MULTIPART_PART_SIZE + 1] ^= 1;
+        ASSERT_NE(body, GetBody(strictClient, ""));
+    }
+
+    TEST_F(CryptoModulesTest, MultipartUploadWithFullLastPart)
+    {
+        auto materials = Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, CryptoMode::STRICT_AUTHENTICATED_ENCRYPTION);
+        auto s3Client = Aws::MakeShared<MockMultipartS3Client>(ALLOCATION_TAG);
+        auto encryptionClient = Aws::MakeShared<S3EncryptionClient>(ALLOCATION_TAG, materials, cryptoConfig, s3Client);
+        S3EncryptionTransferClient client(encryptionClient, MULTIPART_PART_SIZE, Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "", ""));
+        ASSERT_TRUE(client.MultipartUploadSupported());
+
+        Aws::String body = MakeMultipartTestBody(3 * MULTIPART_PART_SIZE);
+        UploadInParts(client, body);
+
+        //the tag is a part of its own.
+        ASSERT_EQ(4u, s3Client->m_parts.size());
+        ASSERT_EQ(GCM_TAG_LENGTH / 8u, s3Client->m_parts[4].size());
+        ASSERT_EQ(body, GetBody(client, ""));
+
+        //strict mode can't decrypt a range, but can serve one covering the whole object.
+        ASSERT_EQ(body, GetBody(client, "bytes=0-95"));
+        GetObjectRequest getRequest;
+        getRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME).WithRange("bytes=32-63");
+        ASSERT_FALSE(client.GetObject(getRequest).IsSuccess());
+    }
+
+    TEST_F(CryptoModulesTest, MultipartUploadWithTheMaximumPartCount)
+    {
+        const int MAX_PART_NUMBER = 10000;
+        auto key = Aws::Utils::Crypto::SymmetricCipher::GenerateKey();
+        auto iv = Aws::Utils::Crypto::SymmetricCipher::GenerateIV(GCM_IV_SIZE_BYTES);
+        Aws::String body = MakeMultipartTestBody(MAX_PART_NUMBER * MULTIPART_PART_SIZE);
+        Aws::Utils::CryptoBuffer plaintext(reinterpret_cast<const unsigned char*>(body.c_str()), body.size());
+        auto gcmCipher = CreateAES_GCMImplementation(key, iv);
+        auto encrypted = gcmCipher->EncryptBuffer(plaintext);
+        auto finalBlock = gcmCipher->FinalizeEncryption();
+        Aws::String expected(reinterpret_cast<const char*>(encrypted.GetUnderlyingData()), encrypted.GetLength());
+        expected.append(reinterpret_cast<const char*>(finalBlock.GetUnderlyingData()), finalBlock.GetLength());
+        expected.append(reinterpret_cast<const char*>(gcmCipher->GetTag().GetUnderlyingData()), gcmCipher->GetTag().GetLength());
+
+        MockMultipartS3Client s3Client;
+        auto uploadPartFunction = [&s3Client](const UploadPartRequest& partRequest) { return s3Client.UploadPart(partRequest); };
+        auto completeFunction = [&s3Client](const CompleteMultipartUploadRequest& completeRequest) { return s3Client.CompleteMultipartUpload(completeRequest); };
+        MultipartUploadCryptoContext context(key, iv, MULTIPART_PART_SIZE);
+
+        CompletedMultipartUpload completedUpload;
+        for (int partNumber = 1; partNumber <= MAX_PART_NUMBER + 1; ++partNumber)
+        {
+            std::shared_ptr<Aws::IOStream> partStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+            *partStream << body.substr((partNumber - 1) * MULTIPART_PART_SIZE, MULTIPART_PART_SIZE);
+            UploadPartRequest partRequest;
+            partRequest.WithUploadId(UPLOAD_ID_TEST).WithPartNumber(partNumber);
+            partRequest.SetBody(partStream);
+            auto partOutcome = context.UploadPartSecurely(partRequest, uploadPartFunction);
+            if (partNumber > MAX_PART_NUMBER)
+            {
+                //S3 doesn't take more parts than that, so don't encrypt one.
+                ASSERT_FALSE(partOutcome.IsSuccess());
+                break;
+            }
+            ASSERT_TRUE(partOutcome.IsSuccess());
+            completedUpload.AddParts(CompletedPart().WithPartNumber(partNumber).WithETag(partOutcome.GetResult().GetETag()));
+        }
+
+        CompleteMultipartUploadRequest completeRequest;
+        completeRequest.WithUploadId(UPLOAD_ID_TEST).WithMultipartUpload(completedUpload);
+        ASSERT_TRUE(context.CompleteMultipartUploadSecurely(completeRequest, uploadPartFunction, completeFunction).IsSuccess());
+
+        //the full last part carries the tag, instead of the tag going up as part 10,001.
+        ASSERT_EQ(static_cast<size_t>(MAX_PART_NUMBER), s3Client.m_parts.size());
+        ASSERT_EQ(MULTIPART_PART_SIZE + GCM_TAG_LENGTH / 8u, s3Client.m_parts[MAX_PART_NUMBER].size());
+        ASSERT_EQ(expected, s3Client.bodyString);
+    }
+
+    TEST_F(CryptoModulesTest, MultipartUploadFailures)
+    {
+        auto materials = Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        auto s3Client = Aws::MakeShared<MockMultipartS3Client>(ALLOCATION_TAG);
+
+        CreateMultipartUploadRequest createRequest;
+        createRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME);
+
+        CryptoConfiguration eoConfig(StorageMethod::METADATA, CryptoMode::ENCRYPTION_ONLY);
+        S3EncryptionClient eoClient(materials, eoConfig, s3Client);
+        ASSERT_FALSE(eoClient.MultipartUploadSupported());
+        ASSERT_FALSE(eoClient.CreateMultipartUpload(createRequest, MULTIPART_PART_SIZE).IsSuccess());
+
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, CryptoMode::AUTHENTICATED_ENCRYPTION);
+        S3EncryptionClient client(materials, cryptoConfig, s3Client);
+        ASSERT_FALSE(client.CreateMultipartUpload(createRequest, MULTIPART_PART_SIZE + 1).IsSuccess());
+
+        UploadPartRequest partRequest;
+        partRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME).WithUploadId(UPLOAD_ID_TEST).WithPartNumber(1);
+        std::shared_ptr<Aws::IOStream> partStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        *partStream << MakeMultipartTestBody(MULTIPART_PART_SIZE);
+        partRequest.SetBody(partStream);
+        ASSERT_FALSE(client.UploadPart(partRequest).IsSuccess());
+
+        ASSERT_TRUE(client.CreateMultipartUpload(createRequest, MULTIPART_PART_SIZE).IsSuccess());
+        ASSERT_TRUE(client.UploadPart(partRequest).IsSuccess());
+
+        //a part larger than the part size.
+        partRequest.SetPartNumber(2);
+        std::shared_ptr<Aws::IOStream> largePartStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        *largePartStream << MakeMultipartTestBody(MULTIPART_PART_SIZE + 1);
+        partRequest.SetBody(largePartStream);
+        ASSERT_FALSE(client.UploadPart(partRequest).IsSuccess());
+
+        //a gap in the part numbers.
+        CompleteMultipartUploadRequest completeRequest;
+        completeRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME).WithUploadId(UPLOAD_ID_TEST);
+        completeRequest.SetMultipartUpload(CompletedMultipartUpload().AddParts(CompletedPart().WithPartNumber(2).WithETag("etag2")));
+        ASSERT_FALSE(client.CompleteMultipartUpload(completeRequest).IsSuccess());
+
+        AbortMultipartUploadRequest abortRequest;
+        abortRequest.WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME).WithUploadId(UPLOAD_ID_TEST);
+        ASSERT_TRUE(client.AbortMultipartUpload(abortRequest).IsSuccess());
+        completeRequest.SetMultipartUpload(CompletedMultipartUpload().AddParts(CompletedPart().WithPartNumber(1).WithETag("etag1")));
+        ASSERT_FALSE(client.CompleteMultipartUpload(completeRequest).IsSuccess());
+    }
 #endif
 
     TEST_F(CryptoModulesTest, RangeParserSuccess)
@@ -23,6 +23,7 @@
 #include <aws/core/utils/crypto/ContentCryptoMaterial.h>
 #include <aws/s3-encryption/materials/SimpleEncryptionMaterials.h>
 #include <aws/s3-encryption/materials/KMSEncryptionMaterials.h>
+#include <aws/s3-encryption/materials/ContentEncryptionKeyCache.h>
 #include <aws/kms/KMSClient.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/core/utils/Outcome.h>
@@ -393,6 +394,78 @@ namespace
         ASSERT_EQ(myClient->m_decryptCalledCount, 0u);
         ASSERT_EQ(myClient->m_encryptCalledCount, 0u);
     }
+
+    //This tests that KMS Encryption Materials with a key cache only call KMS decrypt once per master key, encrypted key and encryption context.
+    TEST_F(KMSEncryptionMaterialsTest, TestKeyCacheDecryptCEK)
+    {
+        auto myClient = Aws::MakeShared<MockKMSClient>(AllocationTag, ClientConfiguration());
+        InitMockKMSClient(myClient);
+        auto keyCache = Aws::MakeShared<ContentEncryptionKeyCache>(AllocationTag, 10u, std::chrono::minutes(5));
+        KMSEncryptionMaterials encryptionMaterials(TEST_CMK_ID, myClient, keyCache);
+
+        ContentCryptoMaterial contentCryptoMaterial(ContentCryptoScheme::GCM);
+        ASSERT_TRUE(encryptionMaterials.EncryptCEK(contentCryptoMaterial).IsSuccess());
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            ContentCryptoMaterial encryptedContentCryptoMaterial;
+            encryptedContentCryptoMaterial.SetMaterialsDescription(contentCryptoMaterial.GetMaterialsDescription());
+            encryptedContentCryptoMaterial.SetKeyWrapAlgorithm(KeyWrapAlgorithm::KMS);
+            encryptedContentCryptoMaterial.SetEncryptedContentEncryptionKey(contentCryptoMaterial.GetEncryptedContentEncryptionKey());
+            ASSERT_TRUE(encryptionMaterials.DecryptCEK(encryptedContentCryptoMaterial).IsSuccess());
+            ASSERT_EQ(myClient->m_decryptedKey, encryptedContentCryptoMaterial.GetContentEncryptionKey());
+        }
+        ASSERT_EQ(myClient->m_decryptCalledCount, 1u);
+
+        //a different encryption context is a different entry.
+        ContentCryptoMaterial otherContextMaterial;
+        otherContextMaterial.SetMaterialsDescription(contentCryptoMaterial.GetMaterialsDescription());
+        otherContextMaterial.AddMaterialsDescription("purpose", "test");
+        otherContextMaterial.SetKeyWrapAlgorithm(KeyWrapAlgorithm::KMS);
+        otherContextMaterial.SetEncryptedContentEncryptionKey(contentCryptoMaterial.GetEncryptedContentEncryptionKey());
+        ASSERT_TRUE(encryptionMaterials.DecryptCEK(otherContextMaterial).IsSuccess());
+        ASSERT_EQ(myClient->m_decryptCalledCount, 2u);
+
+        //the cache can be shared between materials using the same master key.
+        KMSEncryptionMaterials otherMaterials(TEST_CMK_ID, myClient, keyCache);
+        ASSERT_TRUE(otherMaterials.DecryptCEK(otherContextMaterial).IsSuccess());
+        ASSERT_EQ(myClient->m_decryptCalledCount, 2u);
+    }
+
+    TEST_F(KMSEncryptionMaterialsTest, TestKeyCacheLimits)
+    {
+        CryptoBuffer encryptedKey = SymmetricCipher::GenerateKey();
+        CryptoBuffer contentEncryptionKey = SymmetricCipher::GenerateKey();
+        Aws::Map<Aws::String, Aws::String> encryptionContext = { { cmkID_Identifier, TEST_CMK_ID } };
+        CryptoBuffer cachedKey;
+
+        ContentEncryptionKeyCache usageLimitedCache(10u, std::chrono::minutes(5), 2u);
+        usageLimitedCache.Put(TEST_CMK_ID, encryptedKey, encryptionContext, contentEncryptionKey);
+        ASSERT_TRUE(usageLimitedCache.Get(TEST_CMK_ID, encryptedKey, encryptionContext, cachedKey));
+        ASSERT_EQ(contentEncryptionKey, cachedKey);
+        ASSERT_TRUE(usageLimitedCache.Get(TEST_CMK_ID, encryptedKey, encryptionContext, cachedKey));
+        ASSERT_FALSE(usageLimitedCache.Get(TEST_CMK_ID, encryptedKey, encryptionContext, cachedKey));
+        //adding the key again starts its count over.
+        usageLimitedCache.Put(TEST_CMK_ID, encryptedKey, encryptionContext, contentEncryptionKey);
+        ASSERT_TRUE(usageLimitedCache.Get(TEST_CMK_ID, encryptedKey, encryptionContext, cachedKey));
+
+        ContentEncryptionKeyCache expiredCache(10u, std::chrono::milliseconds(-1));
+        expiredCache.Put(TEST_CMK_ID, encryptedKey, encryptionContext, contentEncryptionKey);
+        ASSERT_FALSE(expiredCache.Get(TEST_CMK_ID, encryptedKey, encryptionContext, cachedKey));
+
+        ContentEncryptionKeyCache boundedCache(1u, std::chrono::minutes(5));
+        CryptoBuffer otherEncryptedKey = SymmetricCipher::GenerateKey();
+        boundedCache.Put(TEST_CMK_ID, encryptedKey, encryptionContext, contentEncryptionKey);
+        boundedCache.Put(TEST_CMK_ID, otherEncryptedKey, encryptionContext, contentEncryptionKey);
+        ASSERT_FALSE(boundedCache.Get(TEST_CMK_ID, encryptedKey, encryptionContext, cachedKey));
+        ASSERT_TRUE(boundedCache.Get(TEST_CMK_ID, otherEncryptedKey, encryptionContext, cachedKey));
+
+        //an entry added for one master key is not returned for another.
+        ContentEncryptionKeyCache sharedCache(10u, std::chrono::minutes(5));
+        sharedCache.Put(TEST_CMK_ID, encryptedKey, encryptionContext, contentEncryptionKey);
+        ASSERT_FALSE(sharedCache.Get("otherCmkId", encryptedKey, encryptionContext, cachedKey));
+        ASSERT_TRUE(sharedCache.Get(TEST_CMK_ID, encryptedKey, encryptionContext, cachedKey));
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
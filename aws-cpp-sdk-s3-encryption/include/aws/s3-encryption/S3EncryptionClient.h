@@ -18,6 +18,9 @@
 #include <aws/s3/S3Client.h>
 #include <aws/s3-encryption/modules/CryptoModuleFactory.h>
 #include <aws/core/client/AWSError.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+
+#include <mutex>
 
 namespace Aws
 {
@@ -56,6 +59,16 @@ namespace Aws
 
         typedef Aws::Utils::Outcome<Aws::S3::Model::PutObjectResult, AWSError<S3EncryptionErrors>> S3EncryptionPutObjectOutcome;
         typedef Aws::Utils::Outcome<Aws::S3::Model::GetObjectResult, AWSError<S3EncryptionErrors>> S3EncryptionGetObjectOutcome;
+        typedef Aws::Utils::Outcome<Aws::S3::Model::HeadObjectResult, AWSError<S3EncryptionErrors>> S3EncryptionHeadObjectOutcome;
+        typedef Aws::Utils::Outcome<Aws::S3::Model::CreateMultipartUploadResult, AWSError<S3EncryptionErrors>> S3EncryptionCreateMultipartUploadOutcome;
+        typedef Aws::Utils::Outcome<Aws::S3::Model::UploadPartResult, AWSError<S3EncryptionErrors>> S3EncryptionUploadPartOutcome;
+        typedef Aws::Utils::Outcome<Aws::S3::Model::CompleteMultipartUploadResult, AWSError<S3EncryptionErrors>> S3EncryptionCompleteMultipartUploadOutcome;
+        typedef Aws::Utils::Outcome<Aws::S3::Model::AbortMultipartUploadResult, AWSError<S3EncryptionErrors>> S3EncryptionAbortMultipartUploadOutcome;
+
+        namespace Modules
+        {
+            class MultipartUploadCryptoContext;
+        }
 
         class AWS_S3ENCRYPTION_API S3EncryptionClient
         {
@@ -81,6 +94,12 @@ namespace Aws
             S3EncryptionClient(const std::shared_ptr<Aws::Utils::Crypto::EncryptionMaterials>& encryptionMaterials, const Aws::S3Encryption::CryptoConfiguration& cryptoConfig,
                 const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider, const Client::ClientConfiguration& clientConfiguration = Client::ClientConfiguration());
 
+            /*
+            * Initialize the S3 Encryption Client with encryption materials, crypto configuration, and the S3 client to send the encrypted requests with.
+            */
+            S3EncryptionClient(const std::shared_ptr<Aws::Utils::Crypto::EncryptionMaterials>& encryptionMaterials, const Aws::S3Encryption::CryptoConfiguration& cryptoConfig,
+                const std::shared_ptr<S3Client>& s3Client);
+
             S3EncryptionClient(const S3EncryptionClient&) = delete;
             S3EncryptionClient& operator=(const S3EncryptionClient&) = delete;
 
@@ -94,18 +113,58 @@ namespace Aws
             */
             S3EncryptionGetObjectOutcome GetObject(const Aws::S3::Model::GetObjectRequest& request) const;
 
-            inline bool MultipartUploadSupported() const { return false; }
+            /*
+            * Function to get the metadata of an encrypted object. The content length is the length of the decrypted object.
+            */
+            S3EncryptionHeadObjectOutcome HeadObject(const Aws::S3::Model::HeadObjectRequest& request) const;
+
+            /*
+            * Function to start an encrypted multipart upload. The parts are encrypted independently of each other, so they can be uploaded in parallel,
+            * but every part except the last must be partSize bytes, a multiple of 16. The object is one AES-GCM message, readable with GetObject,
+            * so multipart uploads are not available in ENCRYPTION_ONLY mode.
+            *
+            * The upload has to be completed or aborted through this client: it holds the content encryption key and the hashes of the parts until then.
+            */
+            S3EncryptionCreateMultipartUploadOutcome CreateMultipartUpload(const Aws::S3::Model::CreateMultipartUploadRequest& request, uint64_t partSize) const;
+
+            /*
+            * Function to encrypt and upload a part of a multipart upload started with CreateMultipartUpload. A last part shorter than the part size
+            * is held back until the upload completes, and its result carries a placeholder ETag, which CompleteMultipartUpload replaces.
+            */
+            S3EncryptionUploadPartOutcome UploadPart(const Aws::S3::Model::UploadPartRequest& request) const;
+
+            /*
+            * Function to complete an encrypted multipart upload. Appends the crypto tag to the object, so the parts must be numbered 1 to N with no gaps.
+            */
+            S3EncryptionCompleteMultipartUploadOutcome CompleteMultipartUpload(const Aws::S3::Model::CompleteMultipartUploadRequest& request) const;
+
+            /*
+            * Function to abort an encrypted multipart upload and discard its crypto state.
+            */
+            S3EncryptionAbortMultipartUploadOutcome AbortMultipartUpload(const Aws::S3::Model::AbortMultipartUploadRequest& request) const;
+
+            inline bool MultipartUploadSupported() const { return m_cryptoConfig.GetCryptoMode() != CryptoMode::ENCRYPTION_ONLY; }
 
         private:
+            /*
+            * Function to read the content crypto material of an encrypted object from its metadata or its instruction file.
+            */
+            Aws::Utils::Outcome<ContentCryptoMaterial, AWSError<S3EncryptionErrors>> ReadContentCryptoMaterial(const Aws::S3::Model::GetObjectRequest& request,
+                const Aws::S3::Model::HeadObjectResult& headObjectResult) const;
+
+            std::shared_ptr<Modules::MultipartUploadCryptoContext> GetMultipartUploadContext(const Aws::String& uploadId) const;
+
             /*
             * Function to get the instruction file object of a encrypted object from S3. This instruction file object will be used to assist decryption.
             */
             Aws::S3::Model::GetObjectOutcome GetInstructionFileObject(const Aws::S3::Model::GetObjectRequest& originalGetRequest) const;
 
-            Aws::UniquePtr<S3Client> m_s3Client;
+            std::shared_ptr<S3Client> m_s3Client;
             Aws::S3Encryption::Modules::CryptoModuleFactory m_cryptoModuleFactory;
             std::shared_ptr<Aws::Utils::Crypto::EncryptionMaterials> m_encryptionMaterials;
             const Aws::S3Encryption::CryptoConfiguration m_cryptoConfig;
+            mutable std::mutex m_multipartUploadsLock;
+            mutable Aws::Map<Aws::String, std::shared_ptr<Modules::MultipartUploadCryptoContext>> m_multipartUploads;
         };
     }
 }
@@ -0,0 +1,72 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#pragma once
+
+#include <aws/s3-encryption/s3Encryption_EXPORTS.h>
+#include <aws/s3-encryption/S3EncryptionClient.h>
+#include <aws/s3/S3Client.h>
+
+namespace Aws
+{
+    namespace S3Encryption
+    {
+        /*
+        * An S3Client that sends object data through an S3EncryptionClient, so that it can be handed to TransferManager
+        * (TransferManagerConfiguration::s3Client) to upload and download client side encrypted objects, in parts and in parallel.
+        *
+        * partSize is the size of the parts of multipart uploads and must be the bufferSize of the TransferManagerConfiguration,
+        * and a multiple of 16. Parallel (ranged) downloads need objects encrypted with AES-GCM and an encryption client that isn't
+        * in STRICT_AUTHENTICATED_ENCRYPTION mode; other objects can only be downloaded when they fit in one buffer.
+        *
+        * Only the operations TransferManager uses to move object data are encrypted; every other operation goes to S3 as is,
+        * using the credentials and client configuration given here.
+        */
+        class AWS_S3ENCRYPTION_API S3EncryptionTransferClient : public Aws::S3::S3Client
+        {
+        public:
+            S3EncryptionTransferClient(const std::shared_ptr<S3EncryptionClient>& encryptionClient, uint64_t partSize,
+                const Aws::Client::ClientConfiguration& clientConfiguration = Aws::Client::ClientConfiguration());
+
+            S3EncryptionTransferClient(const std::shared_ptr<S3EncryptionClient>& encryptionClient, uint64_t partSize,
+                const std::shared_ptr<Aws::Auth::AWSCredentialsProvider>& credentialsProvider,
+                const Aws::Client::ClientConfiguration& clientConfiguration = Aws::Client::ClientConfiguration());
+
+            Aws::S3::Model::PutObjectOutcome PutObject(const Aws::S3::Model::PutObjectRequest& request) const override;
+
+            Aws::S3::Model::GetObjectOutcome GetObject(const Aws::S3::Model::GetObjectRequest& request) const override;
+
+            /*
+            * The content length of the result is that of the plaintext.
+            */
+            Aws::S3::Model::HeadObjectOutcome HeadObject(const Aws::S3::Model::HeadObjectRequest& request) const override;
+
+            Aws::S3::Model::CreateMultipartUploadOutcome CreateMultipartUpload(const Aws::S3::Model::CreateMultipartUploadRequest& request) const override;
+
+            Aws::S3::Model::UploadPartOutcome UploadPart(const Aws::S3::Model::UploadPartRequest& request) const override;
+
+            Aws::S3::Model::CompleteMultipartUploadOutcome CompleteMultipartUpload(const Aws::S3::Model::CompleteMultipartUploadRequest& request) const override;
+
+            Aws::S3::Model::AbortMultipartUploadOutcome AbortMultipartUpload(const Aws::S3::Model::AbortMultipartUploadRequest& request) const override;
+
+            bool MultipartUploadSupported() const override;
+
+            inline uint64_t GetPartSize() const { return m_partSize; }
+
+        private:
+            std::shared_ptr<S3EncryptionClient> m_encryptionClient;
+            uint64_t m_partSize;
+        };
+    }
+}
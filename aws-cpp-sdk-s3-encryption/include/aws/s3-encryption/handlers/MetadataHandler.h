@@ -16,6 +16,7 @@
 
 #include <aws/s3-encryption/handlers/MetadataHandler.h>
 #include <aws/s3-encryption/handlers/DataHandler.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
 
 namespace Aws
 {
@@ -35,6 +36,11 @@ namespace Aws
                 */
                 void PopulateRequest(Aws::S3::Model::PutObjectRequest& request, const Aws::Utils::Crypto::ContentCryptoMaterial& contentCryptoMaterial) override;
 
+                /*
+                * Write ContentCryptoMaterial data to a create multipart upload request. This occurs in place.
+                */
+                void PopulateRequest(Aws::S3::Model::CreateMultipartUploadRequest& request, const Aws::Utils::Crypto::ContentCryptoMaterial& contentCryptoMaterial);
+
                 /*
                 * Read the metadata of a GetObject result and store into a ContentCryptoMaterial Object.
                 */
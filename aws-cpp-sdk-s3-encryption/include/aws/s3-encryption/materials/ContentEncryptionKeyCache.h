@@ -0,0 +1,86 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#pragma once
+#include <aws/s3-encryption/s3Encryption_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/ConcurrentCache.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace Aws
+{
+    namespace S3Encryption
+    {
+        namespace Materials
+        {
+            /*
+            * Bounded cache of decrypted content encryption keys, keyed by the customer master key ID, the encrypted key and
+            * the encryption context it was encrypted with. Encryption materials that unwrap keys with a remote call (KMSEncryptionMaterials)
+            * use it to skip the call when the same key is read again, e.g. when many objects share one data key or one
+            * object is downloaded in ranges.
+            *
+            * An entry is used for at most timeToLive after it was added, and at most maxUses times if maxUses isn't 0.
+            * When the cache is full, expired entries are dropped first, then the one closest to expiring.
+            * Keys are zeroed when their entry is dropped or replaced. Safe to share between threads.
+            *
+            * A hit skips the remote call, and with it the check that the caller may use the master key. Only share a cache
+            * between materials that use the same credentials; a cache shared across principals would hand one of them keys
+            * that only another one was allowed to decrypt.
+            */
+            class AWS_S3ENCRYPTION_API ContentEncryptionKeyCache
+            {
+            public:
+                ContentEncryptionKeyCache(size_t maxEntries, std::chrono::milliseconds timeToLive, size_t maxUses = 0);
+
+                ContentEncryptionKeyCache(const ContentEncryptionKeyCache&) = delete;
+                ContentEncryptionKeyCache& operator=(const ContentEncryptionKeyCache&) = delete;
+
+                /*
+                * Copies the cached key for customerMasterKeyID, encryptedKey and encryptionContext to contentEncryptionKey
+                * and returns true, or returns false if there is no usable entry.
+                */
+                bool Get(const Aws::String& customerMasterKeyID, const Aws::Utils::CryptoBuffer& encryptedKey, const Aws::Map<Aws::String, Aws::String>& encryptionContext,
+                    Aws::Utils::CryptoBuffer& contentEncryptionKey) const;
+
+                /*
+                * Adds or replaces the entry for customerMasterKeyID, encryptedKey and encryptionContext.
+                */
+                void Put(const Aws::String& customerMasterKeyID, const Aws::Utils::CryptoBuffer& encryptedKey, const Aws::Map<Aws::String, Aws::String>& encryptionContext,
+                    const Aws::Utils::CryptoBuffer& contentEncryptionKey);
+
+            private:
+                struct Entry
+                {
+                    Entry(const Aws::Utils::CryptoBuffer& key) : contentEncryptionKey(key), uses(0) {}
+
+                    //CryptoBuffer zeroes its memory when destroyed.
+                    Aws::Utils::CryptoBuffer contentEncryptionKey;
+                    mutable std::atomic<size_t> uses;
+                };
+
+                static Aws::String BuildCacheKey(const Aws::String& customerMasterKeyID, const Aws::Utils::CryptoBuffer& encryptedKey,
+                     const Aws::Map<Aws::String, Aws::String>& encryptionContext);
+
+                Aws::Utils::ConcurrentCache<Aws::String, std::shared_ptr<const Entry>> m_cache;
+                std::chrono::milliseconds m_timeToLive;
+                size_t m_maxUses;
+            };
+        }//namespace Materials
+    }//namespace S3Encryption
+}//namespace Aws
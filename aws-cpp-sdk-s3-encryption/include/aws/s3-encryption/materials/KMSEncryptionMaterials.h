@@ -18,6 +18,7 @@
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/kms/KMSClient.h>
 #include <aws/s3-encryption/s3Encryption_EXPORTS.h>
+#include <aws/s3-encryption/materials/ContentEncryptionKeyCache.h>
 
 using namespace Aws::Utils::Crypto;
 
@@ -43,13 +44,16 @@ namespace Aws
                 /*
                 Initialize with customer master key ID and client configuration. If no configuration is supplied, then use the default.
                 Client configuration will be used to setup KMS Client.
+                If a key cache is supplied, decrypted content encryption keys are kept in it and DecryptCEK only calls KMS on a miss.
                 */
-                KMSEncryptionMaterials(const Aws::String& customerMasterKeyID, const Aws::Client::ClientConfiguration& clientConfig = Aws::Client::ClientConfiguration());
+                KMSEncryptionMaterials(const Aws::String& customerMasterKeyID, const Aws::Client::ClientConfiguration& clientConfig = Aws::Client::ClientConfiguration(),
+                    const std::shared_ptr<ContentEncryptionKeyCache>& keyCache = nullptr);
 
                 /*
-                Initialize with customer master key ID and KMS Client.
+                Initialize with customer master key ID and KMS Client, and optionally a cache of decrypted content encryption keys.
                 */
-                KMSEncryptionMaterials(const Aws::String& customerMasterKeyID, const std::shared_ptr<Aws::KMS::KMSClient>& kmsClient);
+                KMSEncryptionMaterials(const Aws::String& customerMasterKeyID, const std::shared_ptr<Aws::KMS::KMSClient>& kmsClient,
+                    const std::shared_ptr<ContentEncryptionKeyCache>& keyCache = nullptr);
 
                 /*
                 * This will encrypt the cek by calling to KMS. This will occur in place.
@@ -62,7 +66,7 @@ namespace Aws
                 /*
                 * This will decrypt the cek by calling to KMS. This will occur in place.
                 * It will check to make sure that the key wrap algorithm is KMS and that the materials description matches
-                * the identifier + customer master key ID. It will then decrypt.
+                * the identifier + customer master key ID. It will then decrypt, using the key cache first if there is one.
                 * A invalid customer master key ID will result in an empty content encryption key.
                 */
                 CryptoOutcome DecryptCEK(Aws::Utils::Crypto::ContentCryptoMaterial& contentCryptoMaterial) override;
@@ -70,6 +74,7 @@ namespace Aws
             private:
                 Aws::String m_customerMasterKeyID;
                 std::shared_ptr<Aws::KMS::KMSClient> m_kmsClient;
+                std::shared_ptr<ContentEncryptionKeyCache> m_keyCache;
             };
         }//namespace Materials
     }//namespace S3Encryption
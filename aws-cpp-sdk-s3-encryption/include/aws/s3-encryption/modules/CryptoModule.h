@@ -25,11 +25,13 @@
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3-encryption/S3EncryptionClient.h>
+#include <aws/s3-encryption/modules/MultipartUploadCryptoContext.h>
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/s3/model/PutObjectResult.h>
 #include <aws/s3/model/GetObjectResult.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadObjectRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
 
 namespace Aws
 {
@@ -39,6 +41,7 @@ namespace Aws
         {
             typedef std::function <Aws::S3::Model::PutObjectOutcome(const Aws::S3::Model::PutObjectRequest&)> PutObjectFunction;
             typedef std::function <Aws::S3::Model::GetObjectOutcome(const Aws::S3::Model::GetObjectRequest&)> GetObjectFunction;
+            typedef std::function <Aws::S3::Model::CreateMultipartUploadOutcome(const Aws::S3::Model::CreateMultipartUploadRequest&)> CreateMultipartUploadFunction;
 
             class AWS_S3ENCRYPTION_API CryptoModule
             {
@@ -65,6 +68,14 @@ namespace Aws
                 S3EncryptionGetObjectOutcome GetObjectSecurely(const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::HeadObjectResult& headObjectResult,
                     const Aws::Utils::Crypto::ContentCryptoMaterial& contentCryptoMaterial, const GetObjectFunction& getObjectFunction);
 
+                /*
+                * Function to start an encrypted multipart upload to S3. Only AES-GCM content can be uploaded in parts. On success, context is set to
+                * the state the parts of the upload are encrypted with; every part but the last must be partSize bytes, a multiple of 16.
+                */
+                S3EncryptionCreateMultipartUploadOutcome CreateMultipartUploadSecurely(const Aws::S3::Model::CreateMultipartUploadRequest& request, uint64_t partSize,
+                    const CreateMultipartUploadFunction& createMultipartUploadFunction, const PutObjectFunction& putObjectFunction,
+                    std::shared_ptr<MultipartUploadCryptoContext>& context);
+
                 /*
                 * Function to parse range of a get object request and return a pair containing the lower and upper bounds.
                 */
@@ -0,0 +1,91 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#pragma once
+
+#include <aws/s3-encryption/s3Encryption_EXPORTS.h>
+#include <aws/s3-encryption/S3EncryptionClient.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+
+#include <functional>
+#include <mutex>
+
+namespace Aws
+{
+    namespace S3Encryption
+    {
+        namespace Modules
+        {
+            typedef std::function <Aws::S3::Model::UploadPartOutcome(const Aws::S3::Model::UploadPartRequest&)> UploadPartFunction;
+            typedef std::function <Aws::S3::Model::CompleteMultipartUploadOutcome(const Aws::S3::Model::CompleteMultipartUploadRequest&)> CompleteMultipartUploadFunction;
+
+            /*
+            * State of one encrypted multipart upload, created by CryptoModule::CreateMultipartUploadSecurely.
+            *
+            * The object is a single AES-GCM message, so it decrypts like any other GCM object, but the parts are encrypted
+            * independently of each other so they can be sent in parallel: part n is AES-CTR from the GCM counter of its offset,
+            * (n - 1) * partSize, and the GHASH of its ciphertext is kept until the upload completes, when the hashes of all the
+            * parts are combined into the tag. Every part but the last must be partSize bytes.
+            *
+            * The tag has to end the object. A last part shorter than partSize is therefore held back and sent with the tag appended
+            * when the upload completes; otherwise the tag goes up as a part of its own. S3 allows at most 10,000 parts, so part
+            * 10,000 is always held back and carries the tag, even when it is full.
+            */
+            class AWS_S3ENCRYPTION_API MultipartUploadCryptoContext
+            {
+            public:
+                /*
+                * partSize must be a multiple of the AES block size. iv is the 12 byte GCM iv of the object.
+                */
+                MultipartUploadCryptoContext(const Aws::Utils::CryptoBuffer& contentEncryptionKey, const Aws::Utils::CryptoBuffer& iv, uint64_t partSize);
+
+                MultipartUploadCryptoContext(const MultipartUploadCryptoContext&) = delete;
+                MultipartUploadCryptoContext& operator=(const MultipartUploadCryptoContext&) = delete;
+
+                /*
+                * Encrypts the body of request and sends it with uploadPartFunction. Safe to call from several threads at once.
+                */
+                S3EncryptionUploadPartOutcome UploadPartSecurely(const Aws::S3::Model::UploadPartRequest& request, const UploadPartFunction& uploadPartFunction);
+
+                /*
+                * Computes the tag, sends the part that ends the object and completes the upload with completeMultipartUploadFunction.
+                * The parts listed in request must be numbered 1 to N with no gaps, and must have been sent through this context.
+                */
+                S3EncryptionCompleteMultipartUploadOutcome CompleteMultipartUploadSecurely(const Aws::S3::Model::CompleteMultipartUploadRequest& request,
+                    const UploadPartFunction& uploadPartFunction, const CompleteMultipartUploadFunction& completeMultipartUploadFunction);
+
+                inline uint64_t GetPartSize() const { return m_partSize; }
+
+            private:
+                struct PartHash
+                {
+                    Aws::Utils::CryptoBuffer hash;
+                    uint64_t length;
+                };
+
+                Aws::Utils::CryptoBuffer m_contentEncryptionKey;
+                Aws::Utils::CryptoBuffer m_firstCounter;
+                Aws::Utils::CryptoBuffer m_hashKey;
+                Aws::Utils::CryptoBuffer m_encryptedPreCounter;
+                uint64_t m_partSize;
+                std::mutex m_partsLock;
+                Aws::Map<int, PartHash> m_partHashes;
+                Aws::Map<int, Aws::Utils::CryptoBuffer> m_heldBackParts;
+            };
+        }
+    }
+}
@@ -14,7 +14,9 @@
 */
 #include <aws/s3-encryption/S3EncryptionClient.h>
 #include <aws/s3-encryption/modules/CryptoModule.h>
+#include <aws/s3-encryption/modules/MultipartUploadCryptoContext.h>
 #include <aws/s3/model/HeadObjectRequest.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
 #include <aws/core/utils/memory/stl/AWSAllocator.h>
 #include <aws/core/utils/logging/LogMacros.h>
 
@@ -29,19 +31,25 @@ namespace Aws
 
         S3EncryptionClient::S3EncryptionClient(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const Aws::S3Encryption::CryptoConfiguration& cryptoConfig,
             const Client::ClientConfiguration& clientConfiguration) :
-            m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
+            m_s3Client(Aws::MakeShared<S3Client>(ALLOCATION_TAG, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
         {
         }
 
         S3EncryptionClient::S3EncryptionClient(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const Aws::S3Encryption::CryptoConfiguration& cryptoConfig,
             const Auth::AWSCredentials& credentials, const Client::ClientConfiguration& clientConfiguration) :
-            m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, credentials, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
+            m_s3Client(Aws::MakeShared<S3Client>(ALLOCATION_TAG, credentials, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
         {
         }
 
         S3EncryptionClient::S3EncryptionClient(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials,
             const Aws::S3Encryption::CryptoConfiguration& cryptoConfig, const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider, const Client::ClientConfiguration& clientConfiguration) :
-            m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, credentialsProvider, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
+            m_s3Client(Aws::MakeShared<S3Client>(ALLOCATION_TAG, credentialsProvider, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
+        {
+        }
+
+        S3EncryptionClient::S3EncryptionClient(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials,
+            const Aws::S3Encryption::CryptoConfiguration& cryptoConfig, const std::shared_ptr<S3Client>& s3Client) :
+            m_s3Client(s3Client), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
         {
         }
 
@@ -66,30 +74,14 @@ namespace Aws
                 return S3EncryptionGetObjectOutcome(BuildS3EncryptionError(headOutcome.GetError()));
             }
 
-            auto headMetadata = headOutcome.GetResult().GetMetadata();
-            auto metadataEnd = headMetadata.end();
-            CryptoConfiguration decryptionCryptoConfig;
-            headMetadata.find(CONTENT_KEY_HEADER) != metadataEnd && headMetadata.find(IV_HEADER) != metadataEnd
-                ? decryptionCryptoConfig.SetStorageMethod(StorageMethod::METADATA)
-                : decryptionCryptoConfig.SetStorageMethod(StorageMethod::INSTRUCTION_FILE);
-
-            ContentCryptoMaterial contentCryptoMaterial;
-            if (decryptionCryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE)
+            auto materialOutcome = ReadContentCryptoMaterial(request, headOutcome.GetResult());
+            if (!materialOutcome.IsSuccess())
             {
-                GetObjectOutcome instructionOutcome = GetInstructionFileObject(request);
-                if (!instructionOutcome.IsSuccess())
-                {
-                    return S3EncryptionGetObjectOutcome(BuildS3EncryptionError(instructionOutcome.GetError()));
-                }
-                Handlers::InstructionFileHandler handler;
-                contentCryptoMaterial = handler.ReadContentCryptoMaterial(instructionOutcome.GetResult());
-            }
-            else
-            {
-                Handlers::MetadataHandler handler;
-                contentCryptoMaterial = handler.ReadContentCryptoMaterial(headOutcome.GetResult());
+                return S3EncryptionGetObjectOutcome(materialOutcome.GetError());
             }
+            const ContentCryptoMaterial& contentCryptoMaterial = materialOutcome.GetResult();
 
+            CryptoConfiguration decryptionCryptoConfig;
             if (contentCryptoMaterial.GetContentCryptoScheme() == ContentCryptoScheme::CBC)
             {
                 decryptionCryptoConfig.SetCryptoMode(CryptoMode::ENCRYPTION_ONLY);
@@ -101,13 +93,155 @@ namespace Aws
             }
             else
             {
-                assert(request.GetRange().empty());
                 decryptionCryptoConfig.SetCryptoMode(CryptoMode::STRICT_AUTHENTICATED_ENCRYPTION);
             }
 
             auto module = m_cryptoModuleFactory.FetchCryptoModule(m_encryptionMaterials, decryptionCryptoConfig);
             auto getObjectFunction = [this](const Aws::S3::Model::GetObjectRequest& getRequest) { return m_s3Client->GetObject(getRequest); };
-            return module->GetObjectSecurely(request, headOutcome.GetResult(), contentCryptoMaterial, getObjectFunction);
+            if (request.GetRange().empty() || decryptionCryptoConfig.GetCryptoMode() == CryptoMode::AUTHENTICATED_ENCRYPTION)
+            {
+                return module->GetObjectSecurely(request, headOutcome.GetResult(), contentCryptoMaterial, getObjectFunction);
+            }
+
+            //only GCM content can be decrypted from the middle, but a range covering the whole object (as TransferManager asks for
+            //objects that fit in one buffer) is just a get of the whole object.
+            int64_t contentLength = static_cast<int64_t>(headOutcome.GetResult().GetContentLength());
+            if (contentCryptoMaterial.GetContentCryptoScheme() == ContentCryptoScheme::GCM)
+            {
+                contentLength -= static_cast<int64_t>(contentCryptoMaterial.GetCryptoTagLength() / 8u);
+            }
+            auto range = Modules::CryptoModule::ParseGetObjectRequestRange(request.GetRange(), contentLength);
+            if (range.first != 0 || range.second + 1 < contentLength)
+            {
+                AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Range-Get Operations are only supported for AES-GCM objects in Authenticated Encryption mode.");
+                return S3EncryptionGetObjectOutcome(AWSError<S3EncryptionErrors>(S3Errors::INVALID_PARAMETER_VALUE, "InvalidParameterValue",
+                    "Range-Get Operations are only supported for AES-GCM objects in Authenticated Encryption mode", false));
+            }
+            GetObjectRequest wholeObjectRequest = request;
+            wholeObjectRequest.SetRange("");
+            return module->GetObjectSecurely(wholeObjectRequest, headOutcome.GetResult(), contentCryptoMaterial, getObjectFunction);
+        }
+
+        S3EncryptionHeadObjectOutcome S3EncryptionClient::HeadObject(const Aws::S3::Model::HeadObjectRequest& request) const
+        {
+            Aws::S3::Model::HeadObjectOutcome headOutcome = m_s3Client->HeadObject(request);
+            if (!headOutcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Head Request not successful: "
+                    << headOutcome.GetError().GetExceptionName() << " : "
+                    << headOutcome.GetError().GetMessage());
+                return S3EncryptionHeadObjectOutcome(BuildS3EncryptionError(headOutcome.GetError()));
+            }
+
+            GetObjectRequest getRequest;
+            getRequest.WithBucket(request.GetBucket());
+            getRequest.WithKey(request.GetKey());
+            auto materialOutcome = ReadContentCryptoMaterial(getRequest, headOutcome.GetResult());
+            if (!materialOutcome.IsSuccess())
+            {
+                return S3EncryptionHeadObjectOutcome(materialOutcome.GetError());
+            }
+
+            HeadObjectResult result = headOutcome.GetResultWithOwnership();
+            //the tag appended to GCM content isn't part of the object.
+            if (materialOutcome.GetResult().GetContentCryptoScheme() == ContentCryptoScheme::GCM)
+            {
+                result.SetContentLength(result.GetContentLength() - static_cast<long long>(materialOutcome.GetResult().GetCryptoTagLength() / 8u));
+            }
+            return S3EncryptionHeadObjectOutcome(std::move(result));
+        }
+
+        S3EncryptionCreateMultipartUploadOutcome S3EncryptionClient::CreateMultipartUpload(const Aws::S3::Model::CreateMultipartUploadRequest& request, uint64_t partSize) const
+        {
+            auto module = m_cryptoModuleFactory.FetchCryptoModule(m_encryptionMaterials, m_cryptoConfig);
+            auto createMultipartUploadFunction = [this](const Aws::S3::Model::CreateMultipartUploadRequest& createRequest) { return m_s3Client->CreateMultipartUpload(createRequest); };
+            auto putObjectFunction = [this](const Aws::S3::Model::PutObjectRequest& putRequest) { return m_s3Client->PutObject(putRequest); };
+            std::shared_ptr<Modules::MultipartUploadCryptoContext> context;
+            auto outcome = module->CreateMultipartUploadSecurely(request, partSize, createMultipartUploadFunction, putObjectFunction, context);
+            if (outcome.IsSuccess())
+            {
+                std::lock_guard<std::mutex> locker(m_multipartUploadsLock);
+                m_multipartUploads[outcome.GetResult().GetUploadId()] = context;
+            }
+            return outcome;
+        }
+
+        S3EncryptionUploadPartOutcome S3EncryptionClient::UploadPart(const Aws::S3::Model::UploadPartRequest& request) const
+        {
+            auto context = GetMultipartUploadContext(request.GetUploadId());
+            if (!context)
+            {
+                return S3EncryptionUploadPartOutcome(AWSError<S3EncryptionErrors>(S3Errors::NO_SUCH_UPLOAD, "NoSuchUpload",
+                    "The multipart upload was not started by this client", false));
+            }
+            auto uploadPartFunction = [this](const Aws::S3::Model::UploadPartRequest& partRequest) { return m_s3Client->UploadPart(partRequest); };
+            return context->UploadPartSecurely(request, uploadPartFunction);
+        }
+
+        S3EncryptionCompleteMultipartUploadOutcome S3EncryptionClient::CompleteMultipartUpload(const Aws::S3::Model::CompleteMultipartUploadRequest& request) const
+        {
+            auto context = GetMultipartUploadContext(request.GetUploadId());
+            if (!context)
+            {
+                return S3EncryptionCompleteMultipartUploadOutcome(AWSError<S3EncryptionErrors>(S3Errors::NO_SUCH_UPLOAD, "NoSuchUpload",
+                    "The multipart upload was not started by this client", false));
+            }
+            auto uploadPartFunction = [this](const Aws::S3::Model::UploadPartRequest& partRequest) { return m_s3Client->UploadPart(partRequest); };
+            auto completeMultipartUploadFunction = [this](const Aws::S3::Model::CompleteMultipartUploadRequest& completeRequest) { return m_s3Client->CompleteMultipartUpload(completeRequest); };
+            auto outcome = context->CompleteMultipartUploadSecurely(request, uploadPartFunction, completeMultipartUploadFunction);
+            if (outcome.IsSuccess())
+            {
+                std::lock_guard<std::mutex> locker(m_multipartUploadsLock);
+                m_multipartUploads.erase(request.GetUploadId());
+            }
+            return outcome;
+        }
+
+        S3EncryptionAbortMultipartUploadOutcome S3EncryptionClient::AbortMultipartUpload(const Aws::S3::Model::AbortMultipartUploadRequest& request) const
+        {
+            AbortMultipartUploadOutcome outcome = m_s3Client->AbortMultipartUpload(request);
+            if (!outcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Abort multipart upload operation not successful: "
+                    << outcome.GetError().GetExceptionName() << " : "
+                    << outcome.GetError().GetMessage());
+                return S3EncryptionAbortMultipartUploadOutcome(BuildS3EncryptionError(outcome.GetError()));
+            }
+            std::lock_guard<std::mutex> locker(m_multipartUploadsLock);
+            m_multipartUploads.erase(request.GetUploadId());
+            return S3EncryptionAbortMultipartUploadOutcome(outcome.GetResultWithOwnership());
+        }
+
+        Aws::Utils::Outcome<ContentCryptoMaterial, AWSError<S3EncryptionErrors>> S3EncryptionClient::ReadContentCryptoMaterial(const Aws::S3::Model::GetObjectRequest& request,
+            const Aws::S3::Model::HeadObjectResult& headObjectResult) const
+        {
+            const auto& headMetadata = headObjectResult.GetMetadata();
+            auto metadataEnd = headMetadata.end();
+            if (headMetadata.find(CONTENT_KEY_HEADER) != metadataEnd && headMetadata.find(IV_HEADER) != metadataEnd)
+            {
+                Handlers::MetadataHandler handler;
+                return handler.ReadContentCryptoMaterial(headObjectResult);
+            }
+
+            GetObjectOutcome instructionOutcome = GetInstructionFileObject(request);
+            if (!instructionOutcome.IsSuccess())
+            {
+                return BuildS3EncryptionError(instructionOutcome.GetError());
+            }
+            Handlers::InstructionFileHandler handler;
+            return handler.ReadContentCryptoMaterial(instructionOutcome.GetResult());
+        }
+
+        std::shared_ptr<Modules::MultipartUploadCryptoContext> S3EncryptionClient::GetMultipartUploadContext(const Aws::String& uploadId) const
+        {
+            std::lock_guard<std::mutex> locker(m_multipartUploadsLock);
+            auto context = m_multipartUploads.find(uploadId);
+            if (context == m_multipartUploads.end())
+            {
+                AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Multipart upload " << uploadId << " was not started by this client.");
+                return nullptr;
+            }
+            return context->second;
         }
 
         Aws::S3::Model::GetObjectOutcome S3EncryptionClient::GetInstructionFileObject(const Aws::S3::Model::GetObjectRequest & originalGetRequest) const
@@ -0,0 +1,92 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#include <aws/s3-encryption/S3EncryptionTransferClient.h>
+
+namespace Aws
+{
+    namespace S3Encryption
+    {
+        using namespace Aws::S3;
+        using namespace Aws::S3::Model;
+
+        template<typename OUTCOME_TYPE, typename ENCRYPTION_OUTCOME_TYPE>
+        static OUTCOME_TYPE BuildS3Outcome(ENCRYPTION_OUTCOME_TYPE&& outcome)
+        {
+            if (outcome.IsSuccess())
+            {
+                return OUTCOME_TYPE(outcome.GetResultWithOwnership());
+            }
+
+            const auto& error = outcome.GetError();
+            S3Errors errorType = error.GetErrorType().IsS3Error() ? error.GetErrorType().s3Error : S3Errors::UNKNOWN;
+            AWSError<S3Errors> s3Error(errorType, error.GetExceptionName(), error.GetMessage(), error.ShouldRetry());
+            s3Error.SetResponseCode(error.GetResponseCode());
+            s3Error.SetResponseHeaders(error.GetResponseHeaders());
+            return OUTCOME_TYPE(std::move(s3Error));
+        }
+
+        S3EncryptionTransferClient::S3EncryptionTransferClient(const std::shared_ptr<S3EncryptionClient>& encryptionClient, uint64_t partSize,
+            const Aws::Client::ClientConfiguration& clientConfiguration) :
+            S3Client(clientConfiguration), m_encryptionClient(encryptionClient), m_partSize(partSize)
+        {
+        }
+
+        S3EncryptionTransferClient::S3EncryptionTransferClient(const std::shared_ptr<S3EncryptionClient>& encryptionClient, uint64_t partSize,
+            const std::shared_ptr<Aws::Auth::AWSCredentialsProvider>& credentialsProvider, const Aws::Client::ClientConfiguration& clientConfiguration) :
+            S3Client(credentialsProvider, clientConfiguration), m_encryptionClient(encryptionClient), m_partSize(partSize)
+        {
+        }
+
+        PutObjectOutcome S3EncryptionTransferClient::PutObject(const PutObjectRequest& request) const
+        {
+            return BuildS3Outcome<PutObjectOutcome>(m_encryptionClient->PutObject(request));
+        }
+
+        GetObjectOutcome S3EncryptionTransferClient::GetObject(const GetObjectRequest& request) const
+        {
+            return BuildS3Outcome<GetObjectOutcome>(m_encryptionClient->GetObject(request));
+        }
+
+        HeadObjectOutcome S3EncryptionTransferClient::HeadObject(const HeadObjectRequest& request) const
+        {
+            return BuildS3Outcome<HeadObjectOutcome>(m_encryptionClient->HeadObject(request));
+        }
+
+        CreateMultipartUploadOutcome S3EncryptionTransferClient::CreateMultipartUpload(const CreateMultipartUploadRequest& request) const
+        {
+            return BuildS3Outcome<CreateMultipartUploadOutcome>(m_encryptionClient->CreateMultipartUpload(request, m_partSize));
+        }
+
+        UploadPartOutcome S3EncryptionTransferClient::UploadPart(const UploadPartRequest& request) const
+        {
+            return BuildS3Outcome<UploadPartOutcome>(m_encryptionClient->UploadPart(request));
+        }
+
+        CompleteMultipartUploadOutcome S3EncryptionTransferClient::CompleteMultipartUpload(const CompleteMultipartUploadRequest& request) const
+        {
+            return BuildS3Outcome<CompleteMultipartUploadOutcome>(m_encryptionClient->CompleteMultipartUpload(request));
+        }
+
+        AbortMultipartUploadOutcome S3EncryptionTransferClient::AbortMultipartUpload(const AbortMultipartUploadRequest& request) const
+        {
+            return BuildS3Outcome<AbortMultipartUploadOutcome>(m_encryptionClient->AbortMultipartUpload(request));
+        }
+
+        bool S3EncryptionTransferClient::MultipartUploadSupported() const
+        {
+            return m_encryptionClient->MultipartUploadSupported();
+        }
+    }
+}
@@ -50,6 +50,16 @@ namespace Aws
                 request.AddMetadata(KEY_WRAP_ALGORITHM, GetNameForKeyWrapAlgorithm(keyWrapAlgorithm));
             }
 
+            void MetadataHandler::PopulateRequest(Aws::S3::Model::CreateMultipartUploadRequest& request, const ContentCryptoMaterial& contentCryptoMaterial)
+            {
+                PutObjectRequest metadataRequest;
+                PopulateRequest(metadataRequest, contentCryptoMaterial);
+                for (const auto& entry : metadataRequest.GetMetadata())
+                {
+                    request.AddMetadata(entry.first, entry.second);
+                }
+            }
+
             ContentCryptoMaterial MetadataHandler::ReadContentCryptoMaterial(Aws::S3::Model::GetObjectResult& result)
             {
                 Aws::Map<Aws::String, Aws::String> metadata = result.GetMetadata();
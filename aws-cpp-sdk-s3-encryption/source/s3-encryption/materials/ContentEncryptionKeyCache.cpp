@@ -0,0 +1,72 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#include <aws/s3-encryption/materials/ContentEncryptionKeyCache.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Utils;
+
+namespace Aws
+{
+    namespace S3Encryption
+    {
+        namespace Materials
+        {
+            static const char* const ALLOCATION_TAG = "ContentEncryptionKeyCache";
+
+            ContentEncryptionKeyCache::ContentEncryptionKeyCache(size_t maxEntries, std::chrono::milliseconds timeToLive, size_t maxUses) :
+                m_cache(maxEntries), m_timeToLive(timeToLive), m_maxUses(maxUses)
+            {
+            }
+
+            bool ContentEncryptionKeyCache::Get(const Aws::String& customerMasterKeyID, const CryptoBuffer& encryptedKey, const Aws::Map<Aws::String, Aws::String>& encryptionContext,
+                CryptoBuffer& contentEncryptionKey) const
+            {
+                std::shared_ptr<const Entry> entry;
+                if (!m_cache.Get(BuildCacheKey(customerMasterKeyID, encryptedKey, encryptionContext), entry))
+                {
+                    return false;
+                }
+                //a used up entry stays until it is replaced by the next Put for the same key or pruned.
+                if (m_maxUses > 0 && entry->uses.fetch_add(1) >= m_maxUses)
+                {
+                    return false;
+                }
+                contentEncryptionKey = entry->contentEncryptionKey;
+                return true;
+            }
+
+            void ContentEncryptionKeyCache::Put(const Aws::String& customerMasterKeyID, const CryptoBuffer& encryptedKey, const Aws::Map<Aws::String, Aws::String>& encryptionContext,
+                const CryptoBuffer& contentEncryptionKey)
+            {
+                m_cache.Put(BuildCacheKey(customerMasterKeyID, encryptedKey, encryptionContext), std::shared_ptr<const Entry>(Aws::MakeShared<Entry>(ALLOCATION_TAG, contentEncryptionKey)), m_timeToLive);
+            }
+
+            Aws::String ContentEncryptionKeyCache::BuildCacheKey(const Aws::String& customerMasterKeyID, const CryptoBuffer& encryptedKey,
+                const Aws::Map<Aws::String, Aws::String>& encryptionContext)
+            {
+                //every part is length prefixed, so no two different inputs give the same key. The map is ordered.
+                Aws::String cacheKey = StringUtils::to_string(customerMasterKeyID.size()) + ":" + customerMasterKeyID;
+                cacheKey += StringUtils::to_string(encryptedKey.GetLength()) + ":";
+                cacheKey.append(reinterpret_cast<const char*>(encryptedKey.GetUnderlyingData()), encryptedKey.GetLength());
+                for (const auto& pair : encryptionContext)
+                {
+                    cacheKey += StringUtils::to_string(pair.first.size()) + ":" + pair.first;
+                    cacheKey += StringUtils::to_string(pair.second.size()) + ":" + pair.second;
+                }
+                return cacheKey;
+            }
+        }//namespace Materials
+    }//namespace S3Encryption
+}//namespace Aws
@@ -24,13 +24,15 @@ namespace Aws
             static const char* const ALLOCATION_TAG = "KMSEncryptionMaterials";
             const char* cmkID_Identifier = "kms_cmk_id";
 
-            KMSEncryptionMaterials::KMSEncryptionMaterials(const String& customerMasterKeyID, const ClientConfiguration& clientConfig) :
-                m_customerMasterKeyID(customerMasterKeyID), m_kmsClient(Aws::MakeShared<KMSClient>(ALLOCATION_TAG, clientConfig))
+            KMSEncryptionMaterials::KMSEncryptionMaterials(const String& customerMasterKeyID, const ClientConfiguration& clientConfig,
+                const std::shared_ptr<ContentEncryptionKeyCache>& keyCache) :
+                m_customerMasterKeyID(customerMasterKeyID), m_kmsClient(Aws::MakeShared<KMSClient>(ALLOCATION_TAG, clientConfig)), m_keyCache(keyCache)
             {
             }
 
-            KMSEncryptionMaterials::KMSEncryptionMaterials(const String & customerMasterKeyID, const std::shared_ptr<KMSClient>& kmsClient) :
-                m_customerMasterKeyID(customerMasterKeyID), m_kmsClient(kmsClient)
+            KMSEncryptionMaterials::KMSEncryptionMaterials(const String & customerMasterKeyID, const std::shared_ptr<KMSClient>& kmsClient,
+                const std::shared_ptr<ContentEncryptionKeyCache>& keyCache) :
+                m_customerMasterKeyID(customerMasterKeyID), m_kmsClient(kmsClient), m_keyCache(keyCache)
             {
             }
 
@@ -85,6 +87,13 @@ namespace Aws
                     return errorOutcome;
                 }
 
+                CryptoBuffer cachedContentEncryptionKey;
+                if (m_keyCache && m_keyCache->Get(m_customerMasterKeyID, encryptedContentEncryptionKey, materialDescription, cachedContentEncryptionKey))
+                {
+                    contentCryptoMaterial.SetContentEncryptionKey(cachedContentEncryptionKey);
+                    return CryptoOutcome(Aws::NoResult());
+                }
+
                 DecryptRequest request;
                 request.SetEncryptionContext(contentCryptoMaterial.GetMaterialsDescription());
                 request.SetCiphertextBlob(encryptedContentEncryptionKey);
@@ -104,6 +113,10 @@ namespace Aws
                     AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Content Encryption Key could not be decrypted.");
                     return errorOutcome;
                 }
+                if (m_keyCache)
+                {
+                    m_keyCache->Put(m_customerMasterKeyID, encryptedContentEncryptionKey, materialDescription, contentCryptoMaterial.GetContentEncryptionKey());
+                }
                 return CryptoOutcome(Aws::NoResult());
             }
 
@@ -80,6 +80,65 @@ namespace Aws
                 return WrapAndMakeRequestWithCipher(copyRequest, putObjectFunction);
             }
 
+            S3EncryptionCreateMultipartUploadOutcome CryptoModule::CreateMultipartUploadSecurely(const Aws::S3::Model::CreateMultipartUploadRequest& request, uint64_t partSize,
+                const CreateMultipartUploadFunction& createMultipartUploadFunction, const PutObjectFunction& putObjectFunction,
+                std::shared_ptr<MultipartUploadCryptoContext>& context)
+            {
+                CreateMultipartUploadRequest copyRequest(request);
+                PopulateCryptoContentMaterial();
+                if (m_contentCryptoMaterial.GetContentCryptoScheme() != ContentCryptoScheme::GCM)
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Multipart uploads can only be encrypted with AES-GCM. Use Authenticated Encryption or Strict Authenticated Encryption.");
+                    return S3EncryptionCreateMultipartUploadOutcome(AWSError<S3EncryptionErrors>(Aws::S3::S3Errors::INVALID_PARAMETER_VALUE, "InvalidParameterValue",
+                        "Multipart uploads can only be encrypted with AES-GCM", false));
+                }
+                if (partSize == 0 || partSize % AES_BLOCK_SIZE != 0)
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "The part size of an encrypted multipart upload must be a multiple of " << AES_BLOCK_SIZE << " bytes.");
+                    return S3EncryptionCreateMultipartUploadOutcome(AWSError<S3EncryptionErrors>(Aws::S3::S3Errors::INVALID_PARAMETER_VALUE, "InvalidParameterValue",
+                        "The part size must be a multiple of the AES block size", false));
+                }
+                m_contentCryptoMaterial.SetIV(SymmetricCipher::GenerateIV(GCM_IV_SIZE));
+                auto encryptOutcome = m_encryptionMaterials->EncryptCEK(m_contentCryptoMaterial);
+                if (!encryptOutcome.IsSuccess())
+                {
+                    return S3EncryptionCreateMultipartUploadOutcome(BuildS3EncryptionError(encryptOutcome.GetError()));
+                }
+
+                if (m_cryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE)
+                {
+                    Handlers::InstructionFileHandler handler;
+                    PutObjectRequest instructionFileRequest;
+                    instructionFileRequest.WithBucket(copyRequest.GetBucket());
+                    instructionFileRequest.WithKey(copyRequest.GetKey());
+                    handler.PopulateRequest(instructionFileRequest, m_contentCryptoMaterial);
+                    PutObjectOutcome instructionOutcome = putObjectFunction(instructionFileRequest);
+                    if (!instructionOutcome.IsSuccess())
+                    {
+                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Instruction file put operation not successful: "
+                            << instructionOutcome.GetError().GetExceptionName() << " : "
+                            << instructionOutcome.GetError().GetMessage());
+                        return S3EncryptionCreateMultipartUploadOutcome(BuildS3EncryptionError(instructionOutcome.GetError()));
+                    }
+                }
+                else
+                {
+                    Handlers::MetadataHandler handler;
+                    handler.PopulateRequest(copyRequest, m_contentCryptoMaterial);
+                }
+
+                CreateMultipartUploadOutcome outcome = createMultipartUploadFunction(copyRequest);
+                if (!outcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 create multipart upload operation not successful: "
+                        << outcome.GetError().GetExceptionName() << " : "
+                        << outcome.GetError().GetMessage());
+                    return S3EncryptionCreateMultipartUploadOutcome(BuildS3EncryptionError(outcome.GetError()));
+                }
+                context = Aws::MakeShared<MultipartUploadCryptoContext>(ALLOCATION_TAG, m_contentCryptoMaterial.GetContentEncryptionKey(), m_contentCryptoMaterial.GetIV(), partSize);
+                return S3EncryptionCreateMultipartUploadOutcome(outcome.GetResultWithOwnership());
+            }
+
             S3EncryptionGetObjectOutcome CryptoModule::GetObjectSecurely(const Aws::S3::Model::GetObjectRequest& request,
                 const Aws::S3::Model::HeadObjectResult& headObjectResult, const ContentCryptoMaterial& contentCryptoMaterial, const GetObjectFunction& getObjectFunction)
             {
@@ -301,7 +360,7 @@ namespace Aws
                     counter[3] = 0x02;
                     CryptoBuffer gcmToCtrIv({ (ByteBuffer*)&m_contentCryptoMaterial.GetIV(), (ByteBuffer*)&counter });
                     m_cipher = CreateAES_CTRImplementation(m_contentCryptoMaterial.GetContentEncryptionKey(),
-                        IncrementCTRCounter(gcmToCtrIv, static_cast<int32_t>(rangeStart / static_cast<int64_t>(AES_BLOCK_SIZE))));
+                        IncrementCTRCounter(gcmToCtrIv, static_cast<uint32_t>(rangeStart / static_cast<int64_t>(AES_BLOCK_SIZE))));
                 }
                 else
                 {
@@ -0,0 +1,453 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#include <aws/s3-encryption/modules/MultipartUploadCryptoContext.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/s3/model/CompletedMultipartUpload.h>
+
+using namespace Aws::S3;
+using namespace Aws::S3::Model;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+using namespace Aws::Client;
+
+namespace Aws
+{
+    namespace S3Encryption
+    {
+        namespace Modules
+        {
+            static const char* const ALLOCATION_TAG = "MultipartUploadCryptoContext";
+            static const size_t GCM_IV_SIZE = 12u;
+            static const size_t AES_BLOCK_SIZE = 16u;
+            static const uint64_t MAX_GCM_BLOCKS = 0xFFFFFFFEull;
+            //S3 numbers the parts of an upload from 1 to 10,000.
+            static const int MAX_PART_NUMBER = 10000;
+
+            namespace
+            {
+                //a GF(2^128) element in the bit order of SP 800-38D: hi holds the first 8 bytes, big endian.
+                struct Block
+                {
+                    uint64_t hi;
+                    uint64_t lo;
+                };
+
+                Block LoadBlock(const unsigned char* bytes)
+                {
+                    Block block = { 0, 0 };
+                    for (size_t i = 0; i < 8; ++i)
+                    {
+                        block.hi = (block.hi << 8) | bytes[i];
+                        block.lo = (block.lo << 8) | bytes[i + 8];
+                    }
+                    return block;
+                }
+
+                void StoreBlock(const Block& block, unsigned char* bytes)
+                {
+                    for (size_t i = 0; i < 8; ++i)
+                    {
+                        bytes[7 - i] = static_cast<unsigned char>(block.hi >> (8 * i));
+                        bytes[15 - i] = static_cast<unsigned char>(block.lo >> (8 * i));
+                    }
+                }
+
+                //x * y, algorithm 1 of SP 800-38D. Only used to combine the part hashes, so it doesn't need to be fast.
+                Block Multiply(const Block& x, const Block& y)
+                {
+                    Block z = { 0, 0 };
+                    Block v = y;
+                    for (unsigned i = 0; i < 128; ++i)
+                    {
+                        uint64_t bit = i < 64 ? (x.hi >> (63 - i)) & 1 : (x.lo >> (127 - i)) & 1;
+                        if (bit)
+                        {
+                            z.hi ^= v.hi;
+                            z.lo ^= v.lo;
+                        }
+                        bool carry = (v.lo & 1) != 0;
+                        v.lo = (v.lo >> 1) | (v.hi << 63);
+                        v.hi >>= 1;
+                        if (carry)
+                        {
+                            v.hi ^= 0xE100000000000000ull;
+                        }
+                    }
+                    return z;
+                }
+
+                Block Power(const Block& x, uint64_t exponent)
+                {
+                    Block result = { 0x8000000000000000ull, 0 };
+                    Block square = x;
+                    for (; exponent; exponent >>= 1)
+                    {
+                        if (exponent & 1)
+                        {
+                            result = Multiply(result, square);
+                        }
+                        square = Multiply(square, square);
+                    }
+                    return result;
+                }
+
+                /*
+                * GHASH with a fixed hash key, using Shoup's 4 bit tables so that hashing a part costs about as much as encrypting it.
+                */
+                class GHash
+                {
+                public:
+                    GHash(const Block& hashKey)
+                    {
+                        //index 8 (binary 1000) is 1 in GF(2^128), so it holds the key itself; 4, 2 and 1 hold it times x, x^2 and x^3.
+                        m_high[0] = m_low[0] = 0;
+                        m_high[8] = hashKey.hi;
+                        m_low[8] = hashKey.lo;
+                        uint64_t high = hashKey.hi;
+                        uint64_t low = hashKey.lo;
+                        for (unsigned i = 4; i > 0; i >>= 1)
+                        {
+                            uint64_t reduction = (low & 1) ? 0xE100000000000000ull : 0;
+                            low = (high << 63) | (low >> 1);
+                            high = (high >> 1) ^ reduction;
+                            m_high[i] = high;
+                            m_low[i] = low;
+                        }
+                        for (unsigned i = 2; i <= 8; i *= 2)
+                        {
+                            for (unsigned j = 1; j < i; ++j)
+                            {
+                                m_high[i + j] = m_high[i] ^ m_high[j];
+                                m_low[i + j] = m_low[i] ^ m_low[j];
+                            }
+                        }
+                    }
+
+                    //GHASH of data from a zero state, zero padding a trailing partial block.
+                    Block Hash(const unsigned char* data, size_t length) const
+                    {
+                        Block state = { 0, 0 };
+                        unsigned char block[AES_BLOCK_SIZE];
+                        for (size_t offset = 0; offset < length; offset += AES_BLOCK_SIZE)
+                        {
+                            size_t blockLength = (std::min)(AES_BLOCK_SIZE, length - offset);
+                            StoreBlock(state, block);
+                            for (size_t i = 0; i < blockLength; ++i)
+                            {
+                                block[i] ^= data[offset + i];
+                            }
+                            state = MultiplyByKey(block);
+                        }
+                        return state;
+                    }
+
+                private:
+                    Block MultiplyByKey(const unsigned char* x) const
+                    {
+                        static const uint64_t REMAINDERS[16] = {
+                            0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+                            0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+                        };
+
+                        unsigned char nibble = x[15] & 0x0F;
+                        uint64_t high = m_high[nibble];
+                        uint64_t low = m_low[nibble];
+                        for (int i = 15; i >= 0; --i)
+                        {
+                            if (i != 15)
+                            {
+                                nibble = x[i] & 0x0F;
+                                unsigned remainder = low & 0x0F;
+                                low = (high << 60) | (low >> 4);
+                                high = (high >> 4) ^ (REMAINDERS[remainder] << 48) ^ m_high[nibble];
+                                low ^= m_low[nibble];
+                            }
+                            nibble = x[i] >> 4;
+                            unsigned remainder = low & 0x0F;
+                            low = (high << 60) | (low >> 4);
+                            high = (high >> 4) ^ (REMAINDERS[remainder] << 48) ^ m_high[nibble];
+                            low ^= m_low[nibble];
+                        }
+                        Block product = { high, low };
+                        return product;
+                    }
+
+                    uint64_t m_high[16];
+                    uint64_t m_low[16];
+                };
+
+                //encrypts one block of zeros in CTR mode from counter, which gives the block cipher applied to counter.
+                CryptoBuffer EncryptCounter(const CryptoBuffer& key, const CryptoBuffer& counter)
+                {
+                    auto cipher = CreateAES_CTRImplementation(key, counter);
+                    CryptoBuffer zeros(AES_BLOCK_SIZE);
+                    zeros.Zero();
+                    CryptoBuffer encrypted = cipher->EncryptBuffer(zeros);
+                    CryptoBuffer finalBlock = cipher->FinalizeEncryption();
+                    return CryptoBuffer({ (ByteBuffer*)&encrypted, (ByteBuffer*)&finalBlock });
+                }
+
+                AWSError<S3EncryptionErrors> BuildInvalidParameterError(const Aws::String& message)
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, message);
+                    return AWSError<S3EncryptionErrors>(S3Errors::INVALID_PARAMETER_VALUE, "InvalidParameterValue", message, false);
+                }
+            }
+
+            MultipartUploadCryptoContext::MultipartUploadCryptoContext(const CryptoBuffer& contentEncryptionKey, const CryptoBuffer& iv, uint64_t partSize) :
+                m_contentEncryptionKey(contentEncryptionKey), m_partSize(partSize)
+            {
+                assert(iv.GetLength() == GCM_IV_SIZE);
+                assert(partSize > 0 && partSize % AES_BLOCK_SIZE == 0);
+                AWS_UNREFERENCED_PARAM(GCM_IV_SIZE);
+
+                //see SP 800-38D: with a 96 bit iv the pre-counter block is iv || 1, and the message is encrypted from iv || 2 on.
+                CryptoBuffer counter(4);
+                counter.Zero();
+                counter[3] = 0x01;
+                CryptoBuffer preCounter({ (ByteBuffer*)&iv, (ByteBuffer*)&counter });
+                m_encryptedPreCounter = EncryptCounter(m_contentEncryptionKey, preCounter);
+                m_firstCounter = IncrementCTRCounter(preCounter, 1);
+
+                CryptoBuffer zeros(AES_BLOCK_SIZE);
+                zeros.Zero();
+                m_hashKey = EncryptCounter(m_contentEncryptionKey, zeros);
+            }
+
+            S3EncryptionUploadPartOutcome MultipartUploadCryptoContext::UploadPartSecurely(const UploadPartRequest& request, const UploadPartFunction& uploadPartFunction)
+            {
+                int partNumber = request.GetPartNumber();
+                if (partNumber < 1 || partNumber > MAX_PART_NUMBER)
+                {
+                    return S3EncryptionUploadPartOutcome(BuildInvalidParameterError("Part numbers of an encrypted multipart upload run from 1 to "
+                        + StringUtils::to_string(MAX_PART_NUMBER) + "."));
+                }
+
+                CryptoBuffer plaintext;
+                std::shared_ptr<Aws::IOStream> body = request.GetBody();
+                if (body)
+                {
+                    body->seekg(0, std::ios_base::end);
+                    size_t length = static_cast<size_t>(body->tellg());
+                    body->seekg(0, std::ios_base::beg);
+                    plaintext = CryptoBuffer(length);
+                    body->read(reinterpret_cast<char*>(plaintext.GetUnderlyingData()), length);
+                }
+                if (plaintext.GetLength() > m_partSize)
+                {
+                    return S3EncryptionUploadPartOutcome(BuildInvalidParameterError("Part " + StringUtils::to_string(partNumber) + " is larger than the part size of the upload, "
+                        + StringUtils::to_string(m_partSize) + " bytes."));
+                }
+
+                uint64_t firstBlock = static_cast<uint64_t>(partNumber - 1) * m_partSize / AES_BLOCK_SIZE;
+                auto cipher = CreateAES_CTRImplementation(m_contentEncryptionKey, IncrementCTRCounter(m_firstCounter, static_cast<uint32_t>(firstBlock)));
+                CryptoBuffer encrypted = cipher->EncryptBuffer(plaintext);
+                CryptoBuffer finalBlock = cipher->FinalizeEncryption();
+                CryptoBuffer ciphertext({ (ByteBuffer*)&encrypted, (ByteBuffer*)&finalBlock });
+                if (!*cipher || ciphertext.GetLength() != plaintext.GetLength())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Failed to encrypt part " << partNumber << " of upload " << request.GetUploadId());
+                    return S3EncryptionUploadPartOutcome(AWSError<S3EncryptionErrors>(S3Errors::INTERNAL_FAILURE, "EncryptionFailed", "Failed to encrypt the part", false));
+                }
+
+                Block hash = GHash(LoadBlock(m_hashKey.GetUnderlyingData())).Hash(ciphertext.GetUnderlyingData(), ciphertext.GetLength());
+                PartHash partHash;
+                partHash.hash = CryptoBuffer(AES_BLOCK_SIZE);
+                StoreBlock(hash, partHash.hash.GetUnderlyingData());
+                partHash.length = ciphertext.GetLength();
+
+                if (ciphertext.GetLength() < m_partSize || partNumber == MAX_PART_NUMBER)
+                {
+                    //this can only be the last part; it goes up with the tag. A full last part is held back too when the tag
+                    //can't follow it as a part of its own.
+                    std::lock_guard<std::mutex> locker(m_partsLock);
+                    m_partHashes[partNumber] = partHash;
+                    m_heldBackParts[partNumber] = ciphertext;
+                    AWS_LOGSTREAM_DEBUG(ALLOCATION_TAG, "Holding back part " << partNumber << " of upload " << request.GetUploadId() << " until the upload completes.");
+                    UploadPartResult result;
+                    result.SetETag(HashingUtils::HexEncode(partHash.hash));
+                    return S3EncryptionUploadPartOutcome(std::move(result));
+                }
+
+                UploadPartRequest encryptedRequest(request);
+                Aws::Utils::Stream::PreallocatedStreamBuf streamBuf(ciphertext.GetUnderlyingData(), ciphertext.GetLength());
+                encryptedRequest.SetBody(Aws::MakeShared<Aws::IOStream>(ALLOCATION_TAG, &streamBuf));
+                encryptedRequest.SetContentLength(static_cast<long long>(ciphertext.GetLength()));
+                if (request.ContentMD5HasBeenSet())
+                {
+                    encryptedRequest.SetContentMD5(HashingUtils::Base64Encode(HashingUtils::CalculateMD5(*encryptedRequest.GetBody())));
+                    encryptedRequest.GetBody()->clear();
+                    encryptedRequest.GetBody()->seekg(0, std::ios_base::beg);
+                }
+
+                UploadPartOutcome outcome = uploadPartFunction(encryptedRequest);
+                if (!outcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 upload part operation not successful: "
+                        << outcome.GetError().GetExceptionName() << " : "
+                        << outcome.GetError().GetMessage());
+                    return S3EncryptionUploadPartOutcome(BuildS3EncryptionError(outcome.GetError()));
+                }
+
+                std::lock_guard<std::mutex> locker(m_partsLock);
+                m_partHashes[partNumber] = partHash;
+                m_heldBackParts.erase(partNumber);
+                return S3EncryptionUploadPartOutcome(outcome.GetResultWithOwnership());
+            }
+
+            S3EncryptionCompleteMultipartUploadOutcome MultipartUploadCryptoContext::CompleteMultipartUploadSecurely(const CompleteMultipartUploadRequest& request,
+                const UploadPartFunction& uploadPartFunction, const CompleteMultipartUploadFunction& completeMultipartUploadFunction)
+            {
+                Aws::Vector<CompletedPart> parts = request.GetMultipartUpload().GetParts();
+                if (parts.empty())
+                {
+                    return S3EncryptionCompleteMultipartUploadOutcome(BuildInvalidParameterError("An encrypted multipart upload needs at least one part."));
+                }
+
+                Aws::Map<int, PartHash> partHashes;
+                Aws::Map<int, CryptoBuffer> heldBackParts;
+                {
+                    std::lock_guard<std::mutex> locker(m_partsLock);
+                    partHashes = m_partHashes;
+                    heldBackParts = m_heldBackParts;
+                }
+
+                //the hash of the whole ciphertext is the hashes of the parts, each one multiplied by the hash key once for every block after it.
+                Block hashKey = LoadBlock(m_hashKey.GetUnderlyingData());
+                Block fullPartMultiplier = Power(hashKey, m_partSize / AES_BLOCK_SIZE);
+                Block hash = { 0, 0 };
+                uint64_t totalLength = 0;
+                for (size_t i = 0; i < parts.size(); ++i)
+                {
+                    int partNumber = static_cast<int>(i + 1);
+                    if (parts[i].GetPartNumber() != partNumber)
+                    {
+                        return S3EncryptionCompleteMultipartUploadOutcome(BuildInvalidParameterError("The parts of an encrypted multipart upload must be numbered 1 to N with no gaps."));
+                    }
+                    auto partHash = partHashes.find(partNumber);
+                    if (partHash == partHashes.end())
+                    {
+                        return S3EncryptionCompleteMultipartUploadOutcome(BuildInvalidParameterError("Part " + StringUtils::to_string(partNumber) + " was not uploaded through this client."));
+                    }
+                    bool lastPart = i + 1 == parts.size();
+                    if (!lastPart && partHash->second.length != m_partSize)
+                    {
+                        return S3EncryptionCompleteMultipartUploadOutcome(BuildInvalidParameterError("Every part of an encrypted multipart upload but the last must be "
+                            + StringUtils::to_string(m_partSize) + " bytes."));
+                    }
+
+                    uint64_t blocks = (partHash->second.length + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE;
+                    Block partBlock = LoadBlock(partHash->second.hash.GetUnderlyingData());
+                    hash = Multiply(hash, partHash->second.length == m_partSize ? fullPartMultiplier : Power(hashKey, blocks));
+                    hash.hi ^= partBlock.hi;
+                    hash.lo ^= partBlock.lo;
+                    totalLength += partHash->second.length;
+                }
+
+                if ((totalLength + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE > MAX_GCM_BLOCKS)
+                {
+                    return S3EncryptionCompleteMultipartUploadOutcome(BuildInvalidParameterError("The object is larger than AES-GCM can encrypt with one key and iv."));
+                }
+                int lastPartNumber = static_cast<int>(parts.size());
+                for (const auto& heldBackPart : heldBackParts)
+                {
+                    if (heldBackPart.first != lastPartNumber)
+                    {
+                        return S3EncryptionCompleteMultipartUploadOutcome(BuildInvalidParameterError("Part " + StringUtils::to_string(heldBackPart.first)
+                            + " can only be the last part, it is shorter than the part size or the highest part number S3 allows."));
+                    }
+                }
+
+                //the last block hashed is the bit lengths of the additional data, none, and of the ciphertext.
+                Block lengths = { 0, totalLength * 8 };
+                hash.hi ^= lengths.hi;
+                hash.lo ^= lengths.lo;
+                hash = Multiply(hash, hashKey);
+                CryptoBuffer tag(AES_BLOCK_SIZE);
+                StoreBlock(hash, tag.GetUnderlyingData());
+                for (size_t i = 0; i < AES_BLOCK_SIZE; ++i)
+                {
+                    tag[i] ^= m_encryptedPreCounter[i];
+                }
+
+                UploadPartRequest finalPartRequest;
+                finalPartRequest.SetCustomizedAccessLogTag(request.GetCustomizedAccessLogTag());
+                finalPartRequest.WithBucket(request.GetBucket())
+                    .WithKey(request.GetKey())
+                    .WithUploadId(request.GetUploadId());
+                if (request.RequestPayerHasBeenSet())
+                {
+                    finalPartRequest.SetRequestPayer(request.GetRequestPayer());
+                }
+
+                auto heldBackPart = heldBackParts.find(lastPartNumber);
+                CryptoBuffer finalPart;
+                if (heldBackPart != heldBackParts.end())
+                {
+                    finalPartRequest.SetPartNumber(lastPartNumber);
+                    finalPart = CryptoBuffer({ (ByteBuffer*)&heldBackPart->second, (ByteBuffer*)&tag });
+                }
+                else
+                {
+                    finalPartRequest.SetPartNumber(lastPartNumber + 1);
+                    finalPart = tag;
+                }
+                Aws::Utils::Stream::PreallocatedStreamBuf streamBuf(finalPart.GetUnderlyingData(), finalPart.GetLength());
+                finalPartRequest.SetBody(Aws::MakeShared<Aws::IOStream>(ALLOCATION_TAG, &streamBuf));
+                finalPartRequest.SetContentLength(static_cast<long long>(finalPart.GetLength()));
+
+                UploadPartOutcome finalPartOutcome = uploadPartFunction(finalPartRequest);
+                if (!finalPartOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 upload part operation for the crypto tag not successful: "
+                        << finalPartOutcome.GetError().GetExceptionName() << " : "
+                        << finalPartOutcome.GetError().GetMessage());
+                    return S3EncryptionCompleteMultipartUploadOutcome(BuildS3EncryptionError(finalPartOutcome.GetError()));
+                }
+
+                CompletedPart finalCompletedPart;
+                finalCompletedPart.WithPartNumber(finalPartRequest.GetPartNumber())
+                    .WithETag(finalPartOutcome.GetResult().GetETag());
+                if (heldBackPart != heldBackParts.end())
+                {
+                    parts.back() = finalCompletedPart;
+                }
+                else
+                {
+                    parts.push_back(finalCompletedPart);
+                }
+
+                CompleteMultipartUploadRequest completeRequest(request);
+                CompletedMultipartUpload completedUpload(request.GetMultipartUpload());
+                completedUpload.SetParts(std::move(parts));
+                completeRequest.SetMultipartUpload(std::move(completedUpload));
+
+                CompleteMultipartUploadOutcome outcome = completeMultipartUploadFunction(completeRequest);
+                if (!outcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 complete multipart upload operation not successful: "
+                        << outcome.GetError().GetExceptionName() << " : "
+                        << outcome.GetError().GetMessage());
+                    return S3EncryptionCompleteMultipartUploadOutcome(BuildS3EncryptionError(outcome.GetError()));
+                }
+                return S3EncryptionCompleteMultipartUploadOutcome(outcome.GetResultWithOwnership());
+            }
+        }
+    }
+}
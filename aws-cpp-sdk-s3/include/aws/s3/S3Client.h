@@ -2967,6 +2967,13 @@ namespace Aws
 
         virtual bool MultipartUploadSupported() const;
 
+        using AWSXMLClient::WarmUp;
+        /**
+         * Opens up to connections connections to the endpoint requests for bucketName go to, which with virtual
+         * addressing is a host of its own, ahead of traffic. Returns the number of connections that were opened.
+         */
+        size_t WarmUp(const Aws::String& bucketName, size_t connections) const;
+
         void OverrideEndpoint(const Aws::String& endpoint);
     private:
         void init(const Client::ClientConfiguration& clientConfiguration);
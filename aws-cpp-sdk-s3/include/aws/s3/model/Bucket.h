@@ -26,6 +26,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -44,6 +45,8 @@ namespace Model
     Bucket();
     Bucket(const Aws::Utils::Xml::XmlNode& xmlNode);
     Bucket& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Bucket(Aws::Utils::Xml::XmlReader& xmlReader);
+    Bucket& operator=(Aws::Utils::Xml::XmlReader& xmlReader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -25,6 +25,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -43,6 +44,8 @@ namespace Model
     CommonPrefix();
     CommonPrefix(const Aws::Utils::Xml::XmlNode& xmlNode);
     CommonPrefix& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    CommonPrefix(Aws::Utils::Xml::XmlReader& xmlReader);
+    CommonPrefix& operator=(Aws::Utils::Xml::XmlReader& xmlReader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -30,7 +30,12 @@ namespace Utils
 namespace Xml
 {
   class XmlDocument;
+  class XmlReader;
 } // namespace Xml
+namespace Stream
+{
+  class ResponseStream;
+} // namespace Stream
 } // namespace Utils
 namespace S3
 {
@@ -42,6 +47,16 @@ namespace Model
     ListBucketsResult();
     ListBucketsResult(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     ListBucketsResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    /**
+     * Decodes the response body straight from the stream, without building a DOM.
+     */
+    ListBucketsResult(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result);
+    ListBucketsResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result);
+    /**
+     * Decodes the response body from xmlReader. A malformed or truncated body leaves this result partly
+     * filled, so check xmlReader.WasParseSuccessful() before using it.
+     */
+    ListBucketsResult(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result, Aws::Utils::Xml::XmlReader& xmlReader);
 
 
     /**
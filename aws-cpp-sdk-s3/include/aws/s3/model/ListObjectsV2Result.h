@@ -32,7 +32,12 @@ namespace Utils
 namespace Xml
 {
   class XmlDocument;
+  class XmlReader;
 } // namespace Xml
+namespace Stream
+{
+  class ResponseStream;
+} // namespace Stream
 } // namespace Utils
 namespace S3
 {
@@ -44,6 +49,16 @@ namespace Model
     ListObjectsV2Result();
     ListObjectsV2Result(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     ListObjectsV2Result& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    /**
+     * Decodes the response body straight from the stream, without building a DOM.
+     */
+    ListObjectsV2Result(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result);
+    ListObjectsV2Result& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result);
+    /**
+     * Decodes the response body from xmlReader. A malformed or truncated body leaves this result partly
+     * filled, so check xmlReader.WasParseSuccessful() before using it.
+     */
+    ListObjectsV2Result(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result, Aws::Utils::Xml::XmlReader& xmlReader);
 
 
     /**
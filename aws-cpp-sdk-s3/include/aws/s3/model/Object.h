@@ -28,6 +28,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -46,6 +47,8 @@ namespace Model
     Object();
     Object(const Aws::Utils::Xml::XmlNode& xmlNode);
     Object& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Object(Aws::Utils::Xml::XmlReader& xmlReader);
+    Object& operator=(Aws::Utils::Xml::XmlReader& xmlReader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
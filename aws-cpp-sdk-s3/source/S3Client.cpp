@@ -22,6 +22,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/DNS.h>
@@ -175,6 +176,7 @@ void S3Client::init(const ClientConfiguration& config)
   {
       OverrideEndpoint(config.endpointOverride);
   }
+  SetWarmUpEndpoint(m_scheme + "://" + m_baseUri);
 }
 
 void S3Client::OverrideEndpoint(const Aws::String& endpoint)
@@ -194,6 +196,7 @@ void S3Client::OverrideEndpoint(const Aws::String& endpoint)
       m_scheme = m_configScheme;
       m_baseUri = endpoint;
   }
+  SetWarmUpEndpoint(m_scheme + "://" + m_baseUri);
 }
 
 AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartUploadRequest& request) const
@@ -2376,10 +2379,17 @@ ListBucketsOutcome S3Client::ListBuckets() const
 {
   Aws::StringStream ss;
   ss << ComputeEndpointString();
-  XmlOutcome outcome = MakeRequest(ss.str(), HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, "ListBuckets");
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, "ListBuckets");
   if(outcome.IsSuccess())
   {
-    return ListBucketsOutcome(ListBucketsResult(outcome.GetResult()));
+    Aws::Utils::Xml::XmlReader xmlReader(outcome.GetResult().GetPayload().GetUnderlyingStream());
+    ListBucketsResult result(outcome.GetResult(), xmlReader);
+    if(!xmlReader.WasParseSuccessful())
+    {
+      AWS_LOGSTREAM_ERROR("ListBuckets", "Xml parsing failed with message " << xmlReader.GetErrorMessage());
+      return ListBucketsOutcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::UNKNOWN, "Xml Parse Error", xmlReader.GetErrorMessage(), false));
+    }
+    return ListBucketsOutcome(std::move(result));
   }
   else
   {
@@ -2535,10 +2545,17 @@ ListObjectsV2Outcome S3Client::ListObjectsV2(const ListObjectsV2Request& request
   Aws::StringStream ss;
   ss.str("?list-type=2");
   uri.SetQueryString(ss.str());
-  XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
-    return ListObjectsV2Outcome(ListObjectsV2Result(outcome.GetResult()));
+    Aws::Utils::Xml::XmlReader xmlReader(outcome.GetResult().GetPayload().GetUnderlyingStream());
+    ListObjectsV2Result result(outcome.GetResult(), xmlReader);
+    if(!xmlReader.WasParseSuccessful())
+    {
+      AWS_LOGSTREAM_ERROR("ListObjectsV2", "Xml parsing failed with message " << xmlReader.GetErrorMessage());
+      return ListObjectsV2Outcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::UNKNOWN, "Xml Parse Error", xmlReader.GetErrorMessage(), false));
+    }
+    return ListObjectsV2Outcome(std::move(result));
   }
   else
   {
@@ -3918,3 +3935,8 @@ bool S3Client::MultipartUploadSupported() const
 {
     return true;
 }
+
+size_t S3Client::WarmUp(const Aws::String& bucketName, size_t connections) const
+{
+    return GetHttpClient()->WarmUp(ComputeEndpointString(bucketName), connections);
+}
@@ -15,6 +15,7 @@
 
 #include <aws/s3/model/Bucket.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -66,6 +67,37 @@ Bucket& Bucket::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Bucket::Bucket(XmlReader& xmlReader) : 
+    m_nameHasBeenSet(false),
+    m_creationDateHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+Bucket& Bucket::operator =(XmlReader& xmlReader)
+{
+  Aws::String elementName;
+  while(xmlReader.NextElement(elementName))
+  {
+    if(elementName == "Name")
+    {
+      m_name = xmlReader.ReadText();
+      m_nameHasBeenSet = true;
+    }
+    else if(elementName == "CreationDate")
+    {
+      m_creationDate = DateTime(StringUtils::Trim(xmlReader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationDateHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
+
 void Bucket::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -15,8 +15,11 @@
 
 #include <aws/s3/model/ListBucketsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #include <utility>
 
@@ -61,3 +64,49 @@ ListBucketsResult& ListBucketsResult::operator =(const Aws::AmazonWebServiceResu
 
   return *this;
 }
+
+ListBucketsResult::ListBucketsResult(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result)
+{
+  *this = result;
+}
+
+ListBucketsResult& ListBucketsResult::operator =(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result)
+{
+  XmlReader xmlReader(result.GetPayload().GetUnderlyingStream());
+  return *this = ListBucketsResult(result, xmlReader);
+}
+
+ListBucketsResult::ListBucketsResult(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result, XmlReader& xmlReader)
+{
+  Aws::String elementName;
+  if(xmlReader.NextElement(elementName))
+  {
+    while(xmlReader.NextElement(elementName))
+    {
+      if(elementName == "Buckets")
+      {
+        while(xmlReader.NextElement(elementName))
+        {
+          if(elementName == "Bucket")
+          {
+            m_buckets.push_back(Bucket(xmlReader));
+          }
+          else
+          {
+            xmlReader.SkipElement();
+          }
+        }
+      }
+      else if(elementName == "Owner")
+      {
+        m_owner = xmlReader;
+      }
+      else
+      {
+        xmlReader.SkipElement();
+      }
+    }
+  }
+
+  AWS_UNREFERENCED_PARAM(result);
+}
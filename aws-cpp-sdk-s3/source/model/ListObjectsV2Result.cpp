@@ -15,8 +15,11 @@
 
 #include <aws/s3/model/ListObjectsV2Result.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #include <utility>
 
@@ -125,3 +128,87 @@ ListObjectsV2Result& ListObjectsV2Result::operator =(const Aws::AmazonWebService
 
   return *this;
 }
+
+ListObjectsV2Result::ListObjectsV2Result(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result) : 
+    m_isTruncated(false),
+    m_maxKeys(0),
+    m_encodingType(EncodingType::NOT_SET),
+    m_keyCount(0)
+{
+  *this = result;
+}
+
+ListObjectsV2Result& ListObjectsV2Result::operator =(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result)
+{
+  XmlReader xmlReader(result.GetPayload().GetUnderlyingStream());
+  return *this = ListObjectsV2Result(result, xmlReader);
+}
+
+ListObjectsV2Result::ListObjectsV2Result(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result, XmlReader& xmlReader) : 
+    m_isTruncated(false),
+    m_maxKeys(0),
+    m_encodingType(EncodingType::NOT_SET),
+    m_keyCount(0)
+{
+  Aws::String elementName;
+  if(xmlReader.NextElement(elementName))
+  {
+    while(xmlReader.NextElement(elementName))
+    {
+      if(elementName == "IsTruncated")
+      {
+        m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(xmlReader.ReadText().c_str()).c_str());
+      }
+      else if(elementName == "Contents")
+      {
+        m_contents.push_back(Object(xmlReader));
+      }
+      else if(elementName == "Name")
+      {
+        m_name = xmlReader.ReadText();
+      }
+      else if(elementName == "Prefix")
+      {
+        m_prefix = xmlReader.ReadText();
+      }
+      else if(elementName == "Delimiter")
+      {
+        m_delimiter = xmlReader.ReadText();
+      }
+      else if(elementName == "MaxKeys")
+      {
+        m_maxKeys = StringUtils::ConvertToInt32(StringUtils::Trim(xmlReader.ReadText().c_str()).c_str());
+      }
+      else if(elementName == "CommonPrefixes")
+      {
+        m_commonPrefixes.push_back(CommonPrefix(xmlReader));
+      }
+      else if(elementName == "EncodingType")
+      {
+        m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(StringUtils::Trim(xmlReader.ReadText().c_str()));
+      }
+      else if(elementName == "KeyCount")
+      {
+        m_keyCount = StringUtils::ConvertToInt32(StringUtils::Trim(xmlReader.ReadText().c_str()).c_str());
+      }
+      else if(elementName == "ContinuationToken")
+      {
+        m_continuationToken = xmlReader.ReadText();
+      }
+      else if(elementName == "NextContinuationToken")
+      {
+        m_nextContinuationToken = xmlReader.ReadText();
+      }
+      else if(elementName == "StartAfter")
+      {
+        m_startAfter = xmlReader.ReadText();
+      }
+      else
+      {
+        xmlReader.SkipElement();
+      }
+    }
+  }
+
+  AWS_UNREFERENCED_PARAM(result);
+}
@@ -15,6 +15,7 @@
 
 #include <aws/s3/model/Object.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -102,6 +103,63 @@ Object& Object::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Object::Object(XmlReader& xmlReader) : 
+    m_keyHasBeenSet(false),
+    m_lastModifiedHasBeenSet(false),
+    m_eTagHasBeenSet(false),
+    m_size(0),
+    m_sizeHasBeenSet(false),
+    m_storageClass(ObjectStorageClass::NOT_SET),
+    m_storageClassHasBeenSet(false),
+    m_ownerHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+Object& Object::operator =(XmlReader& xmlReader)
+{
+  Aws::String elementName;
+  while(xmlReader.NextElement(elementName))
+  {
+    if(elementName == "Key")
+    {
+      m_key = xmlReader.ReadText();
+      m_keyHasBeenSet = true;
+    }
+    else if(elementName == "LastModified")
+    {
+      m_lastModified = DateTime(StringUtils::Trim(xmlReader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastModifiedHasBeenSet = true;
+    }
+    else if(elementName == "ETag")
+    {
+      m_eTag = xmlReader.ReadText();
+      m_eTagHasBeenSet = true;
+    }
+    else if(elementName == "Size")
+    {
+      m_size = StringUtils::ConvertToInt64(StringUtils::Trim(xmlReader.ReadText().c_str()).c_str());
+      m_sizeHasBeenSet = true;
+    }
+    else if(elementName == "StorageClass")
+    {
+      m_storageClass = ObjectStorageClassMapper::GetObjectStorageClassForName(StringUtils::Trim(xmlReader.ReadText().c_str()));
+      m_storageClassHasBeenSet = true;
+    }
+    else if(elementName == "Owner")
+    {
+      m_owner = xmlReader;
+      m_ownerHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
+
 void Object::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -15,6 +15,7 @@
 
 #include <aws/s3/model/Owner.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -66,6 +67,37 @@ Owner& Owner::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Owner::Owner(XmlReader& xmlReader) : 
+    m_displayNameHasBeenSet(false),
+    m_iDHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+Owner& Owner::operator =(XmlReader& xmlReader)
+{
+  Aws::String elementName;
+  while(xmlReader.NextElement(elementName))
+  {
+    if(elementName == "DisplayName")
+    {
+      m_displayName = xmlReader.ReadText();
+      m_displayNameHasBeenSet = true;
+    }
+    else if(elementName == "ID")
+    {
+      m_iD = xmlReader.ReadText();
+      m_iDHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
+
 void Owner::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
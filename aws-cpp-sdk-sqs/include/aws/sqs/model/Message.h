@@ -29,6 +29,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace SQS
@@ -47,6 +48,8 @@ namespace Model
     Message();
     Message(const Aws::Utils::Xml::XmlNode& xmlNode);
     Message& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Message(Aws::Utils::Xml::XmlReader& xmlReader);
+    Message& operator=(Aws::Utils::Xml::XmlReader& xmlReader);
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
@@ -28,6 +28,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace SQS
@@ -53,6 +54,8 @@ namespace Model
     MessageAttributeValue();
     MessageAttributeValue(const Aws::Utils::Xml::XmlNode& xmlNode);
     MessageAttributeValue& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    MessageAttributeValue(Aws::Utils::Xml::XmlReader& xmlReader);
+    MessageAttributeValue& operator=(Aws::Utils::Xml::XmlReader& xmlReader);
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
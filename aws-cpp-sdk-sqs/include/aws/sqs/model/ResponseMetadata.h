@@ -26,6 +26,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace SQS
@@ -39,6 +40,8 @@ namespace Model
     ResponseMetadata();
     ResponseMetadata(const Aws::Utils::Xml::XmlNode& xmlNode);
     ResponseMetadata& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ResponseMetadata(Aws::Utils::Xml::XmlReader& xmlReader);
+    ResponseMetadata& operator=(Aws::Utils::Xml::XmlReader& xmlReader);
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
@@ -22,6 +22,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/DNS.h>
@@ -541,10 +542,17 @@ void SQSClient::PurgeQueueAsyncHelper(const PurgeQueueRequest& request, const Pu
 
 ReceiveMessageOutcome SQSClient::ReceiveMessage(const ReceiveMessageRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
-    return ReceiveMessageOutcome(ReceiveMessageResult(outcome.GetResult()));
+    Aws::Utils::Xml::XmlReader xmlReader(outcome.GetResult().GetPayload().GetUnderlyingStream());
+    ReceiveMessageResult result(outcome.GetResult(), xmlReader);
+    if(!xmlReader.WasParseSuccessful())
+    {
+      AWS_LOGSTREAM_ERROR("ReceiveMessage", "Xml parsing failed with message " << xmlReader.GetErrorMessage());
+      return ReceiveMessageOutcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::UNKNOWN, "Xml Parse Error", xmlReader.GetErrorMessage(), false));
+    }
+    return ReceiveMessageOutcome(std::move(result));
   }
   else
   {
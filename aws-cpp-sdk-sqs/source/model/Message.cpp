@@ -15,6 +15,7 @@
 
 #include <aws/sqs/model/Message.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -124,6 +125,101 @@ Message& Message::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Message::Message(XmlReader& xmlReader) : 
+    m_messageIdHasBeenSet(false),
+    m_receiptHandleHasBeenSet(false),
+    m_mD5OfBodyHasBeenSet(false),
+    m_bodyHasBeenSet(false),
+    m_attributesHasBeenSet(false),
+    m_mD5OfMessageAttributesHasBeenSet(false),
+    m_messageAttributesHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+Message& Message::operator =(XmlReader& xmlReader)
+{
+  Aws::String elementName;
+  while(xmlReader.NextElement(elementName))
+  {
+    if(elementName == "MessageId")
+    {
+      m_messageId = xmlReader.ReadText();
+      m_messageIdHasBeenSet = true;
+    }
+    else if(elementName == "ReceiptHandle")
+    {
+      m_receiptHandle = xmlReader.ReadText();
+      m_receiptHandleHasBeenSet = true;
+    }
+    else if(elementName == "MD5OfBody")
+    {
+      m_mD5OfBody = xmlReader.ReadText();
+      m_mD5OfBodyHasBeenSet = true;
+    }
+    else if(elementName == "Body")
+    {
+      m_body = xmlReader.ReadText();
+      m_bodyHasBeenSet = true;
+    }
+    else if(elementName == "Attribute")
+    {
+      MessageSystemAttributeName key{};
+      Aws::String value{};
+      while(xmlReader.NextElement(elementName))
+      {
+        if(elementName == "Name")
+        {
+          key = MessageSystemAttributeNameMapper::GetMessageSystemAttributeNameForName(StringUtils::Trim(xmlReader.ReadText().c_str()));
+        }
+        else if(elementName == "Value")
+        {
+          value = xmlReader.ReadText();
+        }
+        else
+        {
+          xmlReader.SkipElement();
+        }
+      }
+      m_attributes[std::move(key)] = std::move(value);
+      m_attributesHasBeenSet = true;
+    }
+    else if(elementName == "MD5OfMessageAttributes")
+    {
+      m_mD5OfMessageAttributes = xmlReader.ReadText();
+      m_mD5OfMessageAttributesHasBeenSet = true;
+    }
+    else if(elementName == "MessageAttribute")
+    {
+      Aws::String key{};
+      MessageAttributeValue value{};
+      while(xmlReader.NextElement(elementName))
+      {
+        if(elementName == "Name")
+        {
+          key = xmlReader.ReadText();
+        }
+        else if(elementName == "Value")
+        {
+          value = xmlReader;
+        }
+        else
+        {
+          xmlReader.SkipElement();
+        }
+      }
+      m_messageAttributes[std::move(key)] = std::move(value);
+      m_messageAttributesHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
+
 void Message::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_messageIdHasBeenSet)
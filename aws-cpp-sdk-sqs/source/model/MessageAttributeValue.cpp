@@ -15,6 +15,7 @@
 
 #include <aws/sqs/model/MessageAttributeValue.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/HashingUtils.h>
@@ -102,6 +103,55 @@ MessageAttributeValue& MessageAttributeValue::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+MessageAttributeValue::MessageAttributeValue(XmlReader& xmlReader) : 
+    m_stringValueHasBeenSet(false),
+    m_binaryValueHasBeenSet(false),
+    m_stringListValuesHasBeenSet(false),
+    m_binaryListValuesHasBeenSet(false),
+    m_dataTypeHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+MessageAttributeValue& MessageAttributeValue::operator =(XmlReader& xmlReader)
+{
+  Aws::String elementName;
+  while(xmlReader.NextElement(elementName))
+  {
+    if(elementName == "StringValue")
+    {
+      m_stringValue = xmlReader.ReadText();
+      m_stringValueHasBeenSet = true;
+    }
+    else if(elementName == "BinaryValue")
+    {
+      m_binaryValue = HashingUtils::Base64Decode(xmlReader.ReadText());
+      m_binaryValueHasBeenSet = true;
+    }
+    else if(elementName == "StringListValue")
+    {
+      m_stringListValues.push_back(xmlReader.ReadText());
+      m_stringListValuesHasBeenSet = true;
+    }
+    else if(elementName == "BinaryListValue")
+    {
+      m_binaryListValues.push_back(HashingUtils::Base64Decode(xmlReader.ReadText()));
+      m_binaryListValuesHasBeenSet = true;
+    }
+    else if(elementName == "DataType")
+    {
+      m_dataType = xmlReader.ReadText();
+      m_dataTypeHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
+
 void MessageAttributeValue::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_stringValueHasBeenSet)
@@ -15,9 +15,12 @@
 
 #include <aws/sqs/model/ReceiveMessageResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #include <utility>
 
@@ -68,3 +71,66 @@ ReceiveMessageResult& ReceiveMessageResult::operator =(const Aws::AmazonWebServi
   }
   return *this;
 }
+
+ReceiveMessageResult::ReceiveMessageResult(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result)
+{
+  *this = result;
+}
+
+ReceiveMessageResult& ReceiveMessageResult::operator =(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result)
+{
+  XmlReader xmlReader(result.GetPayload().GetUnderlyingStream());
+  return *this = ReceiveMessageResult(result, xmlReader);
+}
+
+ReceiveMessageResult::ReceiveMessageResult(const Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>& result, XmlReader& xmlReader)
+{
+  Aws::String elementName;
+  if(xmlReader.NextElement(elementName) && elementName != "ReceiveMessageResult")
+  {
+    //the result sits inside a response element, next to the response metadata.
+    while(xmlReader.NextElement(elementName) && elementName != "ReceiveMessageResult")
+    {
+      if(elementName == "ResponseMetadata")
+      {
+        m_responseMetadata = xmlReader;
+      }
+      else
+      {
+        xmlReader.SkipElement();
+      }
+    }
+  }
+
+  if(elementName == "ReceiveMessageResult")
+  {
+    while(xmlReader.NextElement(elementName))
+    {
+      if(elementName == "Message")
+      {
+        m_messages.push_back(Message(xmlReader));
+      }
+      else if(elementName == "ResponseMetadata")
+      {
+        m_responseMetadata = xmlReader;
+      }
+      else
+      {
+        xmlReader.SkipElement();
+      }
+    }
+    while(xmlReader.NextElement(elementName))
+    {
+      if(elementName == "ResponseMetadata")
+      {
+        m_responseMetadata = xmlReader;
+      }
+      else
+      {
+        xmlReader.SkipElement();
+      }
+    }
+  }
+  AWS_LOGSTREAM_DEBUG("Aws::SQS::Model::ReceiveMessageResult", "x-amzn-request-id: " << m_responseMetadata.GetRequestId() );
+  AWS_UNREFERENCED_PARAM(result);
+}
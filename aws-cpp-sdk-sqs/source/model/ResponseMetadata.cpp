@@ -15,6 +15,7 @@
 
 #include <aws/sqs/model/ResponseMetadata.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -58,6 +59,31 @@ ResponseMetadata& ResponseMetadata::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ResponseMetadata::ResponseMetadata(XmlReader& xmlReader) : 
+    m_requestIdHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+ResponseMetadata& ResponseMetadata::operator =(XmlReader& xmlReader)
+{
+  Aws::String elementName;
+  while(xmlReader.NextElement(elementName))
+  {
+    if(elementName == "RequestId")
+    {
+      m_requestId = xmlReader.ReadText();
+      m_requestIdHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+
+  return *this;
+}
+
 void ResponseMetadata::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_requestIdHasBeenSet)
@@ -46,12 +46,13 @@ namespace Aws
          */
         struct TransferManagerConfiguration
         {
-            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5)
+            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5), memoryMapUploadFiles(false)
             {
             }
 
             /**
              * S3 Client to use for transfers. You are responsible for setting this.
+             * For client side encrypted transfers, use an Aws::S3Encryption::S3EncryptionTransferClient whose part size is bufferSize.
              */
             std::shared_ptr<Aws::S3::S3Client> s3Client;
             /**
@@ -86,6 +87,14 @@ namespace Aws
              * to increase your max heap size if this is something you plan on increasing.
              */
             uint64_t bufferSize;
+            /**
+             * Defaults to false. If true, multi-part uploads of files given by name (UploadFile(fileName, ...), RetryUpload and UploadDirectory) map each part
+             * of the file into memory and send it from there, instead of copying it into a transfer buffer. Each part in flight still holds a transfer buffer,
+             * so transferBufferMaxHeapSize / bufferSize limits how many parts are mapped at once, the same as without mapping.
+             * The file must not be truncated during the upload.
+             * If a part can't be mapped, the rest of the upload falls back to transfer buffers.
+             */
+            bool memoryMapUploadFiles;
 
             /**
              * Callback to receive progress updates for uploads.
@@ -265,7 +274,10 @@ namespace Aws
             bool MultipartUploadSupported(uint64_t length) const;
             bool InitializePartsForDownload(const std::shared_ptr<TransferHandle>& handle);
 
-            void DoMultiPartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle);
+            /**
+             * mapParts sends the parts straight from a read only memory mapping of the handle's target file instead of reading streamToPut into transfer buffers.
+             */
+            void DoMultiPartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle, bool mapParts = false);
             void DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle);
 
             void DoMultiPartUpload(const std::shared_ptr<TransferHandle>& handle);
@@ -45,6 +45,52 @@ namespace Aws
         {
             std::shared_ptr<TransferHandle> handle;
             PartPointer partState;
+            //set when the body of the part is a mapped region of the file instead of a transfer buffer.
+            std::shared_ptr<Aws::FileSystem::MappedFileRegion> mappedPart;
+            //the transfer buffer the part holds while it is in flight. A mapped part doesn't read into it, but still holds one,
+            //so no more parts are mapped at once than the buffer manager has buffers.
+            unsigned char* buffer = nullptr;
+        };
+
+        /**
+         * Read only stream buf over a mapped part. It keeps the mapping alive and has no put area, so nothing can write to the mapping.
+         */
+        class MappedPartStreamBuf : public std::streambuf
+        {
+        public:
+            MappedPartStreamBuf(const std::shared_ptr<Aws::FileSystem::MappedFileRegion>& mappedPart) : m_mappedPart(mappedPart)
+            {
+                //setg only takes char*; the get area is never written through.
+                char* begin = const_cast<char*>(reinterpret_cast<const char*>(m_mappedPart->GetData()));
+                setg(begin, begin, begin + m_mappedPart->GetLength());
+            }
+
+        protected:
+            pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+            {
+                if (dir == std::ios_base::beg)
+                {
+                    return seekpos(off, which);
+                }
+                else if (dir == std::ios_base::cur)
+                {
+                    return seekpos((gptr() - eback()) + off, which);
+                }
+                return seekpos(static_cast<off_type>(m_mappedPart->GetLength()) + off, which);
+            }
+
+            pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+            {
+                if (!(which & std::ios_base::in) || pos < 0 || static_cast<size_t>(pos) > m_mappedPart->GetLength())
+                {
+                    return pos_type(off_type(-1));
+                }
+                setg(eback(), eback() + static_cast<size_t>(pos), egptr());
+                return pos;
+            }
+
+        private:
+            std::shared_ptr<Aws::FileSystem::MappedFileRegion> m_mappedPart;
         };
 
         struct DownloadDirectoryContext : public Aws::Client::AsyncCallerContext
@@ -255,14 +301,14 @@ namespace Aws
 #ifdef _MSC_VER
             auto wide = Aws::Utils::StringUtils::ToWString(handle->GetTargetFilePath().c_str());
             auto streamToPut = Aws::MakeShared<Aws::FStream>(CLASS_TAG, wide.c_str(), std::ios_base::in | std::ios_base::binary);
-            DoMultiPartUpload(streamToPut, handle);
+            DoMultiPartUpload(streamToPut, handle, m_transferConfig.memoryMapUploadFiles);
 #else
             auto streamToPut = Aws::MakeShared<Aws::FStream>(CLASS_TAG, handle->GetTargetFilePath().c_str(), std::ios_base::in | std::ios_base::binary);
-            DoMultiPartUpload(streamToPut, handle);
+            DoMultiPartUpload(streamToPut, handle, m_transferConfig.memoryMapUploadFiles);
 #endif
         }
 
-        void TransferManager::DoMultiPartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle)
+        void TransferManager::DoMultiPartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle, bool mapParts)
         {
             handle->SetIsMultipart(true);
 
@@ -338,14 +384,37 @@ namespace Aws
 
             while (sentBytes < handle->GetBytesTotalSize() && handle->ShouldContinue() && partsIter != queuedParts.end())
             {
+                auto lengthToWrite = partsIter->second->GetSizeInBytes();
+                //taken for mapped parts too, so they are bounded the same way as the ones read into buffers.
                 auto buffer = m_bufferManager.Acquire();
+                std::shared_ptr<Aws::FileSystem::MappedFileRegion> mappedPart;
+                if (mapParts)
+                {
+                    mappedPart = Aws::MakeShared<Aws::FileSystem::MappedFileRegion>(CLASS_TAG, handle->GetTargetFilePath(),
+                            (partsIter->first - 1) * m_transferConfig.bufferSize, static_cast<size_t>(lengthToWrite));
+                    if (!*mappedPart)
+                    {
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Could not map part "
+                                << partsIter->first << " of file " << handle->GetTargetFilePath() << ". Uploading the remaining parts from transfer buffers.");
+                        mappedPart = nullptr;
+                        mapParts = false;
+                    }
+                }
+
                 if(handle->ShouldContinue())
                 {
-                    auto lengthToWrite = partsIter->second->GetSizeInBytes();
-                    streamToPut->seekg((partsIter->first - 1) * m_transferConfig.bufferSize);
-                    streamToPut->read(reinterpret_cast<char*>(buffer), lengthToWrite);
+                    std::streambuf* streamBuf = nullptr;
+                    if (mappedPart)
+                    {
+                        streamBuf = Aws::New<MappedPartStreamBuf>(CLASS_TAG, mappedPart);
+                    }
+                    else
+                    {
+                        streamToPut->seekg((partsIter->first - 1) * m_transferConfig.bufferSize);
+                        streamToPut->read(reinterpret_cast<char*>(buffer), lengthToWrite);
+                        streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
+                    }
 
-                    auto streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
                     auto preallocatedStreamReader = Aws::MakeShared<Aws::IOStream>(CLASS_TAG, streamBuf);
 
                     auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
@@ -368,6 +437,8 @@ namespace Aws
                     auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
                     asyncContext->handle = handle;
                     asyncContext->partState = partsIter->second;
+                    asyncContext->mappedPart = mappedPart;
+                    asyncContext->buffer = buffer;
 
                     auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::UploadPartRequest& request,
                         const Aws::S3::Model::UploadPartOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
@@ -474,10 +545,11 @@ namespace Aws
             std::shared_ptr<TransferHandleAsyncContext> transferContext =
                 std::const_pointer_cast<TransferHandleAsyncContext>(std::static_pointer_cast<const TransferHandleAsyncContext>(context));
 
-            auto originalStreamBuffer = (Aws::Utils::Stream::PreallocatedStreamBuf*)request.GetBody()->rdbuf();
-
-            m_bufferManager.Release(originalStreamBuffer->GetBuffer());
-            Aws::Delete(originalStreamBuffer);
+            //a MappedPartStreamBuf or a PreallocatedStreamBuf over transferContext->buffer.
+            Aws::Delete(request.GetBody()->rdbuf());
+            m_bufferManager.Release(transferContext->buffer);
+            //unmap the part now rather than whenever the client lets go of the context.
+            transferContext->mappedPart = nullptr;
             const auto& handle = transferContext->handle;
             const auto& partState = transferContext->partState;
 
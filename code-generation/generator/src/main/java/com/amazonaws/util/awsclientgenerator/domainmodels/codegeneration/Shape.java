@@ -119,6 +119,13 @@ public class Shape {
                && !member.isStreaming() && !member.isUsedForUri() && !member.isUsedForQueryString());
     }
 
+    public boolean hasListOrMapPayloadMembers() {
+        if (members == null) return false;
+        return members.values().parallelStream().anyMatch(member -> !member.isUsedForHttpStatusCode() && !member.isUsedForHeader()
+               && !member.isStreaming() && !member.isUsedForUri() && !member.isUsedForQueryString()
+               && (member.getShape().isList() || member.getShape().isMap()));
+    }
+
     public boolean hasQueryStringMembers() {
         if (members == null) return false;
         return members.values().parallelStream().anyMatch(member -> member.getLocation() != null && member.getLocation().equalsIgnoreCase("querystring"));
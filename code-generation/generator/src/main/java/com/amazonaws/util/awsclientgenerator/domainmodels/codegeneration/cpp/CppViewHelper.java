@@ -20,7 +20,9 @@ import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.Shape;
 import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.ShapeMember;
 import com.google.common.base.CaseFormat;
 
+import java.nio.charset.StandardCharsets;
 import java.util.HashMap;
+import java.util.HashSet;
 import java.util.LinkedHashSet;
 import java.util.LinkedList;
 import java.util.Map;
@@ -274,6 +276,33 @@ public class CppViewHelper {
         return headers;
     }
 
+    /**
+     * Generated JSON decoders switch on HashingUtils::HashString of each member name, so two payload members whose
+     * names hash the same would give duplicate case labels. Shapes where that happens fall back to key lookups.
+     */
+    public static boolean hasPayloadMemberNameHashCollision(Shape shape) {
+        Set<Integer> hashes = new HashSet<>();
+        for(Map.Entry<String, ShapeMember> entry : shape.getMembers().entrySet()) {
+            if(!entry.getValue().isUsedForPayload()) {
+                continue;
+            }
+            String name = entry.getValue().getLocationName() != null ? entry.getValue().getLocationName() : entry.getKey();
+            if(!hashes.add(computeMemberNameHash(name))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // same as HashingUtils::HashString; member names are ASCII, so whether char is signed makes no difference.
+    private static int computeMemberNameHash(String name) {
+        int hash = 0;
+        for(byte b : name.getBytes(StandardCharsets.UTF_8)) {
+            hash = b + 31 * hash;
+        }
+        return hash;
+    }
+
     public static String computeOperationNameFromInputOutputShape(String shapeName) {
         String requestString = "Request";
         String resultString = "Result";
@@ -33,18 +33,6 @@ public class DynamoDBJsonCppClientGenerator extends JsonCppClientGenerator {
         super();
     }
 
-    @Override
-    public SdkFileEntry[] generateSourceFiles(ServiceModel serviceModel) throws Exception {
-
-        // add a helper class that is used for AttributeValue values.
-        Shape attributeValueShape = new Shape();
-        attributeValueShape.setName("AttributeValueValue");
-        attributeValueShape.setType("structure");
-        serviceModel.getShapes().put(attributeValueShape.getName(), attributeValueShape);
-
-        return super.generateSourceFiles(serviceModel);
-    }
-
     @Override
     protected SdkFileEntry generateModelHeaderFile(ServiceModel serviceModel, Map.Entry<String, Shape> shapeEntry) throws Exception {
         switch(shapeEntry.getKey()) {
@@ -52,10 +40,6 @@ public class DynamoDBJsonCppClientGenerator extends JsonCppClientGenerator {
                 Template template = velocityEngine.getTemplate("/com/amazonaws/util/awsclientgenerator/velocity/cpp/dynamodb/AttributeValueHeader.vm", StandardCharsets.UTF_8.name());
                 return makeFile(template, createContext(serviceModel), "include/aws/dynamodb/model/AttributeValue.h", true);
             }
-            case "AttributeValueValue": {
-                Template template = velocityEngine.getTemplate("/com/amazonaws/util/awsclientgenerator/velocity/cpp/dynamodb/AttributeValueValueHeader.vm", StandardCharsets.UTF_8.name());
-                return makeFile(template, createContext(serviceModel), "include/aws/dynamodb/model/AttributeValueValue.h", true);
-            }
             default:
                 return super.generateModelHeaderFile(serviceModel, shapeEntry);
         }
@@ -68,10 +52,6 @@ public class DynamoDBJsonCppClientGenerator extends JsonCppClientGenerator {
                 Template template = velocityEngine.getTemplate("/com/amazonaws/util/awsclientgenerator/velocity/cpp/dynamodb/AttributeValueSource.vm");
                 return makeFile(template, createContext(serviceModel), "source/model/AttributeValue.cpp", true);
             }
-            case "AttributeValueValue": {
-                Template template = velocityEngine.getTemplate("/com/amazonaws/util/awsclientgenerator/velocity/cpp/dynamodb/AttributeValueValueSource.vm");
-                return makeFile(template, createContext(serviceModel), "source/model/AttributeValueValue.cpp", true);
-            }
             default:
                 return super.generateModelSourceFile(serviceModel, shapeEntry);
         }
@@ -95,6 +95,15 @@ public:
         return httpOutcome;
     }
 
+    void MakeRequestAsync(const std::shared_ptr<const AmazonWebServiceRequest>& request, const HttpResponseOutcomeReceivedHandler& handler,
+        const std::shared_ptr<Aws::Utils::Threading::Executor>& executor = nullptr)
+    {
+        m_countedRetryStrategy->ResetAttemptedRetriesCount();
+        const URI uri("domain.com/something");
+        const auto method = HttpMethod::HTTP_GET;
+        AWSClient::AttemptExhaustivelyAsync(uri, request, method, Aws::Auth::SIGV4_SIGNER, executor, handler);
+    }
+
     inline static const char* GetMockAccessKey() { return "AKIDEXAMPLE"; }
     inline static const char* GetMockSecretAccessKey() { return "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"; }
 
@@ -105,6 +114,9 @@ public:
 
     inline const char* GetServiceClientName() const override { return "MockAWSClient"; }
 
+    using AWSClient::WarmUp;
+    using AWSClient::SetWarmUpEndpoint;
+
 protected:
     std::shared_ptr<CountedRetryStrategy> m_countedRetryStrategy;
     AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<HttpResponse>& response) const override